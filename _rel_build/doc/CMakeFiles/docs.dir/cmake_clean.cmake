@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "../build/output/index.adoc"
+  "../control.pdf"
+  "CMakeFiles/docs"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/docs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,110 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ai/a_star.c" "src/CMakeFiles/control.dir/ai/a_star.c.o" "gcc" "src/CMakeFiles/control.dir/ai/a_star.c.o.d"
+  "/root/repo/src/ai/inpolygon.c" "src/CMakeFiles/control.dir/ai/inpolygon.c.o" "gcc" "src/CMakeFiles/control.dir/ai/inpolygon.c.o.d"
+  "/root/repo/src/dynamics/c2d.c" "src/CMakeFiles/control.dir/dynamics/c2d.c.o" "gcc" "src/CMakeFiles/control.dir/dynamics/c2d.c.o.d"
+  "/root/repo/src/dynamics/freqresp.c" "src/CMakeFiles/control.dir/dynamics/freqresp.c.o" "gcc" "src/CMakeFiles/control.dir/dynamics/freqresp.c.o.d"
+  "/root/repo/src/dynamics/kalman.c" "src/CMakeFiles/control.dir/dynamics/kalman.c.o" "gcc" "src/CMakeFiles/control.dir/dynamics/kalman.c.o.d"
+  "/root/repo/src/dynamics/lqi.c" "src/CMakeFiles/control.dir/dynamics/lqi.c.o" "gcc" "src/CMakeFiles/control.dir/dynamics/lqi.c.o.d"
+  "/root/repo/src/dynamics/mpc.c" "src/CMakeFiles/control.dir/dynamics/mpc.c.o" "gcc" "src/CMakeFiles/control.dir/dynamics/mpc.c.o.d"
+  "/root/repo/src/dynamics/mrac.c" "src/CMakeFiles/control.dir/dynamics/mrac.c.o" "gcc" "src/CMakeFiles/control.dir/dynamics/mrac.c.o.d"
+  "/root/repo/src/dynamics/pid.c" "src/CMakeFiles/control.dir/dynamics/pid.c.o" "gcc" "src/CMakeFiles/control.dir/dynamics/pid.c.o.d"
+  "/root/repo/src/dynamics/stability.c" "src/CMakeFiles/control.dir/dynamics/stability.c.o" "gcc" "src/CMakeFiles/control.dir/dynamics/stability.c.o.d"
+  "/root/repo/src/dynamics/theta2ss.c" "src/CMakeFiles/control.dir/dynamics/theta2ss.c.o" "gcc" "src/CMakeFiles/control.dir/dynamics/theta2ss.c.o.d"
+  "/root/repo/src/fft/fft.c" "src/CMakeFiles/control.dir/fft/fft.c.o" "gcc" "src/CMakeFiles/control.dir/fft/fft.c.o.d"
+  "/root/repo/src/filter/ekf.c" "src/CMakeFiles/control.dir/filter/ekf.c.o" "gcc" "src/CMakeFiles/control.dir/filter/ekf.c.o.d"
+  "/root/repo/src/filter/filtfilt.c" "src/CMakeFiles/control.dir/filter/filtfilt.c.o" "gcc" "src/CMakeFiles/control.dir/filter/filtfilt.c.o.d"
+  "/root/repo/src/filter/fir.c" "src/CMakeFiles/control.dir/filter/fir.c.o" "gcc" "src/CMakeFiles/control.dir/filter/fir.c.o.d"
+  "/root/repo/src/filter/lowpass.c" "src/CMakeFiles/control.dir/filter/lowpass.c.o" "gcc" "src/CMakeFiles/control.dir/filter/lowpass.c.o.d"
+  "/root/repo/src/filter/mcs.c" "src/CMakeFiles/control.dir/filter/mcs.c.o" "gcc" "src/CMakeFiles/control.dir/filter/mcs.c.o.d"
+  "/root/repo/src/filter/mcs_histogram.c" "src/CMakeFiles/control.dir/filter/mcs_histogram.c.o" "gcc" "src/CMakeFiles/control.dir/filter/mcs_histogram.c.o.d"
+  "/root/repo/src/filter/median_filter.c" "src/CMakeFiles/control.dir/filter/median_filter.c.o" "gcc" "src/CMakeFiles/control.dir/filter/median_filter.c.o.d"
+  "/root/repo/src/filter/moving_average.c" "src/CMakeFiles/control.dir/filter/moving_average.c.o" "gcc" "src/CMakeFiles/control.dir/filter/moving_average.c.o.d"
+  "/root/repo/src/filter/sos.c" "src/CMakeFiles/control.dir/filter/sos.c.o" "gcc" "src/CMakeFiles/control.dir/filter/sos.c.o.d"
+  "/root/repo/src/filter/sqr_ukf.c" "src/CMakeFiles/control.dir/filter/sqr_ukf.c.o" "gcc" "src/CMakeFiles/control.dir/filter/sqr_ukf.c.o.d"
+  "/root/repo/src/filter/sqr_ukf_bank.c" "src/CMakeFiles/control.dir/filter/sqr_ukf_bank.c.o" "gcc" "src/CMakeFiles/control.dir/filter/sqr_ukf_bank.c.o.d"
+  "/root/repo/src/filter/sqr_ukf_filter.c" "src/CMakeFiles/control.dir/filter/sqr_ukf_filter.c.o" "gcc" "src/CMakeFiles/control.dir/filter/sqr_ukf_filter.c.o.d"
+  "/root/repo/src/linalg/add.c" "src/CMakeFiles/control.dir/linalg/add.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/add.c.o.d"
+  "/root/repo/src/linalg/balance.c" "src/CMakeFiles/control.dir/linalg/balance.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/balance.c.o.d"
+  "/root/repo/src/linalg/chol.c" "src/CMakeFiles/control.dir/linalg/chol.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/chol.c.o.d"
+  "/root/repo/src/linalg/cholupdate.c" "src/CMakeFiles/control.dir/linalg/cholupdate.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/cholupdate.c.o.d"
+  "/root/repo/src/linalg/det.c" "src/CMakeFiles/control.dir/linalg/det.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/det.c.o.d"
+  "/root/repo/src/linalg/dlyap.c" "src/CMakeFiles/control.dir/linalg/dlyap.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/dlyap.c.o.d"
+  "/root/repo/src/linalg/eig.c" "src/CMakeFiles/control.dir/linalg/eig.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/eig.c.o.d"
+  "/root/repo/src/linalg/eig_francis.c" "src/CMakeFiles/control.dir/linalg/eig_francis.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/eig_francis.c.o.d"
+  "/root/repo/src/linalg/eig_sym.c" "src/CMakeFiles/control.dir/linalg/eig_sym.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/eig_sym.c.o.d"
+  "/root/repo/src/linalg/expm.c" "src/CMakeFiles/control.dir/linalg/expm.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/expm.c.o.d"
+  "/root/repo/src/linalg/hankel.c" "src/CMakeFiles/control.dir/linalg/hankel.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/hankel.c.o.d"
+  "/root/repo/src/linalg/hankel_operator.c" "src/CMakeFiles/control.dir/linalg/hankel_operator.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/hankel_operator.c.o.d"
+  "/root/repo/src/linalg/inv.c" "src/CMakeFiles/control.dir/linalg/inv.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/inv.c.o.d"
+  "/root/repo/src/linalg/linsolve_cg.c" "src/CMakeFiles/control.dir/linalg/linsolve_cg.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/linsolve_cg.c.o.d"
+  "/root/repo/src/linalg/linsolve_chol.c" "src/CMakeFiles/control.dir/linalg/linsolve_chol.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/linsolve_chol.c.o.d"
+  "/root/repo/src/linalg/linsolve_gauss.c" "src/CMakeFiles/control.dir/linalg/linsolve_gauss.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/linsolve_gauss.c.o.d"
+  "/root/repo/src/linalg/linsolve_gmres.c" "src/CMakeFiles/control.dir/linalg/linsolve_gmres.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/linsolve_gmres.c.o.d"
+  "/root/repo/src/linalg/linsolve_jacobi_preconditioner.c" "src/CMakeFiles/control.dir/linalg/linsolve_jacobi_preconditioner.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/linsolve_jacobi_preconditioner.c.o.d"
+  "/root/repo/src/linalg/linsolve_lower_triangular.c" "src/CMakeFiles/control.dir/linalg/linsolve_lower_triangular.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/linsolve_lower_triangular.c.o.d"
+  "/root/repo/src/linalg/linsolve_lup.c" "src/CMakeFiles/control.dir/linalg/linsolve_lup.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/linsolve_lup.c.o.d"
+  "/root/repo/src/linalg/linsolve_markov.c" "src/CMakeFiles/control.dir/linalg/linsolve_markov.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/linsolve_markov.c.o.d"
+  "/root/repo/src/linalg/linsolve_markov_mimo.c" "src/CMakeFiles/control.dir/linalg/linsolve_markov_mimo.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/linsolve_markov_mimo.c.o.d"
+  "/root/repo/src/linalg/linsolve_minres.c" "src/CMakeFiles/control.dir/linalg/linsolve_minres.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/linsolve_minres.c.o.d"
+  "/root/repo/src/linalg/linsolve_qr.c" "src/CMakeFiles/control.dir/linalg/linsolve_qr.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/linsolve_qr.c.o.d"
+  "/root/repo/src/linalg/linsolve_upper_triangular.c" "src/CMakeFiles/control.dir/linalg/linsolve_upper_triangular.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/linsolve_upper_triangular.c.o.d"
+  "/root/repo/src/linalg/lstsq.c" "src/CMakeFiles/control.dir/linalg/lstsq.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/lstsq.c.o.d"
+  "/root/repo/src/linalg/lup.c" "src/CMakeFiles/control.dir/linalg/lup.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/lup.c.o.d"
+  "/root/repo/src/linalg/mat_view.c" "src/CMakeFiles/control.dir/linalg/mat_view.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/mat_view.c.o.d"
+  "/root/repo/src/linalg/mul.c" "src/CMakeFiles/control.dir/linalg/mul.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/mul.c.o.d"
+  "/root/repo/src/linalg/nonlinsolve.c" "src/CMakeFiles/control.dir/linalg/nonlinsolve.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/nonlinsolve.c.o.d"
+  "/root/repo/src/linalg/nonlinsolve_lm.c" "src/CMakeFiles/control.dir/linalg/nonlinsolve_lm.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/nonlinsolve_lm.c.o.d"
+  "/root/repo/src/linalg/norm.c" "src/CMakeFiles/control.dir/linalg/norm.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/norm.c.o.d"
+  "/root/repo/src/linalg/pinv.c" "src/CMakeFiles/control.dir/linalg/pinv.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/pinv.c.o.d"
+  "/root/repo/src/linalg/qr.c" "src/CMakeFiles/control.dir/linalg/qr.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/qr.c.o.d"
+  "/root/repo/src/linalg/rcond.c" "src/CMakeFiles/control.dir/linalg/rcond.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/rcond.c.o.d"
+  "/root/repo/src/linalg/sum.c" "src/CMakeFiles/control.dir/linalg/sum.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/sum.c.o.d"
+  "/root/repo/src/linalg/svd_golub_reinsch.c" "src/CMakeFiles/control.dir/linalg/svd_golub_reinsch.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/svd_golub_reinsch.c.o.d"
+  "/root/repo/src/linalg/svd_jacobi.c" "src/CMakeFiles/control.dir/linalg/svd_jacobi.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/svd_jacobi.c.o.d"
+  "/root/repo/src/linalg/svd_jacobi_one_sided.c" "src/CMakeFiles/control.dir/linalg/svd_jacobi_one_sided.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/svd_jacobi_one_sided.c.o.d"
+  "/root/repo/src/linalg/svd_lanczos.c" "src/CMakeFiles/control.dir/linalg/svd_lanczos.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/svd_lanczos.c.o.d"
+  "/root/repo/src/linalg/svd_randomized.c" "src/CMakeFiles/control.dir/linalg/svd_randomized.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/svd_randomized.c.o.d"
+  "/root/repo/src/linalg/tran.c" "src/CMakeFiles/control.dir/linalg/tran.c.o" "gcc" "src/CMakeFiles/control.dir/linalg/tran.c.o.d"
+  "/root/repo/src/misc/cat.c" "src/CMakeFiles/control.dir/misc/cat.c.o" "gcc" "src/CMakeFiles/control.dir/misc/cat.c.o.d"
+  "/root/repo/src/misc/constrain.c" "src/CMakeFiles/control.dir/misc/constrain.c.o" "gcc" "src/CMakeFiles/control.dir/misc/constrain.c.o.d"
+  "/root/repo/src/misc/cut.c" "src/CMakeFiles/control.dir/misc/cut.c.o" "gcc" "src/CMakeFiles/control.dir/misc/cut.c.o.d"
+  "/root/repo/src/misc/insert.c" "src/CMakeFiles/control.dir/misc/insert.c.o" "gcc" "src/CMakeFiles/control.dir/misc/insert.c.o.d"
+  "/root/repo/src/misc/mean.c" "src/CMakeFiles/control.dir/misc/mean.c.o" "gcc" "src/CMakeFiles/control.dir/misc/mean.c.o.d"
+  "/root/repo/src/misc/print.c" "src/CMakeFiles/control.dir/misc/print.c.o" "gcc" "src/CMakeFiles/control.dir/misc/print.c.o.d"
+  "/root/repo/src/misc/randn.c" "src/CMakeFiles/control.dir/misc/randn.c.o" "gcc" "src/CMakeFiles/control.dir/misc/randn.c.o.d"
+  "/root/repo/src/misc/rng.c" "src/CMakeFiles/control.dir/misc/rng.c.o" "gcc" "src/CMakeFiles/control.dir/misc/rng.c.o.d"
+  "/root/repo/src/misc/sign.c" "src/CMakeFiles/control.dir/misc/sign.c.o" "gcc" "src/CMakeFiles/control.dir/misc/sign.c.o.d"
+  "/root/repo/src/misc/stats.c" "src/CMakeFiles/control.dir/misc/stats.c.o" "gcc" "src/CMakeFiles/control.dir/misc/stats.c.o.d"
+  "/root/repo/src/misc/stddev.c" "src/CMakeFiles/control.dir/misc/stddev.c.o" "gcc" "src/CMakeFiles/control.dir/misc/stddev.c.o.d"
+  "/root/repo/src/model/dc_motor.c" "src/CMakeFiles/control.dir/model/dc_motor.c.o" "gcc" "src/CMakeFiles/control.dir/model/dc_motor.c.o.d"
+  "/root/repo/src/motion/motion_profile.c" "src/CMakeFiles/control.dir/motion/motion_profile.c.o" "gcc" "src/CMakeFiles/control.dir/motion/motion_profile.c.o.d"
+  "/root/repo/src/motor/clarke.c" "src/CMakeFiles/control.dir/motor/clarke.c.o" "gcc" "src/CMakeFiles/control.dir/motor/clarke.c.o.d"
+  "/root/repo/src/motor/park.c" "src/CMakeFiles/control.dir/motor/park.c.o" "gcc" "src/CMakeFiles/control.dir/motor/park.c.o.d"
+  "/root/repo/src/optimization/linprog.c" "src/CMakeFiles/control.dir/optimization/linprog.c.o" "gcc" "src/CMakeFiles/control.dir/optimization/linprog.c.o.d"
+  "/root/repo/src/sparse/csc.c" "src/CMakeFiles/control.dir/sparse/csc.c.o" "gcc" "src/CMakeFiles/control.dir/sparse/csc.c.o.d"
+  "/root/repo/src/sparse/csr.c" "src/CMakeFiles/control.dir/sparse/csr.c.o" "gcc" "src/CMakeFiles/control.dir/sparse/csr.c.o.d"
+  "/root/repo/src/sparse/ic0.c" "src/CMakeFiles/control.dir/sparse/ic0.c.o" "gcc" "src/CMakeFiles/control.dir/sparse/ic0.c.o.d"
+  "/root/repo/src/sparse/ilu0.c" "src/CMakeFiles/control.dir/sparse/ilu0.c.o" "gcc" "src/CMakeFiles/control.dir/sparse/ilu0.c.o.d"
+  "/root/repo/src/sparse/linsolve_triangular.c" "src/CMakeFiles/control.dir/sparse/linsolve_triangular.c.o" "gcc" "src/CMakeFiles/control.dir/sparse/linsolve_triangular.c.o.d"
+  "/root/repo/src/sparse/spmm.c" "src/CMakeFiles/control.dir/sparse/spmm.c.o" "gcc" "src/CMakeFiles/control.dir/sparse/spmm.c.o.d"
+  "/root/repo/src/sparse/spmv.c" "src/CMakeFiles/control.dir/sparse/spmv.c.o" "gcc" "src/CMakeFiles/control.dir/sparse/spmv.c.o.d"
+  "/root/repo/src/sysid/okid_era.c" "src/CMakeFiles/control.dir/sysid/okid_era.c.o" "gcc" "src/CMakeFiles/control.dir/sysid/okid_era.c.o.d"
+  "/root/repo/src/sysid/rls.c" "src/CMakeFiles/control.dir/sysid/rls.c.o" "gcc" "src/CMakeFiles/control.dir/sysid/rls.c.o.d"
+  "/root/repo/src/sysid/sqr_ukf_id.c" "src/CMakeFiles/control.dir/sysid/sqr_ukf_id.c.o" "gcc" "src/CMakeFiles/control.dir/sysid/sqr_ukf_id.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
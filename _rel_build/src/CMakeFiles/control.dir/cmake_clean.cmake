@@ -0,0 +1,193 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/control.dir/ai/a_star.c.o"
+  "CMakeFiles/control.dir/ai/a_star.c.o.d"
+  "CMakeFiles/control.dir/ai/inpolygon.c.o"
+  "CMakeFiles/control.dir/ai/inpolygon.c.o.d"
+  "CMakeFiles/control.dir/dynamics/c2d.c.o"
+  "CMakeFiles/control.dir/dynamics/c2d.c.o.d"
+  "CMakeFiles/control.dir/dynamics/freqresp.c.o"
+  "CMakeFiles/control.dir/dynamics/freqresp.c.o.d"
+  "CMakeFiles/control.dir/dynamics/kalman.c.o"
+  "CMakeFiles/control.dir/dynamics/kalman.c.o.d"
+  "CMakeFiles/control.dir/dynamics/lqi.c.o"
+  "CMakeFiles/control.dir/dynamics/lqi.c.o.d"
+  "CMakeFiles/control.dir/dynamics/mpc.c.o"
+  "CMakeFiles/control.dir/dynamics/mpc.c.o.d"
+  "CMakeFiles/control.dir/dynamics/mrac.c.o"
+  "CMakeFiles/control.dir/dynamics/mrac.c.o.d"
+  "CMakeFiles/control.dir/dynamics/pid.c.o"
+  "CMakeFiles/control.dir/dynamics/pid.c.o.d"
+  "CMakeFiles/control.dir/dynamics/stability.c.o"
+  "CMakeFiles/control.dir/dynamics/stability.c.o.d"
+  "CMakeFiles/control.dir/dynamics/theta2ss.c.o"
+  "CMakeFiles/control.dir/dynamics/theta2ss.c.o.d"
+  "CMakeFiles/control.dir/fft/fft.c.o"
+  "CMakeFiles/control.dir/fft/fft.c.o.d"
+  "CMakeFiles/control.dir/filter/ekf.c.o"
+  "CMakeFiles/control.dir/filter/ekf.c.o.d"
+  "CMakeFiles/control.dir/filter/filtfilt.c.o"
+  "CMakeFiles/control.dir/filter/filtfilt.c.o.d"
+  "CMakeFiles/control.dir/filter/fir.c.o"
+  "CMakeFiles/control.dir/filter/fir.c.o.d"
+  "CMakeFiles/control.dir/filter/lowpass.c.o"
+  "CMakeFiles/control.dir/filter/lowpass.c.o.d"
+  "CMakeFiles/control.dir/filter/mcs.c.o"
+  "CMakeFiles/control.dir/filter/mcs.c.o.d"
+  "CMakeFiles/control.dir/filter/mcs_histogram.c.o"
+  "CMakeFiles/control.dir/filter/mcs_histogram.c.o.d"
+  "CMakeFiles/control.dir/filter/median_filter.c.o"
+  "CMakeFiles/control.dir/filter/median_filter.c.o.d"
+  "CMakeFiles/control.dir/filter/moving_average.c.o"
+  "CMakeFiles/control.dir/filter/moving_average.c.o.d"
+  "CMakeFiles/control.dir/filter/sos.c.o"
+  "CMakeFiles/control.dir/filter/sos.c.o.d"
+  "CMakeFiles/control.dir/filter/sqr_ukf.c.o"
+  "CMakeFiles/control.dir/filter/sqr_ukf.c.o.d"
+  "CMakeFiles/control.dir/filter/sqr_ukf_bank.c.o"
+  "CMakeFiles/control.dir/filter/sqr_ukf_bank.c.o.d"
+  "CMakeFiles/control.dir/filter/sqr_ukf_filter.c.o"
+  "CMakeFiles/control.dir/filter/sqr_ukf_filter.c.o.d"
+  "CMakeFiles/control.dir/linalg/add.c.o"
+  "CMakeFiles/control.dir/linalg/add.c.o.d"
+  "CMakeFiles/control.dir/linalg/balance.c.o"
+  "CMakeFiles/control.dir/linalg/balance.c.o.d"
+  "CMakeFiles/control.dir/linalg/chol.c.o"
+  "CMakeFiles/control.dir/linalg/chol.c.o.d"
+  "CMakeFiles/control.dir/linalg/cholupdate.c.o"
+  "CMakeFiles/control.dir/linalg/cholupdate.c.o.d"
+  "CMakeFiles/control.dir/linalg/det.c.o"
+  "CMakeFiles/control.dir/linalg/det.c.o.d"
+  "CMakeFiles/control.dir/linalg/dlyap.c.o"
+  "CMakeFiles/control.dir/linalg/dlyap.c.o.d"
+  "CMakeFiles/control.dir/linalg/eig.c.o"
+  "CMakeFiles/control.dir/linalg/eig.c.o.d"
+  "CMakeFiles/control.dir/linalg/eig_francis.c.o"
+  "CMakeFiles/control.dir/linalg/eig_francis.c.o.d"
+  "CMakeFiles/control.dir/linalg/eig_sym.c.o"
+  "CMakeFiles/control.dir/linalg/eig_sym.c.o.d"
+  "CMakeFiles/control.dir/linalg/expm.c.o"
+  "CMakeFiles/control.dir/linalg/expm.c.o.d"
+  "CMakeFiles/control.dir/linalg/hankel.c.o"
+  "CMakeFiles/control.dir/linalg/hankel.c.o.d"
+  "CMakeFiles/control.dir/linalg/hankel_operator.c.o"
+  "CMakeFiles/control.dir/linalg/hankel_operator.c.o.d"
+  "CMakeFiles/control.dir/linalg/inv.c.o"
+  "CMakeFiles/control.dir/linalg/inv.c.o.d"
+  "CMakeFiles/control.dir/linalg/linsolve_cg.c.o"
+  "CMakeFiles/control.dir/linalg/linsolve_cg.c.o.d"
+  "CMakeFiles/control.dir/linalg/linsolve_chol.c.o"
+  "CMakeFiles/control.dir/linalg/linsolve_chol.c.o.d"
+  "CMakeFiles/control.dir/linalg/linsolve_gauss.c.o"
+  "CMakeFiles/control.dir/linalg/linsolve_gauss.c.o.d"
+  "CMakeFiles/control.dir/linalg/linsolve_gmres.c.o"
+  "CMakeFiles/control.dir/linalg/linsolve_gmres.c.o.d"
+  "CMakeFiles/control.dir/linalg/linsolve_jacobi_preconditioner.c.o"
+  "CMakeFiles/control.dir/linalg/linsolve_jacobi_preconditioner.c.o.d"
+  "CMakeFiles/control.dir/linalg/linsolve_lower_triangular.c.o"
+  "CMakeFiles/control.dir/linalg/linsolve_lower_triangular.c.o.d"
+  "CMakeFiles/control.dir/linalg/linsolve_lup.c.o"
+  "CMakeFiles/control.dir/linalg/linsolve_lup.c.o.d"
+  "CMakeFiles/control.dir/linalg/linsolve_markov.c.o"
+  "CMakeFiles/control.dir/linalg/linsolve_markov.c.o.d"
+  "CMakeFiles/control.dir/linalg/linsolve_markov_mimo.c.o"
+  "CMakeFiles/control.dir/linalg/linsolve_markov_mimo.c.o.d"
+  "CMakeFiles/control.dir/linalg/linsolve_minres.c.o"
+  "CMakeFiles/control.dir/linalg/linsolve_minres.c.o.d"
+  "CMakeFiles/control.dir/linalg/linsolve_qr.c.o"
+  "CMakeFiles/control.dir/linalg/linsolve_qr.c.o.d"
+  "CMakeFiles/control.dir/linalg/linsolve_upper_triangular.c.o"
+  "CMakeFiles/control.dir/linalg/linsolve_upper_triangular.c.o.d"
+  "CMakeFiles/control.dir/linalg/lstsq.c.o"
+  "CMakeFiles/control.dir/linalg/lstsq.c.o.d"
+  "CMakeFiles/control.dir/linalg/lup.c.o"
+  "CMakeFiles/control.dir/linalg/lup.c.o.d"
+  "CMakeFiles/control.dir/linalg/mat_view.c.o"
+  "CMakeFiles/control.dir/linalg/mat_view.c.o.d"
+  "CMakeFiles/control.dir/linalg/mul.c.o"
+  "CMakeFiles/control.dir/linalg/mul.c.o.d"
+  "CMakeFiles/control.dir/linalg/nonlinsolve.c.o"
+  "CMakeFiles/control.dir/linalg/nonlinsolve.c.o.d"
+  "CMakeFiles/control.dir/linalg/nonlinsolve_lm.c.o"
+  "CMakeFiles/control.dir/linalg/nonlinsolve_lm.c.o.d"
+  "CMakeFiles/control.dir/linalg/norm.c.o"
+  "CMakeFiles/control.dir/linalg/norm.c.o.d"
+  "CMakeFiles/control.dir/linalg/pinv.c.o"
+  "CMakeFiles/control.dir/linalg/pinv.c.o.d"
+  "CMakeFiles/control.dir/linalg/qr.c.o"
+  "CMakeFiles/control.dir/linalg/qr.c.o.d"
+  "CMakeFiles/control.dir/linalg/rcond.c.o"
+  "CMakeFiles/control.dir/linalg/rcond.c.o.d"
+  "CMakeFiles/control.dir/linalg/sum.c.o"
+  "CMakeFiles/control.dir/linalg/sum.c.o.d"
+  "CMakeFiles/control.dir/linalg/svd_golub_reinsch.c.o"
+  "CMakeFiles/control.dir/linalg/svd_golub_reinsch.c.o.d"
+  "CMakeFiles/control.dir/linalg/svd_jacobi.c.o"
+  "CMakeFiles/control.dir/linalg/svd_jacobi.c.o.d"
+  "CMakeFiles/control.dir/linalg/svd_jacobi_one_sided.c.o"
+  "CMakeFiles/control.dir/linalg/svd_jacobi_one_sided.c.o.d"
+  "CMakeFiles/control.dir/linalg/svd_lanczos.c.o"
+  "CMakeFiles/control.dir/linalg/svd_lanczos.c.o.d"
+  "CMakeFiles/control.dir/linalg/svd_randomized.c.o"
+  "CMakeFiles/control.dir/linalg/svd_randomized.c.o.d"
+  "CMakeFiles/control.dir/linalg/tran.c.o"
+  "CMakeFiles/control.dir/linalg/tran.c.o.d"
+  "CMakeFiles/control.dir/misc/cat.c.o"
+  "CMakeFiles/control.dir/misc/cat.c.o.d"
+  "CMakeFiles/control.dir/misc/constrain.c.o"
+  "CMakeFiles/control.dir/misc/constrain.c.o.d"
+  "CMakeFiles/control.dir/misc/cut.c.o"
+  "CMakeFiles/control.dir/misc/cut.c.o.d"
+  "CMakeFiles/control.dir/misc/insert.c.o"
+  "CMakeFiles/control.dir/misc/insert.c.o.d"
+  "CMakeFiles/control.dir/misc/mean.c.o"
+  "CMakeFiles/control.dir/misc/mean.c.o.d"
+  "CMakeFiles/control.dir/misc/print.c.o"
+  "CMakeFiles/control.dir/misc/print.c.o.d"
+  "CMakeFiles/control.dir/misc/randn.c.o"
+  "CMakeFiles/control.dir/misc/randn.c.o.d"
+  "CMakeFiles/control.dir/misc/rng.c.o"
+  "CMakeFiles/control.dir/misc/rng.c.o.d"
+  "CMakeFiles/control.dir/misc/sign.c.o"
+  "CMakeFiles/control.dir/misc/sign.c.o.d"
+  "CMakeFiles/control.dir/misc/stats.c.o"
+  "CMakeFiles/control.dir/misc/stats.c.o.d"
+  "CMakeFiles/control.dir/misc/stddev.c.o"
+  "CMakeFiles/control.dir/misc/stddev.c.o.d"
+  "CMakeFiles/control.dir/model/dc_motor.c.o"
+  "CMakeFiles/control.dir/model/dc_motor.c.o.d"
+  "CMakeFiles/control.dir/motion/motion_profile.c.o"
+  "CMakeFiles/control.dir/motion/motion_profile.c.o.d"
+  "CMakeFiles/control.dir/motor/clarke.c.o"
+  "CMakeFiles/control.dir/motor/clarke.c.o.d"
+  "CMakeFiles/control.dir/motor/park.c.o"
+  "CMakeFiles/control.dir/motor/park.c.o.d"
+  "CMakeFiles/control.dir/optimization/linprog.c.o"
+  "CMakeFiles/control.dir/optimization/linprog.c.o.d"
+  "CMakeFiles/control.dir/sparse/csc.c.o"
+  "CMakeFiles/control.dir/sparse/csc.c.o.d"
+  "CMakeFiles/control.dir/sparse/csr.c.o"
+  "CMakeFiles/control.dir/sparse/csr.c.o.d"
+  "CMakeFiles/control.dir/sparse/ic0.c.o"
+  "CMakeFiles/control.dir/sparse/ic0.c.o.d"
+  "CMakeFiles/control.dir/sparse/ilu0.c.o"
+  "CMakeFiles/control.dir/sparse/ilu0.c.o.d"
+  "CMakeFiles/control.dir/sparse/linsolve_triangular.c.o"
+  "CMakeFiles/control.dir/sparse/linsolve_triangular.c.o.d"
+  "CMakeFiles/control.dir/sparse/spmm.c.o"
+  "CMakeFiles/control.dir/sparse/spmm.c.o.d"
+  "CMakeFiles/control.dir/sparse/spmv.c.o"
+  "CMakeFiles/control.dir/sparse/spmv.c.o.d"
+  "CMakeFiles/control.dir/sysid/okid_era.c.o"
+  "CMakeFiles/control.dir/sysid/okid_era.c.o.d"
+  "CMakeFiles/control.dir/sysid/rls.c.o"
+  "CMakeFiles/control.dir/sysid/rls.c.o.d"
+  "CMakeFiles/control.dir/sysid/sqr_ukf_id.c.o"
+  "CMakeFiles/control.dir/sysid/sqr_ukf_id.c.o.d"
+  "libcontrol.a"
+  "libcontrol.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/control.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_rel_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("ai")
+subdirs("filter")
+subdirs("motion")
+subdirs("misc")
+subdirs("model")
+subdirs("linalg")
+subdirs("dynamics")
+subdirs("optimization")
+subdirs("sysid")
+subdirs("motor")
+subdirs("sparse")
+subdirs("fft")
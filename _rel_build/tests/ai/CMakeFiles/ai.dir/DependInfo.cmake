@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/ai/a_star.cpp" "tests/ai/CMakeFiles/ai.dir/a_star.cpp.o" "gcc" "tests/ai/CMakeFiles/ai.dir/a_star.cpp.o.d"
+  "/root/repo/tests/ai/inpolygon.cpp" "tests/ai/CMakeFiles/ai.dir/inpolygon.cpp.o" "gcc" "tests/ai/CMakeFiles/ai.dir/inpolygon.cpp.o.d"
+  "/root/repo/tests/ai/main.cpp" "tests/ai/CMakeFiles/ai.dir/main.cpp.o" "gcc" "tests/ai/CMakeFiles/ai.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/control.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
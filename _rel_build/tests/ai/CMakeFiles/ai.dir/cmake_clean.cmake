@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ai.dir/a_star.cpp.o"
+  "CMakeFiles/ai.dir/a_star.cpp.o.d"
+  "CMakeFiles/ai.dir/inpolygon.cpp.o"
+  "CMakeFiles/ai.dir/inpolygon.cpp.o.d"
+  "CMakeFiles/ai.dir/main.cpp.o"
+  "CMakeFiles/ai.dir/main.cpp.o.d"
+  "ai"
+  "ai.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ai.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
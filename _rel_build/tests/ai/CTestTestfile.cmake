@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/ai
+# Build directory: /root/repo/_rel_build/tests/ai
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ai "/root/repo/_rel_build/tests/ai/ai")
+set_tests_properties(ai PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;5;add_test;/root/repo/tests/ai/CMakeLists.txt;4;define_test;/root/repo/tests/ai/CMakeLists.txt;0;")
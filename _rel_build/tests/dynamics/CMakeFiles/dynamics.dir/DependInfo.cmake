@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/dynamics/c2d.cpp" "tests/dynamics/CMakeFiles/dynamics.dir/c2d.cpp.o" "gcc" "tests/dynamics/CMakeFiles/dynamics.dir/c2d.cpp.o.d"
+  "/root/repo/tests/dynamics/freqresp.cpp" "tests/dynamics/CMakeFiles/dynamics.dir/freqresp.cpp.o" "gcc" "tests/dynamics/CMakeFiles/dynamics.dir/freqresp.cpp.o.d"
+  "/root/repo/tests/dynamics/kalman.cpp" "tests/dynamics/CMakeFiles/dynamics.dir/kalman.cpp.o" "gcc" "tests/dynamics/CMakeFiles/dynamics.dir/kalman.cpp.o.d"
+  "/root/repo/tests/dynamics/lqi.cpp" "tests/dynamics/CMakeFiles/dynamics.dir/lqi.cpp.o" "gcc" "tests/dynamics/CMakeFiles/dynamics.dir/lqi.cpp.o.d"
+  "/root/repo/tests/dynamics/main.cpp" "tests/dynamics/CMakeFiles/dynamics.dir/main.cpp.o" "gcc" "tests/dynamics/CMakeFiles/dynamics.dir/main.cpp.o.d"
+  "/root/repo/tests/dynamics/mpc.cpp" "tests/dynamics/CMakeFiles/dynamics.dir/mpc.cpp.o" "gcc" "tests/dynamics/CMakeFiles/dynamics.dir/mpc.cpp.o.d"
+  "/root/repo/tests/dynamics/mrac.cpp" "tests/dynamics/CMakeFiles/dynamics.dir/mrac.cpp.o" "gcc" "tests/dynamics/CMakeFiles/dynamics.dir/mrac.cpp.o.d"
+  "/root/repo/tests/dynamics/pid.cpp" "tests/dynamics/CMakeFiles/dynamics.dir/pid.cpp.o" "gcc" "tests/dynamics/CMakeFiles/dynamics.dir/pid.cpp.o.d"
+  "/root/repo/tests/dynamics/stability.cpp" "tests/dynamics/CMakeFiles/dynamics.dir/stability.cpp.o" "gcc" "tests/dynamics/CMakeFiles/dynamics.dir/stability.cpp.o.d"
+  "/root/repo/tests/dynamics/theta2ss.cpp" "tests/dynamics/CMakeFiles/dynamics.dir/theta2ss.cpp.o" "gcc" "tests/dynamics/CMakeFiles/dynamics.dir/theta2ss.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/control.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
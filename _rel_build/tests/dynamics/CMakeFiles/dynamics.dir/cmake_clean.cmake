@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dynamics.dir/c2d.cpp.o"
+  "CMakeFiles/dynamics.dir/c2d.cpp.o.d"
+  "CMakeFiles/dynamics.dir/freqresp.cpp.o"
+  "CMakeFiles/dynamics.dir/freqresp.cpp.o.d"
+  "CMakeFiles/dynamics.dir/kalman.cpp.o"
+  "CMakeFiles/dynamics.dir/kalman.cpp.o.d"
+  "CMakeFiles/dynamics.dir/lqi.cpp.o"
+  "CMakeFiles/dynamics.dir/lqi.cpp.o.d"
+  "CMakeFiles/dynamics.dir/main.cpp.o"
+  "CMakeFiles/dynamics.dir/main.cpp.o.d"
+  "CMakeFiles/dynamics.dir/mpc.cpp.o"
+  "CMakeFiles/dynamics.dir/mpc.cpp.o.d"
+  "CMakeFiles/dynamics.dir/mrac.cpp.o"
+  "CMakeFiles/dynamics.dir/mrac.cpp.o.d"
+  "CMakeFiles/dynamics.dir/pid.cpp.o"
+  "CMakeFiles/dynamics.dir/pid.cpp.o.d"
+  "CMakeFiles/dynamics.dir/stability.cpp.o"
+  "CMakeFiles/dynamics.dir/stability.cpp.o.d"
+  "CMakeFiles/dynamics.dir/theta2ss.cpp.o"
+  "CMakeFiles/dynamics.dir/theta2ss.cpp.o.d"
+  "dynamics"
+  "dynamics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dynamics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/dynamics
+# Build directory: /root/repo/_rel_build/tests/dynamics
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(dynamics "/root/repo/_rel_build/tests/dynamics/dynamics")
+set_tests_properties(dynamics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;5;add_test;/root/repo/tests/dynamics/CMakeLists.txt;4;define_test;/root/repo/tests/dynamics/CMakeLists.txt;0;")
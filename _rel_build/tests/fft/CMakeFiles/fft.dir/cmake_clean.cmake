@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fft.dir/fft.cpp.o"
+  "CMakeFiles/fft.dir/fft.cpp.o.d"
+  "CMakeFiles/fft.dir/main.cpp.o"
+  "CMakeFiles/fft.dir/main.cpp.o.d"
+  "fft"
+  "fft.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fft.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
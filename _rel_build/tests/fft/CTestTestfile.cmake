@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/fft
+# Build directory: /root/repo/_rel_build/tests/fft
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(fft "/root/repo/_rel_build/tests/fft/fft")
+set_tests_properties(fft PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;5;add_test;/root/repo/tests/fft/CMakeLists.txt;6;define_test;/root/repo/tests/fft/CMakeLists.txt;0;")
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/filter/ekf.cpp" "tests/filter/CMakeFiles/filter.dir/ekf.cpp.o" "gcc" "tests/filter/CMakeFiles/filter.dir/ekf.cpp.o.d"
+  "/root/repo/tests/filter/filtfilt.cpp" "tests/filter/CMakeFiles/filter.dir/filtfilt.cpp.o" "gcc" "tests/filter/CMakeFiles/filter.dir/filtfilt.cpp.o.d"
+  "/root/repo/tests/filter/fir.cpp" "tests/filter/CMakeFiles/filter.dir/fir.cpp.o" "gcc" "tests/filter/CMakeFiles/filter.dir/fir.cpp.o.d"
+  "/root/repo/tests/filter/lowpass.cpp" "tests/filter/CMakeFiles/filter.dir/lowpass.cpp.o" "gcc" "tests/filter/CMakeFiles/filter.dir/lowpass.cpp.o.d"
+  "/root/repo/tests/filter/main.cpp" "tests/filter/CMakeFiles/filter.dir/main.cpp.o" "gcc" "tests/filter/CMakeFiles/filter.dir/main.cpp.o.d"
+  "/root/repo/tests/filter/mcs.cpp" "tests/filter/CMakeFiles/filter.dir/mcs.cpp.o" "gcc" "tests/filter/CMakeFiles/filter.dir/mcs.cpp.o.d"
+  "/root/repo/tests/filter/mcs_histogram.cpp" "tests/filter/CMakeFiles/filter.dir/mcs_histogram.cpp.o" "gcc" "tests/filter/CMakeFiles/filter.dir/mcs_histogram.cpp.o.d"
+  "/root/repo/tests/filter/median_filter.cpp" "tests/filter/CMakeFiles/filter.dir/median_filter.cpp.o" "gcc" "tests/filter/CMakeFiles/filter.dir/median_filter.cpp.o.d"
+  "/root/repo/tests/filter/moving_average.cpp" "tests/filter/CMakeFiles/filter.dir/moving_average.cpp.o" "gcc" "tests/filter/CMakeFiles/filter.dir/moving_average.cpp.o.d"
+  "/root/repo/tests/filter/sos.cpp" "tests/filter/CMakeFiles/filter.dir/sos.cpp.o" "gcc" "tests/filter/CMakeFiles/filter.dir/sos.cpp.o.d"
+  "/root/repo/tests/filter/sqr_ukf.cpp" "tests/filter/CMakeFiles/filter.dir/sqr_ukf.cpp.o" "gcc" "tests/filter/CMakeFiles/filter.dir/sqr_ukf.cpp.o.d"
+  "/root/repo/tests/filter/sqr_ukf_bank.cpp" "tests/filter/CMakeFiles/filter.dir/sqr_ukf_bank.cpp.o" "gcc" "tests/filter/CMakeFiles/filter.dir/sqr_ukf_bank.cpp.o.d"
+  "/root/repo/tests/filter/sqr_ukf_filter.cpp" "tests/filter/CMakeFiles/filter.dir/sqr_ukf_filter.cpp.o" "gcc" "tests/filter/CMakeFiles/filter.dir/sqr_ukf_filter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/control.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/filter.dir/ekf.cpp.o"
+  "CMakeFiles/filter.dir/ekf.cpp.o.d"
+  "CMakeFiles/filter.dir/filtfilt.cpp.o"
+  "CMakeFiles/filter.dir/filtfilt.cpp.o.d"
+  "CMakeFiles/filter.dir/fir.cpp.o"
+  "CMakeFiles/filter.dir/fir.cpp.o.d"
+  "CMakeFiles/filter.dir/lowpass.cpp.o"
+  "CMakeFiles/filter.dir/lowpass.cpp.o.d"
+  "CMakeFiles/filter.dir/main.cpp.o"
+  "CMakeFiles/filter.dir/main.cpp.o.d"
+  "CMakeFiles/filter.dir/mcs.cpp.o"
+  "CMakeFiles/filter.dir/mcs.cpp.o.d"
+  "CMakeFiles/filter.dir/mcs_histogram.cpp.o"
+  "CMakeFiles/filter.dir/mcs_histogram.cpp.o.d"
+  "CMakeFiles/filter.dir/median_filter.cpp.o"
+  "CMakeFiles/filter.dir/median_filter.cpp.o.d"
+  "CMakeFiles/filter.dir/moving_average.cpp.o"
+  "CMakeFiles/filter.dir/moving_average.cpp.o.d"
+  "CMakeFiles/filter.dir/sos.cpp.o"
+  "CMakeFiles/filter.dir/sos.cpp.o.d"
+  "CMakeFiles/filter.dir/sqr_ukf.cpp.o"
+  "CMakeFiles/filter.dir/sqr_ukf.cpp.o.d"
+  "CMakeFiles/filter.dir/sqr_ukf_bank.cpp.o"
+  "CMakeFiles/filter.dir/sqr_ukf_bank.cpp.o.d"
+  "CMakeFiles/filter.dir/sqr_ukf_filter.cpp.o"
+  "CMakeFiles/filter.dir/sqr_ukf_filter.cpp.o.d"
+  "filter"
+  "filter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/filter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
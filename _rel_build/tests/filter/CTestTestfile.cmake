@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/filter
+# Build directory: /root/repo/_rel_build/tests/filter
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(filter "/root/repo/_rel_build/tests/filter/filter")
+set_tests_properties(filter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;5;add_test;/root/repo/tests/filter/CMakeLists.txt;6;define_test;/root/repo/tests/filter/CMakeLists.txt;0;")
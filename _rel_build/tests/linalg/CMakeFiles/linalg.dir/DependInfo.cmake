@@ -0,0 +1,63 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/linalg/add.cpp" "tests/linalg/CMakeFiles/linalg.dir/add.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/add.cpp.o.d"
+  "/root/repo/tests/linalg/balance.cpp" "tests/linalg/CMakeFiles/linalg.dir/balance.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/balance.cpp.o.d"
+  "/root/repo/tests/linalg/chol.cpp" "tests/linalg/CMakeFiles/linalg.dir/chol.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/chol.cpp.o.d"
+  "/root/repo/tests/linalg/cholupdate.cpp" "tests/linalg/CMakeFiles/linalg.dir/cholupdate.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/cholupdate.cpp.o.d"
+  "/root/repo/tests/linalg/det.cpp" "tests/linalg/CMakeFiles/linalg.dir/det.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/det.cpp.o.d"
+  "/root/repo/tests/linalg/dlyap.cpp" "tests/linalg/CMakeFiles/linalg.dir/dlyap.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/dlyap.cpp.o.d"
+  "/root/repo/tests/linalg/eig.cpp" "tests/linalg/CMakeFiles/linalg.dir/eig.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/eig.cpp.o.d"
+  "/root/repo/tests/linalg/eig_francis.cpp" "tests/linalg/CMakeFiles/linalg.dir/eig_francis.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/eig_francis.cpp.o.d"
+  "/root/repo/tests/linalg/eig_sym.cpp" "tests/linalg/CMakeFiles/linalg.dir/eig_sym.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/eig_sym.cpp.o.d"
+  "/root/repo/tests/linalg/expm.cpp" "tests/linalg/CMakeFiles/linalg.dir/expm.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/expm.cpp.o.d"
+  "/root/repo/tests/linalg/hankel.cpp" "tests/linalg/CMakeFiles/linalg.dir/hankel.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/hankel.cpp.o.d"
+  "/root/repo/tests/linalg/hankel_operator.cpp" "tests/linalg/CMakeFiles/linalg.dir/hankel_operator.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/hankel_operator.cpp.o.d"
+  "/root/repo/tests/linalg/inv.cpp" "tests/linalg/CMakeFiles/linalg.dir/inv.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/inv.cpp.o.d"
+  "/root/repo/tests/linalg/linsolve_cg.cpp" "tests/linalg/CMakeFiles/linalg.dir/linsolve_cg.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/linsolve_cg.cpp.o.d"
+  "/root/repo/tests/linalg/linsolve_chol.cpp" "tests/linalg/CMakeFiles/linalg.dir/linsolve_chol.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/linsolve_chol.cpp.o.d"
+  "/root/repo/tests/linalg/linsolve_gauss.cpp" "tests/linalg/CMakeFiles/linalg.dir/linsolve_gauss.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/linsolve_gauss.cpp.o.d"
+  "/root/repo/tests/linalg/linsolve_gmres.cpp" "tests/linalg/CMakeFiles/linalg.dir/linsolve_gmres.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/linsolve_gmres.cpp.o.d"
+  "/root/repo/tests/linalg/linsolve_jacobi_preconditioner.cpp" "tests/linalg/CMakeFiles/linalg.dir/linsolve_jacobi_preconditioner.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/linsolve_jacobi_preconditioner.cpp.o.d"
+  "/root/repo/tests/linalg/linsolve_lower_triangular.cpp" "tests/linalg/CMakeFiles/linalg.dir/linsolve_lower_triangular.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/linsolve_lower_triangular.cpp.o.d"
+  "/root/repo/tests/linalg/linsolve_lup.cpp" "tests/linalg/CMakeFiles/linalg.dir/linsolve_lup.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/linsolve_lup.cpp.o.d"
+  "/root/repo/tests/linalg/linsolve_markov.cpp" "tests/linalg/CMakeFiles/linalg.dir/linsolve_markov.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/linsolve_markov.cpp.o.d"
+  "/root/repo/tests/linalg/linsolve_markov_mimo.cpp" "tests/linalg/CMakeFiles/linalg.dir/linsolve_markov_mimo.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/linsolve_markov_mimo.cpp.o.d"
+  "/root/repo/tests/linalg/linsolve_minres.cpp" "tests/linalg/CMakeFiles/linalg.dir/linsolve_minres.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/linsolve_minres.cpp.o.d"
+  "/root/repo/tests/linalg/linsolve_qr.cpp" "tests/linalg/CMakeFiles/linalg.dir/linsolve_qr.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/linsolve_qr.cpp.o.d"
+  "/root/repo/tests/linalg/linsolve_upper_triangular.cpp" "tests/linalg/CMakeFiles/linalg.dir/linsolve_upper_triangular.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/linsolve_upper_triangular.cpp.o.d"
+  "/root/repo/tests/linalg/lstsq.cpp" "tests/linalg/CMakeFiles/linalg.dir/lstsq.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/lstsq.cpp.o.d"
+  "/root/repo/tests/linalg/lup.cpp" "tests/linalg/CMakeFiles/linalg.dir/lup.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/lup.cpp.o.d"
+  "/root/repo/tests/linalg/main.cpp" "tests/linalg/CMakeFiles/linalg.dir/main.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/main.cpp.o.d"
+  "/root/repo/tests/linalg/mat_view.cpp" "tests/linalg/CMakeFiles/linalg.dir/mat_view.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/mat_view.cpp.o.d"
+  "/root/repo/tests/linalg/matrix.cpp" "tests/linalg/CMakeFiles/linalg.dir/matrix.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/matrix.cpp.o.d"
+  "/root/repo/tests/linalg/mul.cpp" "tests/linalg/CMakeFiles/linalg.dir/mul.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/mul.cpp.o.d"
+  "/root/repo/tests/linalg/nonlinsolve.cpp" "tests/linalg/CMakeFiles/linalg.dir/nonlinsolve.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/nonlinsolve.cpp.o.d"
+  "/root/repo/tests/linalg/nonlinsolve_lm.cpp" "tests/linalg/CMakeFiles/linalg.dir/nonlinsolve_lm.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/nonlinsolve_lm.cpp.o.d"
+  "/root/repo/tests/linalg/norm.cpp" "tests/linalg/CMakeFiles/linalg.dir/norm.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/norm.cpp.o.d"
+  "/root/repo/tests/linalg/pinv.cpp" "tests/linalg/CMakeFiles/linalg.dir/pinv.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/pinv.cpp.o.d"
+  "/root/repo/tests/linalg/qr.cpp" "tests/linalg/CMakeFiles/linalg.dir/qr.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/qr.cpp.o.d"
+  "/root/repo/tests/linalg/rcond.cpp" "tests/linalg/CMakeFiles/linalg.dir/rcond.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/rcond.cpp.o.d"
+  "/root/repo/tests/linalg/sum.cpp" "tests/linalg/CMakeFiles/linalg.dir/sum.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/sum.cpp.o.d"
+  "/root/repo/tests/linalg/svd_golub_reinsch.cpp" "tests/linalg/CMakeFiles/linalg.dir/svd_golub_reinsch.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/svd_golub_reinsch.cpp.o.d"
+  "/root/repo/tests/linalg/svd_jacobi.cpp" "tests/linalg/CMakeFiles/linalg.dir/svd_jacobi.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/svd_jacobi.cpp.o.d"
+  "/root/repo/tests/linalg/svd_jacobi_one_sided.cpp" "tests/linalg/CMakeFiles/linalg.dir/svd_jacobi_one_sided.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/svd_jacobi_one_sided.cpp.o.d"
+  "/root/repo/tests/linalg/svd_lanczos.cpp" "tests/linalg/CMakeFiles/linalg.dir/svd_lanczos.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/svd_lanczos.cpp.o.d"
+  "/root/repo/tests/linalg/svd_randomized.cpp" "tests/linalg/CMakeFiles/linalg.dir/svd_randomized.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/svd_randomized.cpp.o.d"
+  "/root/repo/tests/linalg/tran.cpp" "tests/linalg/CMakeFiles/linalg.dir/tran.cpp.o" "gcc" "tests/linalg/CMakeFiles/linalg.dir/tran.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/control.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,97 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linalg.dir/add.cpp.o"
+  "CMakeFiles/linalg.dir/add.cpp.o.d"
+  "CMakeFiles/linalg.dir/balance.cpp.o"
+  "CMakeFiles/linalg.dir/balance.cpp.o.d"
+  "CMakeFiles/linalg.dir/chol.cpp.o"
+  "CMakeFiles/linalg.dir/chol.cpp.o.d"
+  "CMakeFiles/linalg.dir/cholupdate.cpp.o"
+  "CMakeFiles/linalg.dir/cholupdate.cpp.o.d"
+  "CMakeFiles/linalg.dir/det.cpp.o"
+  "CMakeFiles/linalg.dir/det.cpp.o.d"
+  "CMakeFiles/linalg.dir/dlyap.cpp.o"
+  "CMakeFiles/linalg.dir/dlyap.cpp.o.d"
+  "CMakeFiles/linalg.dir/eig.cpp.o"
+  "CMakeFiles/linalg.dir/eig.cpp.o.d"
+  "CMakeFiles/linalg.dir/eig_francis.cpp.o"
+  "CMakeFiles/linalg.dir/eig_francis.cpp.o.d"
+  "CMakeFiles/linalg.dir/eig_sym.cpp.o"
+  "CMakeFiles/linalg.dir/eig_sym.cpp.o.d"
+  "CMakeFiles/linalg.dir/expm.cpp.o"
+  "CMakeFiles/linalg.dir/expm.cpp.o.d"
+  "CMakeFiles/linalg.dir/hankel.cpp.o"
+  "CMakeFiles/linalg.dir/hankel.cpp.o.d"
+  "CMakeFiles/linalg.dir/hankel_operator.cpp.o"
+  "CMakeFiles/linalg.dir/hankel_operator.cpp.o.d"
+  "CMakeFiles/linalg.dir/inv.cpp.o"
+  "CMakeFiles/linalg.dir/inv.cpp.o.d"
+  "CMakeFiles/linalg.dir/linsolve_cg.cpp.o"
+  "CMakeFiles/linalg.dir/linsolve_cg.cpp.o.d"
+  "CMakeFiles/linalg.dir/linsolve_chol.cpp.o"
+  "CMakeFiles/linalg.dir/linsolve_chol.cpp.o.d"
+  "CMakeFiles/linalg.dir/linsolve_gauss.cpp.o"
+  "CMakeFiles/linalg.dir/linsolve_gauss.cpp.o.d"
+  "CMakeFiles/linalg.dir/linsolve_gmres.cpp.o"
+  "CMakeFiles/linalg.dir/linsolve_gmres.cpp.o.d"
+  "CMakeFiles/linalg.dir/linsolve_jacobi_preconditioner.cpp.o"
+  "CMakeFiles/linalg.dir/linsolve_jacobi_preconditioner.cpp.o.d"
+  "CMakeFiles/linalg.dir/linsolve_lower_triangular.cpp.o"
+  "CMakeFiles/linalg.dir/linsolve_lower_triangular.cpp.o.d"
+  "CMakeFiles/linalg.dir/linsolve_lup.cpp.o"
+  "CMakeFiles/linalg.dir/linsolve_lup.cpp.o.d"
+  "CMakeFiles/linalg.dir/linsolve_markov.cpp.o"
+  "CMakeFiles/linalg.dir/linsolve_markov.cpp.o.d"
+  "CMakeFiles/linalg.dir/linsolve_markov_mimo.cpp.o"
+  "CMakeFiles/linalg.dir/linsolve_markov_mimo.cpp.o.d"
+  "CMakeFiles/linalg.dir/linsolve_minres.cpp.o"
+  "CMakeFiles/linalg.dir/linsolve_minres.cpp.o.d"
+  "CMakeFiles/linalg.dir/linsolve_qr.cpp.o"
+  "CMakeFiles/linalg.dir/linsolve_qr.cpp.o.d"
+  "CMakeFiles/linalg.dir/linsolve_upper_triangular.cpp.o"
+  "CMakeFiles/linalg.dir/linsolve_upper_triangular.cpp.o.d"
+  "CMakeFiles/linalg.dir/lstsq.cpp.o"
+  "CMakeFiles/linalg.dir/lstsq.cpp.o.d"
+  "CMakeFiles/linalg.dir/lup.cpp.o"
+  "CMakeFiles/linalg.dir/lup.cpp.o.d"
+  "CMakeFiles/linalg.dir/main.cpp.o"
+  "CMakeFiles/linalg.dir/main.cpp.o.d"
+  "CMakeFiles/linalg.dir/mat_view.cpp.o"
+  "CMakeFiles/linalg.dir/mat_view.cpp.o.d"
+  "CMakeFiles/linalg.dir/matrix.cpp.o"
+  "CMakeFiles/linalg.dir/matrix.cpp.o.d"
+  "CMakeFiles/linalg.dir/mul.cpp.o"
+  "CMakeFiles/linalg.dir/mul.cpp.o.d"
+  "CMakeFiles/linalg.dir/nonlinsolve.cpp.o"
+  "CMakeFiles/linalg.dir/nonlinsolve.cpp.o.d"
+  "CMakeFiles/linalg.dir/nonlinsolve_lm.cpp.o"
+  "CMakeFiles/linalg.dir/nonlinsolve_lm.cpp.o.d"
+  "CMakeFiles/linalg.dir/norm.cpp.o"
+  "CMakeFiles/linalg.dir/norm.cpp.o.d"
+  "CMakeFiles/linalg.dir/pinv.cpp.o"
+  "CMakeFiles/linalg.dir/pinv.cpp.o.d"
+  "CMakeFiles/linalg.dir/qr.cpp.o"
+  "CMakeFiles/linalg.dir/qr.cpp.o.d"
+  "CMakeFiles/linalg.dir/rcond.cpp.o"
+  "CMakeFiles/linalg.dir/rcond.cpp.o.d"
+  "CMakeFiles/linalg.dir/sum.cpp.o"
+  "CMakeFiles/linalg.dir/sum.cpp.o.d"
+  "CMakeFiles/linalg.dir/svd_golub_reinsch.cpp.o"
+  "CMakeFiles/linalg.dir/svd_golub_reinsch.cpp.o.d"
+  "CMakeFiles/linalg.dir/svd_jacobi.cpp.o"
+  "CMakeFiles/linalg.dir/svd_jacobi.cpp.o.d"
+  "CMakeFiles/linalg.dir/svd_jacobi_one_sided.cpp.o"
+  "CMakeFiles/linalg.dir/svd_jacobi_one_sided.cpp.o.d"
+  "CMakeFiles/linalg.dir/svd_lanczos.cpp.o"
+  "CMakeFiles/linalg.dir/svd_lanczos.cpp.o.d"
+  "CMakeFiles/linalg.dir/svd_randomized.cpp.o"
+  "CMakeFiles/linalg.dir/svd_randomized.cpp.o.d"
+  "CMakeFiles/linalg.dir/tran.cpp.o"
+  "CMakeFiles/linalg.dir/tran.cpp.o.d"
+  "linalg"
+  "linalg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linalg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
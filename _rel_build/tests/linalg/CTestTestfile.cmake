@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/linalg
+# Build directory: /root/repo/_rel_build/tests/linalg
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(linalg "/root/repo/_rel_build/tests/linalg/linalg")
+set_tests_properties(linalg PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;5;add_test;/root/repo/tests/linalg/CMakeLists.txt;6;define_test;/root/repo/tests/linalg/CMakeLists.txt;0;")
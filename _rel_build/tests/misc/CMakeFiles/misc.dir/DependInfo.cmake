@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/misc/cat.cpp" "tests/misc/CMakeFiles/misc.dir/cat.cpp.o" "gcc" "tests/misc/CMakeFiles/misc.dir/cat.cpp.o.d"
+  "/root/repo/tests/misc/constrain.cpp" "tests/misc/CMakeFiles/misc.dir/constrain.cpp.o" "gcc" "tests/misc/CMakeFiles/misc.dir/constrain.cpp.o.d"
+  "/root/repo/tests/misc/cut.cpp" "tests/misc/CMakeFiles/misc.dir/cut.cpp.o" "gcc" "tests/misc/CMakeFiles/misc.dir/cut.cpp.o.d"
+  "/root/repo/tests/misc/insert.cpp" "tests/misc/CMakeFiles/misc.dir/insert.cpp.o" "gcc" "tests/misc/CMakeFiles/misc.dir/insert.cpp.o.d"
+  "/root/repo/tests/misc/main.cpp" "tests/misc/CMakeFiles/misc.dir/main.cpp.o" "gcc" "tests/misc/CMakeFiles/misc.dir/main.cpp.o.d"
+  "/root/repo/tests/misc/mean.cpp" "tests/misc/CMakeFiles/misc.dir/mean.cpp.o" "gcc" "tests/misc/CMakeFiles/misc.dir/mean.cpp.o.d"
+  "/root/repo/tests/misc/print.cpp" "tests/misc/CMakeFiles/misc.dir/print.cpp.o" "gcc" "tests/misc/CMakeFiles/misc.dir/print.cpp.o.d"
+  "/root/repo/tests/misc/randn.cpp" "tests/misc/CMakeFiles/misc.dir/randn.cpp.o" "gcc" "tests/misc/CMakeFiles/misc.dir/randn.cpp.o.d"
+  "/root/repo/tests/misc/rng.cpp" "tests/misc/CMakeFiles/misc.dir/rng.cpp.o" "gcc" "tests/misc/CMakeFiles/misc.dir/rng.cpp.o.d"
+  "/root/repo/tests/misc/sign.cpp" "tests/misc/CMakeFiles/misc.dir/sign.cpp.o" "gcc" "tests/misc/CMakeFiles/misc.dir/sign.cpp.o.d"
+  "/root/repo/tests/misc/stats.cpp" "tests/misc/CMakeFiles/misc.dir/stats.cpp.o" "gcc" "tests/misc/CMakeFiles/misc.dir/stats.cpp.o.d"
+  "/root/repo/tests/misc/stddev.cpp" "tests/misc/CMakeFiles/misc.dir/stddev.cpp.o" "gcc" "tests/misc/CMakeFiles/misc.dir/stddev.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/control.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/misc.dir/cat.cpp.o"
+  "CMakeFiles/misc.dir/cat.cpp.o.d"
+  "CMakeFiles/misc.dir/constrain.cpp.o"
+  "CMakeFiles/misc.dir/constrain.cpp.o.d"
+  "CMakeFiles/misc.dir/cut.cpp.o"
+  "CMakeFiles/misc.dir/cut.cpp.o.d"
+  "CMakeFiles/misc.dir/insert.cpp.o"
+  "CMakeFiles/misc.dir/insert.cpp.o.d"
+  "CMakeFiles/misc.dir/main.cpp.o"
+  "CMakeFiles/misc.dir/main.cpp.o.d"
+  "CMakeFiles/misc.dir/mean.cpp.o"
+  "CMakeFiles/misc.dir/mean.cpp.o.d"
+  "CMakeFiles/misc.dir/print.cpp.o"
+  "CMakeFiles/misc.dir/print.cpp.o.d"
+  "CMakeFiles/misc.dir/randn.cpp.o"
+  "CMakeFiles/misc.dir/randn.cpp.o.d"
+  "CMakeFiles/misc.dir/rng.cpp.o"
+  "CMakeFiles/misc.dir/rng.cpp.o.d"
+  "CMakeFiles/misc.dir/sign.cpp.o"
+  "CMakeFiles/misc.dir/sign.cpp.o.d"
+  "CMakeFiles/misc.dir/stats.cpp.o"
+  "CMakeFiles/misc.dir/stats.cpp.o.d"
+  "CMakeFiles/misc.dir/stddev.cpp.o"
+  "CMakeFiles/misc.dir/stddev.cpp.o.d"
+  "misc"
+  "misc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/misc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
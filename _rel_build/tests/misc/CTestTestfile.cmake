@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/misc
+# Build directory: /root/repo/_rel_build/tests/misc
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(misc "/root/repo/_rel_build/tests/misc/misc")
+set_tests_properties(misc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;5;add_test;/root/repo/tests/misc/CMakeLists.txt;6;define_test;/root/repo/tests/misc/CMakeLists.txt;0;")
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/model/dc_motor.cpp" "tests/model/CMakeFiles/model.dir/dc_motor.cpp.o" "gcc" "tests/model/CMakeFiles/model.dir/dc_motor.cpp.o.d"
+  "/root/repo/tests/model/main.cpp" "tests/model/CMakeFiles/model.dir/main.cpp.o" "gcc" "tests/model/CMakeFiles/model.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/control.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/model.dir/dc_motor.cpp.o"
+  "CMakeFiles/model.dir/dc_motor.cpp.o.d"
+  "CMakeFiles/model.dir/main.cpp.o"
+  "CMakeFiles/model.dir/main.cpp.o.d"
+  "model"
+  "model.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/model.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
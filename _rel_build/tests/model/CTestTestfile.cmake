@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/model
+# Build directory: /root/repo/_rel_build/tests/model
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(model "/root/repo/_rel_build/tests/model/model")
+set_tests_properties(model PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;5;add_test;/root/repo/tests/model/CMakeLists.txt;6;define_test;/root/repo/tests/model/CMakeLists.txt;0;")
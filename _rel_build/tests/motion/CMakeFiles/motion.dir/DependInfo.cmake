@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/motion/main.cpp" "tests/motion/CMakeFiles/motion.dir/main.cpp.o" "gcc" "tests/motion/CMakeFiles/motion.dir/main.cpp.o.d"
+  "/root/repo/tests/motion/motion_profile.cpp" "tests/motion/CMakeFiles/motion.dir/motion_profile.cpp.o" "gcc" "tests/motion/CMakeFiles/motion.dir/motion_profile.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/control.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/motion.dir/main.cpp.o"
+  "CMakeFiles/motion.dir/main.cpp.o.d"
+  "CMakeFiles/motion.dir/motion_profile.cpp.o"
+  "CMakeFiles/motion.dir/motion_profile.cpp.o.d"
+  "motion"
+  "motion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/motion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
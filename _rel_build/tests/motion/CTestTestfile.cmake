@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/motion
+# Build directory: /root/repo/_rel_build/tests/motion
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(motion "/root/repo/_rel_build/tests/motion/motion")
+set_tests_properties(motion PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;5;add_test;/root/repo/tests/motion/CMakeLists.txt;6;define_test;/root/repo/tests/motion/CMakeLists.txt;0;")
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/motor/clarke.cpp" "tests/motor/CMakeFiles/motor.dir/clarke.cpp.o" "gcc" "tests/motor/CMakeFiles/motor.dir/clarke.cpp.o.d"
+  "/root/repo/tests/motor/main.cpp" "tests/motor/CMakeFiles/motor.dir/main.cpp.o" "gcc" "tests/motor/CMakeFiles/motor.dir/main.cpp.o.d"
+  "/root/repo/tests/motor/park.cpp" "tests/motor/CMakeFiles/motor.dir/park.cpp.o" "gcc" "tests/motor/CMakeFiles/motor.dir/park.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/control.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
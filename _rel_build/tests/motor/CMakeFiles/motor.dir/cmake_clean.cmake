@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/motor.dir/clarke.cpp.o"
+  "CMakeFiles/motor.dir/clarke.cpp.o.d"
+  "CMakeFiles/motor.dir/main.cpp.o"
+  "CMakeFiles/motor.dir/main.cpp.o.d"
+  "CMakeFiles/motor.dir/park.cpp.o"
+  "CMakeFiles/motor.dir/park.cpp.o.d"
+  "motor"
+  "motor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/motor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
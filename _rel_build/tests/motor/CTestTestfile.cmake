@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/motor
+# Build directory: /root/repo/_rel_build/tests/motor
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(motor "/root/repo/_rel_build/tests/motor/motor")
+set_tests_properties(motor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;5;add_test;/root/repo/tests/motor/CMakeLists.txt;6;define_test;/root/repo/tests/motor/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/optimize.dir/linprog.cpp.o"
+  "CMakeFiles/optimize.dir/linprog.cpp.o.d"
+  "CMakeFiles/optimize.dir/main.cpp.o"
+  "CMakeFiles/optimize.dir/main.cpp.o.d"
+  "optimize"
+  "optimize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/optimize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
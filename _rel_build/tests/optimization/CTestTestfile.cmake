@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/optimization
+# Build directory: /root/repo/_rel_build/tests/optimization
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(optimize "/root/repo/_rel_build/tests/optimization/optimize")
+set_tests_properties(optimize PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;5;add_test;/root/repo/tests/optimization/CMakeLists.txt;6;define_test;/root/repo/tests/optimization/CMakeLists.txt;0;")
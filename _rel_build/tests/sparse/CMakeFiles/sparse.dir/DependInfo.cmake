@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/sparse/csc.cpp" "tests/sparse/CMakeFiles/sparse.dir/csc.cpp.o" "gcc" "tests/sparse/CMakeFiles/sparse.dir/csc.cpp.o.d"
+  "/root/repo/tests/sparse/csr.cpp" "tests/sparse/CMakeFiles/sparse.dir/csr.cpp.o" "gcc" "tests/sparse/CMakeFiles/sparse.dir/csr.cpp.o.d"
+  "/root/repo/tests/sparse/ic0.cpp" "tests/sparse/CMakeFiles/sparse.dir/ic0.cpp.o" "gcc" "tests/sparse/CMakeFiles/sparse.dir/ic0.cpp.o.d"
+  "/root/repo/tests/sparse/ilu0.cpp" "tests/sparse/CMakeFiles/sparse.dir/ilu0.cpp.o" "gcc" "tests/sparse/CMakeFiles/sparse.dir/ilu0.cpp.o.d"
+  "/root/repo/tests/sparse/linsolve_triangular.cpp" "tests/sparse/CMakeFiles/sparse.dir/linsolve_triangular.cpp.o" "gcc" "tests/sparse/CMakeFiles/sparse.dir/linsolve_triangular.cpp.o.d"
+  "/root/repo/tests/sparse/main.cpp" "tests/sparse/CMakeFiles/sparse.dir/main.cpp.o" "gcc" "tests/sparse/CMakeFiles/sparse.dir/main.cpp.o.d"
+  "/root/repo/tests/sparse/spmm.cpp" "tests/sparse/CMakeFiles/sparse.dir/spmm.cpp.o" "gcc" "tests/sparse/CMakeFiles/sparse.dir/spmm.cpp.o.d"
+  "/root/repo/tests/sparse/spmv.cpp" "tests/sparse/CMakeFiles/sparse.dir/spmv.cpp.o" "gcc" "tests/sparse/CMakeFiles/sparse.dir/spmv.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/control.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
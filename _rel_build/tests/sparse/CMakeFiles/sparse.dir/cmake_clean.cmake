@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparse.dir/csc.cpp.o"
+  "CMakeFiles/sparse.dir/csc.cpp.o.d"
+  "CMakeFiles/sparse.dir/csr.cpp.o"
+  "CMakeFiles/sparse.dir/csr.cpp.o.d"
+  "CMakeFiles/sparse.dir/ic0.cpp.o"
+  "CMakeFiles/sparse.dir/ic0.cpp.o.d"
+  "CMakeFiles/sparse.dir/ilu0.cpp.o"
+  "CMakeFiles/sparse.dir/ilu0.cpp.o.d"
+  "CMakeFiles/sparse.dir/linsolve_triangular.cpp.o"
+  "CMakeFiles/sparse.dir/linsolve_triangular.cpp.o.d"
+  "CMakeFiles/sparse.dir/main.cpp.o"
+  "CMakeFiles/sparse.dir/main.cpp.o.d"
+  "CMakeFiles/sparse.dir/spmm.cpp.o"
+  "CMakeFiles/sparse.dir/spmm.cpp.o.d"
+  "CMakeFiles/sparse.dir/spmv.cpp.o"
+  "CMakeFiles/sparse.dir/spmv.cpp.o.d"
+  "sparse"
+  "sparse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
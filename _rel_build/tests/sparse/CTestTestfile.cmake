@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/sparse
+# Build directory: /root/repo/_rel_build/tests/sparse
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(sparse "/root/repo/_rel_build/tests/sparse/sparse")
+set_tests_properties(sparse PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;5;add_test;/root/repo/tests/sparse/CMakeLists.txt;6;define_test;/root/repo/tests/sparse/CMakeLists.txt;0;")
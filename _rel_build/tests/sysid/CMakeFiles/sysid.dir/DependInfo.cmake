@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/sysid/main.cpp" "tests/sysid/CMakeFiles/sysid.dir/main.cpp.o" "gcc" "tests/sysid/CMakeFiles/sysid.dir/main.cpp.o.d"
+  "/root/repo/tests/sysid/okid_era.cpp" "tests/sysid/CMakeFiles/sysid.dir/okid_era.cpp.o" "gcc" "tests/sysid/CMakeFiles/sysid.dir/okid_era.cpp.o.d"
+  "/root/repo/tests/sysid/rls.cpp" "tests/sysid/CMakeFiles/sysid.dir/rls.cpp.o" "gcc" "tests/sysid/CMakeFiles/sysid.dir/rls.cpp.o.d"
+  "/root/repo/tests/sysid/sqr_ukf_id.cpp" "tests/sysid/CMakeFiles/sysid.dir/sqr_ukf_id.cpp.o" "gcc" "tests/sysid/CMakeFiles/sysid.dir/sqr_ukf_id.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/CMakeFiles/control.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
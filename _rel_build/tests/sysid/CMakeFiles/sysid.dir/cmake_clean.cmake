@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sysid.dir/main.cpp.o"
+  "CMakeFiles/sysid.dir/main.cpp.o.d"
+  "CMakeFiles/sysid.dir/okid_era.cpp.o"
+  "CMakeFiles/sysid.dir/okid_era.cpp.o.d"
+  "CMakeFiles/sysid.dir/rls.cpp.o"
+  "CMakeFiles/sysid.dir/rls.cpp.o.d"
+  "CMakeFiles/sysid.dir/sqr_ukf_id.cpp.o"
+  "CMakeFiles/sysid.dir/sqr_ukf_id.cpp.o.d"
+  "sysid"
+  "sysid.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sysid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/sysid
+# Build directory: /root/repo/_rel_build/tests/sysid
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(sysid "/root/repo/_rel_build/tests/sysid/sysid")
+set_tests_properties(sysid PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;5;add_test;/root/repo/tests/sysid/CMakeLists.txt;6;define_test;/root/repo/tests/sysid/CMakeLists.txt;0;")
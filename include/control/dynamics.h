@@ -168,3 +168,62 @@ bool is_stable(const float *const A, uint8_t ADIM);
  **/
 void c2d(float *Ad, float *Bd, const float *const A, const float *const B, uint8_t ADIM,
 	 uint8_t RDIM, float sampleTime);
+
+/**
+ * \brief Storage in floats needed by freqresp_init()
+ **/
+#define FREQRESP_STORAGE_SIZE(ADIM, RDIM, YDIM)                                                    \
+	((uint32_t)(ADIM) * ((uint32_t)(ADIM) + (uint32_t)(RDIM) + (uint32_t)(YDIM)))
+
+/**
+ * \brief State space model prepared for frequency response evaluation
+ * \details
+ *   The plan is not modified by freqresp() so several callers can evaluate
+ *   disjoint frequency ranges of the same plan at the same time.
+ **/
+struct freqresp {
+	uint8_t ADIM, RDIM, YDIM;
+	float *H; // Hessenberg form Q'*A*Q [ADIM * ADIM]
+	float *B; // Q'*B [ADIM * RDIM]
+	float *C; // C*Q [YDIM * ADIM]
+};
+
+/**
+ * \brief Prepare a state space model for frequency response evaluation
+ * \details
+ *   A is reduced to upper Hessenberg form with Householder reflections once
+ *   so that every frequency afterwards costs O(ADIM^2) instead of the
+ *   O(ADIM^3) of a full inverse.
+ * \param self Plan to initialize
+ * \param A System matrix [ADIM * ADIM]
+ * \param B Input matrix [ADIM * RDIM]
+ * \param C Output matrix [YDIM * ADIM]
+ * \param ADIM Number of states
+ * \param RDIM Number of inputs
+ * \param YDIM Number of outputs
+ * \param storage Storage [FREQRESP_STORAGE_SIZE(ADIM, RDIM, YDIM)]
+ * \retval 0 Success
+ * \retval -EINVAL A dimension is zero
+ **/
+int freqresp_init(struct freqresp *self, const float *const A, const float *const B,
+		  const float *const C, uint8_t ADIM, uint8_t RDIM, uint8_t YDIM, float *storage);
+/**
+ * \brief Frequency response G = C*(s*I - A)^-1*B at a range of frequencies
+ * \details
+ *   With sample time zero the model is continuous and s = j*w. Otherwise the
+ *   model is discrete and evaluated at z = exp(j*w*sample_time).
+ *
+ *   Results of frequency k are stored at mag[k * YDIM * RDIM] as a row-major
+ *   [YDIM * RDIM] matrix and likewise for phase. To spread the work over
+ *   several cores, call this on disjoint slices of w, mag and phase.
+ *
+ *   When s is an eigenvalue of A the magnitude is INFINITY and the phase 0.
+ * \param self Plan from freqresp_init()
+ * \param mag Output magnitudes |G| [count * YDIM * RDIM]
+ * \param phase Output phases in radians in [-pi, pi] [count * YDIM * RDIM]
+ * \param w Angular frequencies in rad/s [count]
+ * \param count Number of frequencies
+ * \param sample_time Sample time of a discrete model, 0 for a continuous one
+ **/
+void freqresp(const struct freqresp *self, float *mag, float *phase, const float *const w,
+	      uint16_t count, float sample_time);
@@ -0,0 +1,166 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#define FFT_MAX_RADIX 13 // Largest prime factor handled by mixed radix, larger use Bluestein
+#define FFT_MAX_FACTORS 32 // Maximum number of radix stages of a plan
+
+/**
+ * \brief Upper bound of fft_plan_storage_size(n) usable for static allocation
+ **/
+#define FFT_PLAN_STORAGE_SIZE(n) (34 * (uint32_t)(n) + 8)
+/**
+ * \brief Upper bound of fft_real_plan_storage_size(n) usable for static allocation
+ **/
+#define FFT_REAL_PLAN_STORAGE_SIZE(n) (FFT_PLAN_STORAGE_SIZE(n) + 2 * (uint32_t)(n))
+
+/**
+ * \brief Precomputed tables for complex transforms of one length
+ * \details
+ *   Complex data is stored interleaved, x[2*k] is the real and x[2*k + 1]
+ *   the imaginary part of element k. Storage is provided by the caller so no
+ *   memory is allocated and one plan can transform any number of signals one
+ *   after the other. The plan also holds the scratch buffers of a transform,
+ *   so it must not be used by concurrent calls, give every thread its own.
+ *
+ *   Lengths whose prime factors are at most FFT_MAX_RADIX are computed with
+ *   Stockham mixed radix stages, radix 4 and 2 first. Stages keep the
+ *   elements that share a twiddle factor contiguous so the inner loops
+ *   vectorize. Other lengths are computed with Bluestein's algorithm as a
+ *   convolution of power of two length.
+ **/
+struct fft_plan {
+	uint32_t n; // Transform length
+	uint32_t m; // Power of two length of the Bluestein convolution, 0 when unused
+	uint8_t factor_count; // Number of radix stages of n, or of m with Bluestein
+	uint8_t factors[FFT_MAX_FACTORS]; // Radix of every stage
+	float *twiddle; // exp(-2*pi*i*k/n) for k < n, or for k < m with Bluestein
+	float *work; // Stage buffer [2*n], or [2*m] with Bluestein
+	float *chirp; // exp(-pi*i*k^2/n) for k < n with Bluestein
+	float *filter; // Transform of the conjugate chirp [2*m] with Bluestein
+	float *buffer; // Convolution buffer [2*m] with Bluestein
+};
+
+/**
+ * \brief Tables for transforms of real signals of one length
+ * \details
+ *   A real signal of even length n is transformed as a complex signal of
+ *   length n/2 followed by a split step, which halves the work compared to a
+ *   complex transform. Only the bins 0 .. n/2 are stored since the others
+ *   are their complex conjugates. Odd lengths use a complex transform. Like
+ *   struct fft_plan it holds scratch buffers and must not be used by
+ *   concurrent calls.
+ **/
+struct fft_real_plan {
+	uint32_t n; // Signal length
+	struct fft_plan plan; // Complex transform of length n/2, or n when n is odd
+	float *twiddle; // exp(-2*pi*i*k/n) for k < n/2 when n is even
+	float *buffer; // Complex copy of the signal [2*n] when n is odd
+};
+
+/**
+ * \brief Number of floats of storage needed by fft_plan_init()
+ * \param n Transform length
+ * \returns Storage size in floats
+ **/
+uint32_t fft_plan_storage_size(uint32_t n);
+/**
+ * \brief Prepare a plan for complex transforms of length n
+ * \param self Plan to initialize
+ * \param n Transform length
+ * \param storage Table storage [fft_plan_storage_size(n)]
+ * \retval 0 Success
+ * \retval -EINVAL n is zero
+ * \retval -ENOTSUP n has too many factors
+ **/
+int fft_plan_init(struct fft_plan *self, uint32_t n, float *storage);
+/**
+ * \brief Smallest power of two that is at least n
+ * \details
+ *   Use this to pick a transform length for linear convolution of signals
+ *   with lengths a and b, n = a + b - 1.
+ * \param n Required length
+ * \returns Power of two length
+ **/
+uint32_t fft_size(uint32_t n);
+/**
+ * \brief Forward transform X[k] = sum x[j]*exp(-2*pi*i*j*k/n) in place
+ * \param self Plan
+ * \param x Complex data [2*n]
+ **/
+void fft_forward(struct fft_plan *self, float *x);
+/**
+ * \brief Inverse transform x[j] = 1/n * sum X[k]*exp(2*pi*i*j*k/n) in place
+ * \param self Plan
+ * \param x Complex data [2*n]
+ **/
+void fft_inverse(struct fft_plan *self, float *x);
+/**
+ * \brief Forward transform of several signals that share a plan
+ * \param self Plan
+ * \param x Complex signals, signal c starts at x[c*stride]
+ * \param count Number of signals
+ * \param stride Distance between signals in floats, at least 2*n
+ **/
+void fft_forward_batch(struct fft_plan *self, float *x, uint16_t count, uint32_t stride);
+/**
+ * \brief Inverse transform of several signals that share a plan
+ * \param self Plan
+ * \param x Complex signals, signal c starts at x[c*stride]
+ * \param count Number of signals
+ * \param stride Distance between signals in floats, at least 2*n
+ **/
+void fft_inverse_batch(struct fft_plan *self, float *x, uint16_t count, uint32_t stride);
+
+/**
+ * \brief Number of floats of storage needed by fft_real_plan_init()
+ * \param n Signal length
+ * \returns Storage size in floats
+ **/
+uint32_t fft_real_plan_storage_size(uint32_t n);
+/**
+ * \brief Prepare a plan for transforms of real signals of length n
+ * \param self Plan to initialize
+ * \param n Signal length
+ * \param storage Table storage [fft_real_plan_storage_size(n)]
+ * \retval 0 Success
+ * \retval -EINVAL n is zero
+ * \retval -ENOTSUP n has too many factors
+ **/
+int fft_real_plan_init(struct fft_real_plan *self, uint32_t n, float *storage);
+/**
+ * \brief Transform of a real signal, bins 0 .. n/2
+ * \param self Plan
+ * \param X Output complex bins [2*(n/2 + 1)] (can be same as x when large enough)
+ * \param x Input signal [n]
+ **/
+void fft_forward_real(struct fft_real_plan *self, float *X, const float *const x);
+/**
+ * \brief Real signal from its bins 0 .. n/2
+ * \details
+ *   The imaginary parts of bin 0, and of bin n/2 when n is even, are
+ *   ignored since they are zero for a real signal.
+ * \param self Plan
+ * \param x Output signal [n] (can be same as X)
+ * \param X Input complex bins [2*(n/2 + 1)]
+ **/
+void fft_inverse_real(struct fft_real_plan *self, float *x, const float *const X);
+/**
+ * \brief Transform of several real signals that share a plan
+ * \param self Plan
+ * \param X Output bins, signal c starts at X[c*stride_X]
+ * \param x Input signals, signal c starts at x[c*stride_x]
+ * \param count Number of signals
+ * \param stride_X Distance between outputs in floats, at least 2*(n/2 + 1)
+ * \param stride_x Distance between inputs in floats, at least n
+ **/
+void fft_forward_real_batch(struct fft_real_plan *self, float *X, const float *const x,
+			    uint16_t count, uint32_t stride_X, uint32_t stride_x);
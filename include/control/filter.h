@@ -11,6 +11,9 @@
 
 #include <stdint.h>
 
+#include "control/fft.h"
+#include "control/misc.h"
+
 /**
  * \brief Filter an array.
  * \details
@@ -22,9 +25,518 @@
  * \param K gain K > 0, but small number
  **/
 void filtfilt(float *y_out, const float *const y, const float *const t, uint16_t l, float K);
+/**
+ * \brief Moving average over a window of samples
+ * \details
+ *   The running sum is updated in O(1) per sample and recomputed from the
+ *   window every time it wraps, so rounding errors can not accumulate.
+ **/
+struct moving_average {
+	float *buffer; // Last samples [length]
+	uint16_t length; // Window length
+	uint16_t index; // Position of the next sample in buffer
+	uint16_t count; // Number of samples in the window
+	float sum; // Sum of the samples in the window
+};
+
+/**
+ * \brief Initialize a moving average with an empty window
+ * \param self Filter
+ * \param buffer Window storage [length]
+ * \param length Window length
+ * \retval 0 Success
+ * \retval -EINVAL Zero length
+ **/
+int moving_average_init(struct moving_average *self, float *buffer, uint16_t length);
+/**
+ * \brief Empty the window
+ * \param self Filter
+ **/
+void moving_average_reset(struct moving_average *self);
+/**
+ * \brief Add a sample
+ * \param self Filter
+ * \param x Sample
+ * \returns Mean of the samples in the window, fewer than length during start up
+ **/
+float moving_average_step(struct moving_average *self, float x);
+/**
+ * \brief Filter a block of samples
+ * \param self Filter
+ * \param y Output samples [length] (can be same as x)
+ * \param x Input samples [length]
+ * \param length Number of samples
+ **/
+void moving_average_process_block(struct moving_average *self, float *y, const float *const x,
+				  uint32_t length);
+
+/**
+ * \brief First order low pass y += alpha * (x - y)
+ **/
+struct lowpass {
+	float alpha; // Smoothing factor 1 - exp(-2*pi*cutoff/sample_rate)
+	float y; // Output
+};
+
+/**
+ * \brief Initialize a first order low pass with zero output
+ * \param self Filter
+ * \param cutoff Cutoff frequency in Hz
+ * \param sample_rate Sample rate in Hz
+ * \retval 0 Success
+ * \retval -EINVAL Cutoff or sample rate not positive
+ **/
+int lowpass_init(struct lowpass *self, float cutoff, float sample_rate);
+/**
+ * \brief Set the output, for example to the first measurement
+ * \param self Filter
+ * \param y Output
+ **/
+void lowpass_reset(struct lowpass *self, float y);
+/**
+ * \brief Filter one sample
+ * \param self Filter
+ * \param x Sample
+ * \returns Filtered sample
+ **/
+float lowpass_step(struct lowpass *self, float x);
+/**
+ * \brief Filter a block of samples
+ * \param self Filter
+ * \param y Output samples [length] (can be same as x)
+ * \param x Input samples [length]
+ * \param length Number of samples
+ **/
+void lowpass_process_block(struct lowpass *self, float *y, const float *const x, uint32_t length);
+
+/**
+ * \brief Single second order section for sample by sample filtering
+ * \details
+ *   Transposed direct form II with a0 = 1. Coefficients follow the audio EQ
+ *   cookbook by Bristow-Johnson.
+ **/
+struct biquad {
+	float b0, b1, b2, a1, a2; // Coefficients
+	float z1, z2; // State
+};
+
+/**
+ * \brief Initialize a second order low pass with zero state
+ * \param self Filter
+ * \param cutoff Cutoff frequency in Hz
+ * \param q Quality factor, 1/sqrt(2) for a Butterworth response
+ * \param sample_rate Sample rate in Hz
+ * \retval 0 Success
+ * \retval -EINVAL Cutoff outside (0, sample_rate / 2) or q not positive
+ **/
+int biquad_lowpass_init(struct biquad *self, float cutoff, float q, float sample_rate);
+/**
+ * \brief Initialize a notch filter with zero state
+ * \details
+ *   Removes a single frequency such as mains hum or a mechanical resonance
+ *   and has unity gain elsewhere. Larger q gives a narrower notch.
+ * \param self Filter
+ * \param center Frequency to remove in Hz
+ * \param q Quality factor, center frequency divided by the -3 dB bandwidth
+ * \param sample_rate Sample rate in Hz
+ * \retval 0 Success
+ * \retval -EINVAL Center outside (0, sample_rate / 2) or q not positive
+ **/
+int biquad_notch_init(struct biquad *self, float center, float q, float sample_rate);
+/**
+ * \brief Set the state to the steady state of a constant input
+ * \param self Filter
+ * \param x Constant input, 0 clears the state
+ **/
+void biquad_reset(struct biquad *self, float x);
+/**
+ * \brief Filter one sample
+ * \param self Filter
+ * \param x Sample
+ * \returns Filtered sample
+ **/
+float biquad_step(struct biquad *self, float x);
+/**
+ * \brief Filter a block of samples
+ * \param self Filter
+ * \param y Output samples [length] (can be same as x)
+ * \param x Input samples [length]
+ * \param length Number of samples
+ **/
+void biquad_process_block(struct biquad *self, float *y, const float *const x, uint32_t length);
+
+/**
+ * \brief Storage in floats needed by median_filter_init()
+ **/
+#define MEDIAN_FILTER_STORAGE_SIZE(length) (2 * (uint32_t)(length))
+
+/**
+ * \brief Running median over a window of samples
+ * \details
+ *   Removes impulsive outliers that would pull a mean. The window is kept
+ *   sorted next to the ring buffer, so a sample costs one binary search and
+ *   a move of at most length values, which is a handful of cycles for the
+ *   short windows used on sensors.
+ **/
+struct median_filter {
+	float *buffer; // Last samples in arrival order [length]
+	float *sorted; // Samples of the window in ascending order [length]
+	uint16_t length; // Window length
+	uint16_t index; // Position of the next sample in buffer
+	uint16_t count; // Number of samples in the window
+};
+
+/**
+ * \brief Initialize a running median with an empty window
+ * \param self Filter
+ * \param storage Window storage [MEDIAN_FILTER_STORAGE_SIZE(length)]
+ * \param length Window length
+ * \retval 0 Success
+ * \retval -EINVAL Zero length
+ **/
+int median_filter_init(struct median_filter *self, float *storage, uint16_t length);
+/**
+ * \brief Empty the window
+ * \param self Filter
+ **/
+void median_filter_reset(struct median_filter *self);
+/**
+ * \brief Add a sample
+ * \param self Filter
+ * \param x Sample, NaN is dropped and leaves the window unchanged
+ * \returns Median of the window, the mean of the middle two for even counts
+ **/
+float median_filter_step(struct median_filter *self, float x);
+/**
+ * \brief Filter a block of samples
+ * \param self Filter
+ * \param y Output samples [length] (can be same as x)
+ * \param x Input samples [length]
+ * \param length Number of samples
+ **/
+void median_filter_process_block(struct median_filter *self, float *y, const float *const x,
+				 uint32_t length);
+
+#define FIR_DIRECT_TAPS 64 // Longest kernel that fir_block_size() filters directly
+
+/**
+ * \brief FIR filter bank for kernels of any length
+ * \details
+ *   All channels share one kernel and are stored interleaved, sample t of
+ *   channel c is x[t*channels + c]. Output has no latency whatever the
+ *   path.
+ *
+ *   Without a block size every output is a dot product over the whole
+ *   kernel. With a block size B the first B taps are still applied directly
+ *   while the remaining taps are split into partitions of B that are applied
+ *   by uniformly partitioned overlap-save FFT convolution once per B frames.
+ *   Those taps only need input that is at least B frames old, so the FFT
+ *   part never delays the output. Costs are about B + 4*taps/B operations
+ *   per sample instead of taps.
+ **/
+struct fir {
+	uint32_t taps; // Kernel length
+	uint16_t channels; // Number of interleaved channels
+	uint32_t length; // Number of taps applied directly
+	uint32_t block; // Partition length B, 0 when all taps are applied directly
+	uint32_t partitions; // Number of partitions applied with FFT
+	uint32_t position; // Index of the newest sample in the delay lines
+	uint32_t fill; // Frames of the current block already processed
+	uint32_t slot; // Newest spectrum in the frequency delay line
+	float *head; // Directly applied taps reversed [length]
+	float *delay; // Doubled input delay lines [channels][2*length]
+	struct fft_real_plan plan; // Real transform of length 2*B
+	float *kernel; // Spectra of the partitions [partitions][2*(B + 1)]
+	float *spectrum; // Spectra of past input [partitions][channels][2*(B + 1)]
+	float *input; // Last two input blocks [channels][2*B]
+	float *output; // FFT part of the current block [channels][2*(B + 1)]
+};
+
+/**
+ * \brief Partition length that minimizes the work for a kernel
+ * \param taps Kernel length
+ * \returns 0 for kernels up to FIR_DIRECT_TAPS, otherwise a power of two close to 2*sqrt(taps)
+ **/
+uint32_t fir_block_size(uint32_t taps);
+/**
+ * \brief Number of floats of storage needed by fir_init()
+ * \param taps Kernel length
+ * \param channels Number of channels
+ * \param block Partition length, 0 to apply all taps directly
+ * \returns Storage size in floats
+ **/
+uint32_t fir_storage_size(uint32_t taps, uint16_t channels, uint32_t block);
+/**
+ * \brief Initialize a filter bank with zero input history
+ * \details
+ *   Transforms of the kernel partitions are computed here so the kernel
+ *   is not referenced afterwards. A block size of at least taps applies all
+ *   taps directly.
+ * \param self Filter bank
+ * \param h Kernel [taps]
+ * \param taps Kernel length
+ * \param channels Number of channels
+ * \param block Partition length from fir_block_size(), or 0
+ * \param storage Storage [fir_storage_size(taps, channels, block)]
+ * \retval 0 Success
+ * \retval -EINVAL Zero taps or channels
+ * \retval -ENOTSUP Block size not supported by the FFT
+ **/
+int fir_init(struct fir *self, const float *const h, uint32_t taps, uint16_t channels,
+	     uint32_t block, float *storage);
+/**
+ * \brief Clear the input history of all channels
+ * \param self Filter bank
+ **/
+void fir_reset(struct fir *self);
+/**
+ * \brief Filter frames of interleaved samples y[t] = sum h[k]*x[t - k]
+ * \details
+ *   Streams of any length can be passed in pieces of any size, results are
+ *   the same as filtering the whole stream at once.
+ * \param self Filter bank
+ * \param y Output samples [frames*channels] (can be same as x)
+ * \param x Input samples [frames*channels]
+ * \param frames Number of frames
+ **/
+void fir_process(struct fir *self, float *y, const float *const x, uint64_t frames);
+
+/**
+ * \brief Number of second order sections of a filter of given order
+ **/
+#define SOS_SECTIONS(order) (((order) + 1) / 2)
+/**
+ * \brief Number of coefficients of a filter of given order
+ **/
+#define SOS_COEFF_SIZE(order) (5 * SOS_SECTIONS(order))
+/**
+ * \brief Number of state values of a filter bank
+ **/
+#define SOS_STATE_SIZE(sections, channels) (2 * (uint32_t)(sections) * (uint32_t)(channels))
+
+/**
+ * \brief Frequency response type of designed filters
+ **/
+enum sos_response { SOS_LOWPASS, SOS_HIGHPASS };
+
+/**
+ * \brief Cascade of second order sections applied to several channels
+ * \details
+ *   Section k has coefficients coeff[5*k .. 5*k + 4] = {b0, b1, b2, a1, a2}
+ *   with a0 = 1 and is computed in transposed direct form II. Odd order
+ *   filters have a last section with b2 = a2 = 0.
+ *
+ *   Signals are interleaved, sample t of channel c is x[t*channels + c], and
+ *   the state of all channels of one section is contiguous. The inner loop
+ *   runs over channels so it vectorizes when many channels are filtered with
+ *   the same coefficients.
+ **/
+struct sos_filter {
+	uint8_t sections; // Number of second order sections
+	uint16_t channels; // Number of interleaved channels
+	const float *coeff; // Coefficients [sections * 5], kept by reference
+	float *state; // State [SOS_STATE_SIZE(sections, channels)]
+};
+
+/**
+ * \brief Butterworth filter as second order sections
+ * \details
+ *   Analog prototype poles are mapped with the bilinear transform after
+ *   prewarping the cutoff. Every section has unity gain in the pass band.
+ * \param coeff Output coefficients [SOS_COEFF_SIZE(order)]
+ * \param order Filter order
+ * \param response Low pass or high pass
+ * \param cutoff -3 dB frequency in Hz
+ * \param sample_rate Sample rate in Hz
+ * \returns Number of sections
+ * \retval -EINVAL Order zero or cutoff outside (0, sample_rate / 2)
+ **/
+int sos_butterworth(float *coeff, uint8_t order, enum sos_response response, float cutoff,
+		    float sample_rate);
+/**
+ * \brief Chebyshev type I filter as second order sections
+ * \details
+ *   Equiripple in the pass band with a gain between -ripple dB and 0 dB and
+ *   a steeper transition than a Butterworth filter of the same order. The
+ *   gain at the cutoff is -ripple dB.
+ * \param coeff Output coefficients [SOS_COEFF_SIZE(order)]
+ * \param order Filter order
+ * \param response Low pass or high pass
+ * \param ripple Pass band ripple in dB
+ * \param cutoff Pass band edge in Hz
+ * \param sample_rate Sample rate in Hz
+ * \returns Number of sections
+ * \retval -EINVAL Order zero, ripple not positive or cutoff outside (0, sample_rate / 2)
+ **/
+int sos_chebyshev1(float *coeff, uint8_t order, enum sos_response response, float ripple,
+		   float cutoff, float sample_rate);
+/**
+ * \brief Initialize a filter bank with zero state
+ * \param self Filter bank
+ * \param coeff Coefficients [sections * 5], kept by reference
+ * \param sections Number of sections
+ * \param channels Number of interleaved channels
+ * \param state State storage [SOS_STATE_SIZE(sections, channels)]
+ * \retval 0 Success
+ * \retval -EINVAL No sections or no channels
+ **/
+int sos_filter_init(struct sos_filter *self, const float *const coeff, uint8_t sections,
+		    uint16_t channels, float *state);
+/**
+ * \brief Clear the state of all channels
+ * \param self Filter bank
+ **/
+void sos_filter_reset(struct sos_filter *self);
+/**
+ * \brief Filter a block of interleaved samples
+ * \details
+ *   The state is kept between calls so a long signal can be filtered in
+ *   blocks of any size.
+ * \param self Filter bank
+ * \param y Output samples [frames * channels] (can be same as x)
+ * \param x Input samples [frames * channels]
+ * \param frames Number of samples per channel
+ **/
+void sos_filter_process(struct sos_filter *self, float *y, const float *const x, uint64_t frames);
+/**
+ * \brief Zero phase filtering of interleaved signals
+ * \details
+ *   The signal is filtered forward and then backward, which squares the
+ *   magnitude response and cancels the phase. As in MATLAB filtfilt, both
+ *   ends are extended by odd reflection of 3 * (2 * sections + 1) samples and
+ *   the state starts in steady state for the edge value, so there is no
+ *   start up transient. The backward pass reads the buffer in reverse
+ *   without flipping it and only the reflections are buffered, so signals of
+ *   any length are filtered in place. The state is cleared afterwards.
+ * \param self Filter bank
+ * \param y Output samples [frames * channels] (can be same as x)
+ * \param x Input samples [frames * channels]
+ * \param frames Number of samples per channel
+ **/
+void sos_filtfilt(struct sos_filter *self, float *y, const float *const x, uint64_t frames);
 void mcs_collect(float P[], uint16_t column_p, float x[], uint8_t row_x, float index_factor);
 void mcs_estimate(float P[], uint16_t column_p, float x[], uint8_t row_x);
 void mcs_clean(float P[], uint16_t column_p, uint8_t row_x);
+
+/**
+ * \brief Storage in counters needed by mcs_histogram_init()
+ **/
+#define MCS_HISTOGRAM_STORAGE_SIZE(row_x, bins) ((uint32_t)(row_x) * ((uint32_t)(bins) + 2))
+
+/**
+ * \brief Integer histograms of the variables of a Monte Carlo study
+ * \details
+ *   Variable i is binned uniformly over [low[i], high[i]). Samples outside
+ *   the range are counted in an underflow and an overflow bin so quantiles
+ *   stay correct, NaN samples are ignored. Counters are 32 bit integers so a
+ *   histogram holds up to 4294967295 samples per bin.
+ **/
+struct mcs_histogram {
+	uint8_t row_x; // Number of variables
+	uint16_t bins; // Bins per variable inside the range
+	const float *low; // Lower range limit of every variable [row_x]
+	const float *high; // Upper range limit of every variable [row_x]
+	uint32_t *count; // Underflow, bins and overflow of every variable [row_x * (bins + 2)]
+};
+
+/**
+ * \brief Simulation of one Monte Carlo sample for mcs_run()
+ * \details
+ *   The random stream is private to the sample and derived from the seed and
+ *   the sample index, so a sample gives the same result on any thread.
+ * \param x Output variables of the sample [row_x]
+ * \param sample Index of the sample
+ * \param rng Random stream of the sample
+ * \param ctx User context
+ **/
+typedef void (*mcs_simulation_t)(float *x, uint64_t sample, struct rng *rng, void *ctx);
+
+/**
+ * \brief Initialize an empty histogram
+ * \param self Histogram to initialize
+ * \param row_x Number of variables
+ * \param bins Bins per variable
+ * \param low Lower range limit of every variable [row_x], kept by reference
+ * \param high Upper range limit of every variable [row_x], kept by reference
+ * \param storage Counters [MCS_HISTOGRAM_STORAGE_SIZE(row_x, bins)]
+ * \retval 0 Success
+ * \retval -EINVAL Empty histogram or a range with high <= low
+ **/
+int mcs_histogram_init(struct mcs_histogram *self, uint8_t row_x, uint16_t bins,
+		       const float *const low, const float *const high, uint32_t *storage);
+/**
+ * \brief Count one sample
+ * \param self Histogram
+ * \param x Variables of the sample [row_x]
+ **/
+void mcs_histogram_collect(struct mcs_histogram *self, const float *const x);
+/**
+ * \brief Add the counts of another histogram
+ * \details
+ *   Integer addition makes the result independent of the merge order.
+ * \param self Histogram to add to
+ * \param other Histogram with the same variables, bins and ranges
+ * \retval 0 Success
+ * \retval -EINVAL The histograms have different shapes
+ **/
+int mcs_histogram_merge(struct mcs_histogram *self, const struct mcs_histogram *other);
+/**
+ * \brief Number of samples counted for a variable
+ * \param self Histogram
+ * \param variable Variable index
+ * \returns Number of samples, including those outside the range
+ **/
+uint64_t mcs_histogram_total(const struct mcs_histogram *self, uint8_t variable);
+/**
+ * \brief Most frequent value of a variable
+ * \param self Histogram
+ * \param variable Variable index
+ * \returns Center of the fullest bin inside the range, NaN when it is empty
+ **/
+float mcs_histogram_mode(const struct mcs_histogram *self, uint8_t variable);
+/**
+ * \brief Quantile of a variable
+ * \details
+ *   Interpolates linearly inside the bin, so the error is at most one bin
+ *   width. Quantiles that fall outside the range are clamped to it.
+ * \param self Histogram
+ * \param variable Variable index
+ * \param p Probability in [0, 1], 0.5 for the median
+ * \returns Quantile, NaN when there are no samples
+ **/
+float mcs_histogram_quantile(const struct mcs_histogram *self, uint8_t variable, float p);
+/**
+ * \brief Confidence bounds of a quantile
+ * \details
+ *   Distribution free bounds from the ranks n*p -+ z*sqrt(n*p*(1 - p)) of the
+ *   order statistics, the normal approximation of the binomial distribution.
+ *   z = 1.96 gives 95 % confidence.
+ * \param self Histogram
+ * \param variable Variable index
+ * \param p Probability in [0, 1]
+ * \param z Number of standard deviations of the bounds
+ * \param lower Output lower bound
+ * \param upper Output upper bound
+ **/
+void mcs_histogram_quantile_bounds(const struct mcs_histogram *self, uint8_t variable, float p,
+				   float z, float *lower, float *upper);
+/**
+ * \brief Run a range of Monte Carlo samples into a histogram
+ * \details
+ *   Simulates samples first .. first + count - 1. To spread a study over
+ *   several threads or cores, give each one its own histogram and a disjoint
+ *   range, then combine them with mcs_histogram_merge(). Since every sample
+ *   has its own random stream the merged result does not depend on the
+ *   split.
+ * \param self Histogram to collect into
+ * \param simulate Simulation of one sample, called with ctx
+ * \param ctx User context
+ * \param seed Seed of the study
+ * \param first Index of the first sample
+ * \param count Number of samples
+ **/
+void mcs_run(struct mcs_histogram *self, mcs_simulation_t simulate, void *ctx, uint64_t seed,
+	     uint64_t first, uint64_t count);
 /**
  * \brief Square Root Unscented Kalman Filter
  * \details For State Estimation (A better version than regular UKF)
@@ -46,3 +558,364 @@ void mcs_clean(float P[], uint16_t column_p, uint8_t row_x);
  **/
 int sqr_ukf(float y[], float xhat[], float Rn[], float Rv[], float u[],
 	    void (*F)(float[], float[], float[]), float S[], float alpha, float beta, uint8_t L);
+/**
+ * \brief Transition function of a batch of sigma points for sqr_ukf_batch()
+ * \details
+ *   Sigma point j is the contiguous vector X[j*L .. j*L + L - 1] and its
+ *   next state goes to dX[j*L .. j*L + L - 1]. Points are independent, so a
+ *   model can vectorize across them or hand ranges of j to worker threads.
+ * \param dX Next states [count * L]
+ * \param X Sigma points [count * L]
+ * \param u Input signal [L]
+ * \param count Number of sigma points
+ * \param L Number of states
+ * \param ctx User context
+ **/
+typedef void (*sqr_ukf_transition_t)(float *dX, const float *const X, const float *const u,
+				     uint16_t count, uint8_t L, void *ctx);
+/**
+ * \brief Square Root Unscented Kalman Filter with a batched transition function
+ * \details
+ *   Same as sqr_ukf() but F is called once per step with all 2*L + 1 sigma
+ *   points instead of once per sigma point.
+ * \param y [L] Measurement state (our output)
+ * \param xhat [L] Estimated state (our input)
+ * \param Rn [L * L] Measurement noise covariance matrix
+ * \param Rv [L * L] Process noise covariance matrix
+ * \param u [L] Input signal
+ * \param F Transition function of all sigma points
+ * \param ctx User context passed to F
+ * \param S [L * L] State estimate error covariance
+ * \param alpha Spread of the sigma points around xhat, 0.01 <= alpha <= 1
+ * \param beta Prior knowledge of the distribution of x, 2 for Gaussian
+ * \param L Number of states
+ * \retval 0 Success
+ * \retval -EINVAL Invalid parameters
+ **/
+int sqr_ukf_batch(float y[], float xhat[], float Rn[], float Rv[], const float *const u,
+		  sqr_ukf_transition_t F, void *ctx, float S[], float alpha, float beta, uint8_t L);
+
+/**
+ * \brief Measurement function of a batch of sigma points for struct sqr_ukf_filter
+ * \details
+ *   Sigma point j is the contiguous vector X[j*L .. j*L + L - 1] and its
+ *   predicted measurement goes to Y[j*M .. j*M + M - 1].
+ * \param Y Predicted measurements [count * M]
+ * \param X Sigma points [count * L]
+ * \param count Number of sigma points
+ * \param L Number of states
+ * \param M Number of measurements
+ * \param ctx User context
+ **/
+typedef void (*sqr_ukf_measurement_t)(float *Y, const float *const X, uint16_t count, uint8_t L,
+				      uint8_t M, void *ctx);
+
+/**
+ * \brief Storage in floats needed by sqr_ukf_filter_init()
+ **/
+#define SQR_UKF_FILTER_STORAGE_SIZE(L, M)                                                         \
+	((uint32_t)(2 * (2 * (L) + 1) + (L) + (L) * (L) + 2 * (2 * (L) + 1) * (L) +               \
+		    (2 * (L) + 1) * (M) + 3 * (L) * (L) + (2 * (L) + (M)) * (M) + (M) * (M) +     \
+		    (L) * (M) + (M) + (L) + (M)))
+
+/**
+ * \brief Square Root Unscented Kalman Filter with persistent state and workspace
+ * \details
+ *   Weights and the sigma point spread depend only on the tuning and are
+ *   computed once by sqr_ukf_filter_init(). All matrices live in caller
+ *   provided storage so a step does not allocate anything. Sigma points
+ *   are stored one after the other so they are passed to the models without
+ *   copying.
+ *
+ *   Covariances are carried as upper triangular square roots, P = S'*S.
+ *   Square roots are updated by Householder triangularization without
+ *   forming Q, followed by rank one updates.
+ **/
+struct sqr_ukf_filter {
+	uint8_t L; // Number of states
+	uint8_t M; // Number of measurements
+	float gamma; // Sigma point spread sqrt(L + lambda)
+	float *Wm; // Mean weights [2*L + 1]
+	float *Wc; // Covariance weights [2*L + 1]
+	float *x; // State estimate [L]
+	float *S; // Square root of the state covariance [L * L]
+	const float *Sv; // Square root of the process noise covariance [L * L]
+	const float *Sn; // Square root of the measurement noise covariance [M * M]
+	sqr_ukf_transition_t F; // Transition function
+	void *F_ctx; // Context of F
+	sqr_ukf_measurement_t H; // Measurement function, NULL when y = x
+	void *H_ctx; // Context of H
+	float *X; // Sigma points [(2*L + 1) * L]
+	float *Xs; // Propagated sigma points [(2*L + 1) * L]
+	float *Y; // Predicted measurements [(2*L + 1) * M]
+	float *A; // Triangularization workspace [3*L * L + (2*L + M) * M]
+	float *Sy; // Square root of the innovation covariance [M * M]
+	float *K; // Cross covariance, then Kalman gain [L * M]
+	float *yhat; // Predicted measurement [M]
+	float *v; // Vector workspace [L + M]
+};
+
+/**
+ * \brief Initialize a filter with zero state and identity covariance
+ * \param self Filter
+ * \param F Transition function of all sigma points
+ * \param F_ctx Context passed to F
+ * \param H Measurement function of all sigma points, NULL to measure the state directly
+ * \param H_ctx Context passed to H
+ * \param L Number of states
+ * \param M Number of measurements, equal to L when H is NULL
+ * \param alpha Spread of the sigma points, 0.01 <= alpha <= 1
+ * \param beta Prior knowledge of the distribution, 2 for Gaussian
+ * \param kappa Secondary scaling, 0 for state estimation
+ * \param Sv [L * L] Upper triangular square root of the process noise covariance, kept by reference
+ * \param Sn [M * M] Upper triangular square root of the measurement noise covariance, kept by reference
+ * \param storage Storage [SQR_UKF_FILTER_STORAGE_SIZE(L, M)]
+ * \retval 0 Success
+ * \retval -EINVAL Zero dimensions, no F, M not equal to L without H, or L + lambda not positive
+ **/
+int sqr_ukf_filter_init(struct sqr_ukf_filter *self, sqr_ukf_transition_t F, void *F_ctx,
+			sqr_ukf_measurement_t H, void *H_ctx, uint8_t L, uint8_t M, float alpha,
+			float beta, float kappa, const float *const Sv, const float *const Sn,
+			float *storage);
+/**
+ * \brief Set the state estimate and the square root of its covariance
+ * \param self Filter
+ * \param x [L] State estimate
+ * \param S [L * L] Upper triangular square root of the state covariance
+ **/
+void sqr_ukf_filter_reset(struct sqr_ukf_filter *self, const float *const x,
+			  const float *const S);
+/**
+ * \brief Predict with the transition function and correct with a measurement
+ * \details
+ *   The result is in self->x and self->S. On error they must be reset.
+ * \param self Filter
+ * \param y [M] Measurement
+ * \param u Input signal passed to the transition function
+ * \retval 0 Success
+ * \retval -ENOTSUP Covariance lost positive definiteness
+ **/
+int sqr_ukf_filter_step(struct sqr_ukf_filter *self, const float *const y, const float *const u);
+
+/**
+ * \brief Transition function of all sigma points of a bank of filters
+ * \details
+ *   Element i of sigma point j of filter b is X[(j*L + i)*count + b], so
+ *   a loop over b is contiguous and vectorizes.
+ * \param dX Next states [points * L * count]
+ * \param X Sigma points [points * L * count]
+ * \param u Input signals as passed to sqr_ukf_bank_step()
+ * \param points Number of sigma points of each filter
+ * \param L Number of states
+ * \param count Number of filters
+ * \param ctx User context
+ **/
+typedef void (*sqr_ukf_bank_transition_t)(float *dX, const float *const X, const float *const u,
+					  uint16_t points, uint8_t L, uint16_t count, void *ctx);
+/**
+ * \brief Measurement function of all sigma points of a bank of filters
+ * \param Y Predicted measurements [points * M * count], element k at Y[(j*M + k)*count + b]
+ * \param X Sigma points [points * L * count]
+ * \param points Number of sigma points of each filter
+ * \param L Number of states
+ * \param M Number of measurements
+ * \param count Number of filters
+ * \param ctx User context
+ **/
+typedef void (*sqr_ukf_bank_measurement_t)(float *Y, const float *const X, uint16_t points,
+					   uint8_t L, uint8_t M, uint16_t count, void *ctx);
+
+/**
+ * \brief Storage in floats needed by sqr_ukf_bank_init()
+ **/
+#define SQR_UKF_BANK_STORAGE_SIZE(L, M, count)                                                    \
+	((uint32_t)(2 * (2 * (L) + 1) +                                                           \
+		    (count) * ((L) + (L) * (L) + 2 * (2 * (L) + 1) * (L) + (2 * (L) + 1) * (M) +  \
+			       3 * (L) * (L) + (2 * (L) + (M)) * (M) + (M) * (M) + (L) * (M) +    \
+			       (M) + (L) + (M) + 4)))
+
+/**
+ * \brief Bank of square root unscented Kalman filters with the same model structure
+ * \details
+ *   Works like struct sqr_ukf_filter for count filters at once. Every
+ *   vector and matrix is stored as structure of arrays, element i of filter
+ *   b is at x[i*count + b], so the same operation on all filters is one
+ *   contiguous loop that the compiler vectorizes. The models are called
+ *   once per step for the whole bank. Tuning and noise are shared.
+ **/
+struct sqr_ukf_bank {
+	uint8_t L; // Number of states
+	uint8_t M; // Number of measurements
+	uint16_t count; // Number of filters
+	float gamma; // Sigma point spread sqrt(L + lambda)
+	float *Wm; // Mean weights [2*L + 1]
+	float *Wc; // Covariance weights [2*L + 1]
+	float *x; // State estimates [L * count]
+	float *S; // Square roots of the state covariances, P = S'*S [L * L * count]
+	const float *Sv; // Square root of the process noise covariance [L * L]
+	const float *Sn; // Square root of the measurement noise covariance [M * M]
+	sqr_ukf_bank_transition_t F; // Transition function
+	void *F_ctx; // Context of F
+	sqr_ukf_bank_measurement_t H; // Measurement function, NULL when y = x
+	void *H_ctx; // Context of H
+	float *X; // Sigma points [(2*L + 1) * L * count]
+	float *Xs; // Propagated sigma points [(2*L + 1) * L * count]
+	float *Y; // Predicted measurements [(2*L + 1) * M * count]
+	float *A; // Triangularization workspace [(3*L * L + (2*L + M) * M) * count]
+	float *Sy; // Square roots of the innovation covariances [M * M * count]
+	float *K; // Cross covariances, then Kalman gains [L * M * count]
+	float *yhat; // Predicted measurements [M * count]
+	float *v; // Vector workspace [(L + M) * count]
+	float *t; // Scalar workspace [4 * count]
+};
+
+/**
+ * \brief Initialize a bank with zero states and identity covariances
+ * \param self Bank
+ * \param F Transition function of all filters
+ * \param F_ctx Context passed to F
+ * \param H Measurement function of all filters, NULL to measure the states directly
+ * \param H_ctx Context passed to H
+ * \param L Number of states
+ * \param M Number of measurements, equal to L when H is NULL
+ * \param count Number of filters
+ * \param alpha Spread of the sigma points, 0.01 <= alpha <= 1
+ * \param beta Prior knowledge of the distribution, 2 for Gaussian
+ * \param kappa Secondary scaling, 0 for state estimation
+ * \param Sv [L * L] Upper triangular square root of the process noise covariance, kept by reference
+ * \param Sn [M * M] Upper triangular square root of the measurement noise covariance, kept by reference
+ * \param storage Storage [SQR_UKF_BANK_STORAGE_SIZE(L, M, count)]
+ * \retval 0 Success
+ * \retval -EINVAL Zero dimensions, no F, M not equal to L without H, or L + lambda not positive
+ **/
+int sqr_ukf_bank_init(struct sqr_ukf_bank *self, sqr_ukf_bank_transition_t F, void *F_ctx,
+		      sqr_ukf_bank_measurement_t H, void *H_ctx, uint8_t L, uint8_t M,
+		      uint16_t count, float alpha, float beta, float kappa, const float *const Sv,
+		      const float *const Sn, float *storage);
+/**
+ * \brief Set the state estimate and covariance square root of one filter
+ * \param self Bank
+ * \param index Filter to set
+ * \param x [L] State estimate
+ * \param S [L * L] Upper triangular square root of the state covariance
+ **/
+void sqr_ukf_bank_reset(struct sqr_ukf_bank *self, uint16_t index, const float *const x,
+			const float *const S);
+/**
+ * \brief Step all filters of the bank
+ * \details
+ *   The results are in self->x and self->S. A filter whose covariance
+ *   lost positive definiteness is left with non finite values and must be
+ *   reset, the others are not affected.
+ * \param self Bank
+ * \param y [M * count] Measurements, element k of filter b at y[k*count + b]
+ * \param u Input signals passed to the transition function
+ * \retval 0 Success
+ * \retval -ENOTSUP Covariance of at least one filter lost positive definiteness
+ **/
+int sqr_ukf_bank_step(struct sqr_ukf_bank *self, const float *const y, const float *const u);
+
+/**
+ * \brief Jacobian of a model at one point for struct ekf
+ * \param J Jacobian [rows * L], rows is L for the transition and M for the measurement
+ * \param x State [L]
+ * \param u Input signal, NULL for the measurement
+ * \param ctx Context of the model
+ **/
+typedef void (*ekf_jacobian_t)(float *J, const float *const x, const float *const u, void *ctx);
+
+/**
+ * \brief Storage in floats needed by ekf_init()
+ **/
+#define EKF_STORAGE_SIZE(L, M)                                                                    \
+	((uint32_t)(4 * (L) + 4 * (L) * (L) + 2 * ((L) + 1) * (L) + ((L) + 1) * (M) + (M) * (L)))
+
+/**
+ * \brief Extended Kalman filter, optionally iterated
+ * \details
+ *   Models use the batched callbacks of struct sqr_ukf_filter. Without
+ *   analytic Jacobians the model and its forward difference Jacobian come
+ *   from one call with L + 1 points, the state and the state with each
+ *   element perturbed.
+ *
+ *   Measurement noise is diagonal so measurements are applied one at a
+ *   time as scalar updates, which needs no matrix inverse. Every update uses
+ *   the Joseph form, which keeps P symmetric and positive semi definite in
+ *   float. With more than one iteration the measurement model is
+ *   linearized again around the updated state, which helps when it is
+ *   strongly nonlinear.
+ **/
+struct ekf {
+	uint8_t L; // Number of states
+	uint8_t M; // Number of measurements
+	uint8_t iterations; // Measurement linearizations per update, 1 for a plain EKF
+	float step; // Relative finite difference step
+	float *x; // State estimate [L]
+	float *P; // State covariance [L * L]
+	const float *Q; // Process noise covariance [L * L]
+	const float *R; // Measurement noise variances [M]
+	sqr_ukf_transition_t F; // Transition function
+	void *F_ctx; // Context of F and JF
+	sqr_ukf_measurement_t H; // Measurement function
+	void *H_ctx; // Context of H and JH
+	ekf_jacobian_t JF; // Jacobian of F, NULL for finite differences
+	ekf_jacobian_t JH; // Jacobian of H, NULL for finite differences
+	float *prior; // Predicted covariance kept between iterations [L * L]
+	float *J; // Jacobian of F [L * L]
+	float *T; // Product workspace [L * L]
+	float *X; // Points of the finite differences [(L + 1) * L]
+	float *Z; // Transition of the points, Joseph form workspace [(L + 1) * L]
+	float *Y; // Measurement of the points [(L + 1) * M]
+	float *Hj; // Jacobian of H [M * L]
+	float *xp; // Predicted state [L]
+	float *xi; // Linearization point of the measurement [L]
+	float *k; // Gain of one scalar measurement [L]
+};
+
+/**
+ * \brief Initialize a filter with zero state and identity covariance
+ * \param self Filter
+ * \param F Transition function
+ * \param F_ctx Context passed to F
+ * \param H Measurement function
+ * \param H_ctx Context passed to H
+ * \param L Number of states
+ * \param M Number of measurements
+ * \param iterations Measurement linearizations per update, 1 for a plain EKF
+ * \param Q [L * L] Process noise covariance, kept by reference
+ * \param R [M] Measurement noise variances, kept by reference
+ * \param storage Storage [EKF_STORAGE_SIZE(L, M)]
+ * \retval 0 Success
+ * \retval -EINVAL Zero dimensions or iterations, or no F or H
+ **/
+int ekf_init(struct ekf *self, sqr_ukf_transition_t F, void *F_ctx, sqr_ukf_measurement_t H,
+	     void *H_ctx, uint8_t L, uint8_t M, uint8_t iterations, const float *const Q,
+	     const float *const R, float *storage);
+/**
+ * \brief Use analytic Jacobians instead of finite differences
+ * \param self Filter
+ * \param JF Jacobian of F called with F_ctx, NULL for finite differences
+ * \param JH Jacobian of H called with H_ctx, NULL for finite differences
+ **/
+void ekf_set_jacobians(struct ekf *self, ekf_jacobian_t JF, ekf_jacobian_t JH);
+/**
+ * \brief Set the state estimate and its covariance
+ * \param self Filter
+ * \param x [L] State estimate
+ * \param P [L * L] State covariance
+ **/
+void ekf_reset(struct ekf *self, const float *const x, const float *const P);
+/**
+ * \brief Propagate the state and covariance, P = J*P*J' + Q
+ * \param self Filter
+ * \param u Input signal passed to F
+ **/
+void ekf_predict(struct ekf *self, const float *const u);
+/**
+ * \brief Correct the state and covariance with a measurement
+ * \param self Filter
+ * \param y [M] Measurement
+ * \retval 0 Success
+ * \retval -ENOTSUP Innovation variance of a measurement is not positive, x and P keep the prediction
+ **/
+int ekf_update(struct ekf *self, const float *const y);
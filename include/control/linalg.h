@@ -12,12 +12,164 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#define MAX_ITERATION_COUNT_SVD 30 // Maximum number of iterations for svd_jacobi_one_sided.c
+#include "control/fft.h"
+
+#define MAX_ITERATION_COUNT_SVD 30 // Maximum number of sweeps for svd_jacobi.c
+#define EIG_FRANCIS_AED_MIN_ROW 24 // Smallest matrix for aggressive early deflation in eig_francis.c
+#define EIG_FRANCIS_WORK_SIZE(row) (2 * (row) * (row) + 5 * (row)) // Workspace for eig_francis()
+#define LINSOLVE_GMRES_RESTART 30 // Default Krylov basis size for linsolve_gmres.c
+#define LINSOLVE_GMRES_BASIS(restart) ((uint32_t)((restart) ? (restart) : LINSOLVE_GMRES_RESTART))
+/**
+ * \brief Workspace in floats for linsolve_gmres(), restart as in struct linsolve_options
+ **/
+#define LINSOLVE_GMRES_WORK_SIZE(row, restart)                                                    \
+	((LINSOLVE_GMRES_BASIS(restart) + 1) *                                                    \
+		 ((uint32_t)(row) + LINSOLVE_GMRES_BASIS(restart) + 4) +                          \
+	 3 * (uint32_t)(row))
+#define NORM2_TOLERANCE 1e-6f // Relative change that stops norm2_estimate() inside norm()
+#define NORM2_MAX_ITERATIONS 100 // Iteration limit of norm2_estimate() inside norm()
+#define LINSOLVE_MARKOV_FFT_MIN_COLUMN 64 // Shorter blocks use substitution in linsolve_markov.c
+/**
+ * \brief Workspace in floats for linsolve_markov_regularized() of records with column samples
+ * \details Transforms are at most 4*column long
+ **/
+#define LINSOLVE_MARKOV_REGULARIZED_WORK_SIZE(column) (20 * (uint32_t)(column) + 4)
+/**
+ * \brief Workspace in floats for linsolve_markov_mimo()
+ * \details Transforms are at most 2*(column + lags) long
+ **/
+#define LINSOLVE_MARKOV_MIMO_WORK_SIZE(inputs, column, lags)                                      \
+	(((uint32_t)(inputs) + 5) * 2 * ((uint32_t)(column) + (lags)) + 2 * (uint32_t)(inputs) + 4)
+#define NONLINSOLVE_ITERATIONS 20000 // Random guesses and gradient steps of nonlinsolve()
+#define NONLINSOLVE_LM_LAMBDA 1e-3f // Damping of nonlinsolve_lm() after a failed Gauss-Newton step
 
 #if !defined(CONSTRAIN_FLOAT)
 #define CONSTRAIN_FLOAT(n, low, high) (((n) > (high)) ? (high) : (((n) < (low)) ? (low) : (n)))
 #endif
 
+/**
+ * \brief Strided view of a row-major matrix
+ * \details
+ *   Element (i, j) is data[ld * i + j]. A dense matrix has ld == cols while a
+ *   view of a sub block keeps the leading dimension of its parent, so blocks
+ *   can be read and updated in place without copying them out first.
+ **/
+struct mat_view {
+	float *data; // First element of the view
+	uint32_t rows; // Number of rows
+	uint32_t cols; // Number of columns
+	uint32_t ld; // Distance between the starts of two rows (ld >= cols)
+};
+
+/**
+ * \brief View a dense row-major matrix
+ * \param data Matrix [rows*cols]
+ * \param rows Number of rows
+ * \param cols Number of columns
+ * \returns View with ld == cols
+ **/
+struct mat_view mat_view_init(float *data, uint32_t rows, uint32_t cols);
+/**
+ * \brief View a sub block of another view without copying
+ * \details
+ *   The block is clamped to the parent so an out of range request gives an
+ *   empty or smaller view.
+ * \param parent View to take the block from
+ * \param row First row of the block in parent
+ * \param col First column of the block in parent
+ * \param rows Number of rows in the block
+ * \param cols Number of columns in the block
+ * \returns View sharing data with parent
+ **/
+struct mat_view mat_view_block(struct mat_view parent, uint32_t row, uint32_t col, uint32_t rows,
+			       uint32_t cols);
+/**
+ * \brief Copy the elements of one view into another
+ * \details
+ *   B = A
+ *
+ *   The views must not overlap.
+ * \param B Output view
+ * \param A Input view
+ * \retval 0 Success
+ * \retval -EINVAL Dimensions do not match
+ **/
+int copy_view(struct mat_view B, const struct mat_view A);
+/**
+ * \brief Element-wise addition of two views
+ * \details
+ *   C = A + B
+ *
+ *   C may be the same view as A or B.
+ * \param C Output view
+ * \param A Input view
+ * \param B Input view
+ * \retval 0 Success
+ * \retval -EINVAL Dimensions do not match
+ **/
+int add_view(struct mat_view C, const struct mat_view A, const struct mat_view B);
+/**
+ * \brief Matrix multiplication of two views
+ * \details
+ *   C = A * B
+ *
+ *   C must not overlap A or B. Rows of B and C are traversed contiguously.
+ * \param C Output view [rows(A)*cols(B)]
+ * \param A Input view
+ * \param B Input view
+ * \retval 0 Success
+ * \retval -EINVAL Dimensions do not match
+ **/
+int mul_view(struct mat_view C, const struct mat_view A, const struct mat_view B);
+/**
+ * \brief Transpose of a view
+ * \details
+ *   At = A'
+ *
+ *   At must not overlap A.
+ * \param At Output view [cols(A)*rows(A)]
+ * \param A Input view
+ * \retval 0 Success
+ * \retval -EINVAL Dimensions do not match
+ **/
+int tran_view(struct mat_view At, const struct mat_view A);
+/**
+ * \brief Solve AX = B where A is an upper triangular view
+ * \details
+ *   A [n*n]
+ *
+ *   X [n*k]
+ *
+ *   B [n*k]
+ *
+ *   X may be the same view as B.
+ * \param X Output view
+ * \param A Upper triangular input view
+ * \param B Right hand sides
+ * \retval 0 Success
+ * \retval -EINVAL Dimensions do not match
+ **/
+int linsolve_upper_triangular_view(struct mat_view X, const struct mat_view A,
+				   const struct mat_view B);
+/**
+ * \brief Solve AX = B where A is a lower triangular view
+ * \details
+ *   A [n*n]
+ *
+ *   X [n*k]
+ *
+ *   B [n*k]
+ *
+ *   X may be the same view as B.
+ * \param X Output view
+ * \param A Lower triangular input view
+ * \param B Right hand sides
+ * \retval 0 Success
+ * \retval -EINVAL Dimensions do not match
+ **/
+int linsolve_lower_triangular_view(struct mat_view X, const struct mat_view A,
+				   const struct mat_view B);
+
 /**
  * \brief Element-wise addition of two matrices
  * \details
@@ -101,9 +253,10 @@ int mul(float *C, const float *const A, const float *const B, uint16_t row_a, ui
  *
  *   http://www.netlib.org/lapack/lawnspdf/lawn15.pdf
  *
- *   Use this SVD method if you have a square matrix A.
+ *   Use this SVD method if you have a square matrix A. It is svd_jacobi()
+ *   with row == column.
  *
- *   A [m*n] // This will be set to U
+ *   A [m*n]
  *
  *   U [m*m]
  *
@@ -114,13 +267,89 @@ int mul(float *C, const float *const A, const float *const B, uint16_t row_a, ui
  *   n == m
  * \param A Input matrix [m*n]
  * \param row Number of rows in A
- * \param max_iterations Maximum number of iterations (10 is a good start)
+ * \param max_iterations Maximum number of sweeps (10 is a good start)
  * \param U Output U matrix [m*m]
  * \param S Output S diagonal vector [n]
  * \param V Output V matrix [n*n]
  **/
 void svd_jacobi_one_sided(const float *const A, uint16_t row, uint8_t max_iterations, float *U,
 			  float *S, float *V);
+/**
+ * \brief Singular Value Decomposition A = USV^T with one-sided Jacobi (Economy mode)
+ * \details
+ *   Tall matrices are first reduced to R [n*n] with a Householder QR and
+ *   wide matrices are handled through A'. Column pairs are visited in
+ *   round-robin order so that the n/2 rotations of every round touch
+ *   disjoint columns and can be applied in any order. Iteration stops as
+ *   soon as a full sweep needs no rotation.
+ *
+ *   Columns are kept contiguous while rotating, which lets the compiler
+ *   vectorize the inner loops.
+ *
+ *   A [m*n]
+ *
+ *   U [m*k]
+ *
+ *   S [k]
+ *
+ *   V [n*k]
+ *
+ *   k = min(m, n)
+ * \param A Input matrix [m*n]
+ * \param row Number of rows in A (m)
+ * \param column Number of columns in A (n)
+ * \param max_sweeps Maximum number of sweeps (MAX_ITERATION_COUNT_SVD is a good start)
+ * \param U Output U matrix [m*k]
+ * \param S Output S diagonal vector [k] sorted largest to smallest
+ * \param V Output V matrix [n*k]
+ * \retval 0 Success
+ * \retval -EINVAL Invalid dimensions
+ * \retval -ENOTSUP Not converged within max_sweeps, result is the last iterate
+ **/
+int svd_jacobi(const float *const A, uint16_t row, uint16_t column, uint8_t max_sweeps, float *U,
+	       float *S, float *V);
+/**
+ * \brief Rectangular linear operator y = A*x or y = A'*x
+ * \details
+ *   Used by routines that only need products with A and A' so that A never
+ *   has to be stored as a dense matrix. The dimensions are known to the
+ *   caller and to ctx.
+ * \param y Output vector [m] or [n] when transposed
+ * \param x Input vector [n] or [m] when transposed
+ * \param transposed Apply A' instead of A
+ * \param ctx User context
+ **/
+typedef void (*matrix_operator_t)(float *y, const float *const x, bool transposed, void *ctx);
+/**
+ * \brief Truncated SVD of an operator with Golub-Kahan-Lanczos bidiagonalization
+ * \details
+ *   U [m*rank]
+ *
+ *   S [rank]
+ *
+ *   V [n*rank]
+ *
+ *   Only products with A and A' are used, so A can be an implicit matrix
+ *   such as hankel_operator(). Every step costs one product with A, one
+ *   with A' and a full reorthogonalization of the Lanczos vectors. The
+ *   leading singular triplets of the small bidiagonal matrix are mapped
+ *   back. Two to three times rank steps are usually enough when the
+ *   singular values decay, more steps improve accuracy.
+ * \param A Operator
+ * \param ctx Context of A
+ * \param row Number of rows in A
+ * \param column Number of columns in A
+ * \param rank Number of singular triplets to compute
+ * \param steps Number of Lanczos steps, rank <= steps <= min(m, n)
+ * \param U Output left singular vectors
+ * \param S Output singular values in decreasing order
+ * \param V Output right singular vectors
+ * \retval 0 Success
+ * \retval -EINVAL Invalid dimensions
+ * \retval -ENOTSUP SVD of the bidiagonal matrix did not converge
+ **/
+int svd_lanczos(matrix_operator_t A, void *ctx, uint16_t row, uint16_t column, uint16_t rank,
+		uint16_t steps, float *U, float *S, float *V);
 /**
  * \brief Singular Value Decomposition A = USV^T (Economy mode)
  * \details
@@ -174,6 +403,43 @@ void svd_jacobi_one_sided(const float *const A, uint16_t row, uint8_t max_iterat
  **/
 int svd_golub_reinsch(const float *const A, uint16_t row, uint16_t column, float *U, float *S,
 		      float *V);
+/**
+ * \brief Truncated Singular Value Decomposition A ~ USV^T with a randomized range finder
+ * \details
+ *   Only the first rank singular triplets are computed. The range of A is
+ *   sampled with a random test matrix of rank + oversampling columns, the
+ *   sample is orthonormalized into Q and the small matrix Q'A is decomposed
+ *   with svd_golub_reinsch().
+ *
+ *   Halko, Martinsson and Tropp: Finding structure with randomness, 2011.
+ *
+ *   Power iterations improve accuracy when the singular values decay slowly.
+ *   The random test matrix uses a fixed seed so results are reproducible.
+ *
+ *   A [m*n]
+ *
+ *   U [m*rank]
+ *
+ *   S [rank]
+ *
+ *   V [n*rank]
+ *
+ *   rank <= min(m, n)
+ * \param A Input matrix [m * n]
+ * \param row Number of rows in A (m)
+ * \param column Number of columns in A (n)
+ * \param rank Number of singular triplets to compute
+ * \param oversampling Extra samples of the range of A (10 is a good start)
+ * \param power_iterations Number of power iterations (1 or 2 is a good start)
+ * \param U Output U Matrix [m * rank]
+ * \param S Output S Diagonal Vector [rank], in decreasing order
+ * \param V Output V Matrix [n * rank]
+ * \retval 0 Success
+ * \retval -EINVAL Invalid rank
+ * \retval -ENOTSUP SVD of the reduced matrix did not converge
+ **/
+int svd_randomized(const float *const A, uint16_t row, uint16_t column, uint16_t rank,
+		   uint16_t oversampling, uint8_t power_iterations, float *U, float *S, float *V);
 /**
  * \brief Solves discrete Lyapunov equation
  * \details
@@ -264,13 +530,71 @@ void linsolve_lower_triangular(const float *const A, float *x, const float *cons
  * [un .. .. .. .. .. ..][gn] [yn]
  *
  * Where g0 = y0/u0 and g1 = (y1 - u1*g0)/u0 etc..
- * \param g Markov parameters [m * n]
+ *
+ * Every row is solved on its own. Records of at least
+ * LINSOLVE_MARKOV_FFT_MIN_COLUMN samples are split in halves where the
+ * coupling between the halves is a convolution computed with FFT, which
+ * gives O(n*log(n)^2) instead of O(n^2). Leading zeros of u are treated as
+ * a delay of u and y, the last delay parameters can then not be identified
+ * and are set to zero.
+ * \param g Markov parameters [m * n] (can be same as y)
  * \param y Measurement signal [m * n]
  * \param u Input signal [m * n]
  * \param m Number of rows
  * \param n Number of columns
  **/
 void linsolve_markov(float *g, const float *const y, const float *const u, uint16_t m, uint16_t n);
+/**
+ * \brief Regularized Markov parameters from output y and input u
+ * \details
+ *   G = Y*conj(U) / (|U|^2 + lambda*mean(|U|^2))
+ *
+ *   Deconvolution in the frequency domain with transforms of twice the
+ *   record length. Frequencies where the input has little power are damped
+ *   instead of amplified, so inputs with a small or zero first sample and
+ *   noisy outputs give a usable impulse response. The finite record makes
+ *   this an approximation near the end of g.
+ * \param g Markov parameters [m * n] (can be same as y)
+ * \param y Measurement signal [m * n]
+ * \param u Input signal [m * n]
+ * \param m Number of rows
+ * \param n Number of columns
+ * \param lambda Regularization relative to the mean input power, 0 for none
+ * \param work Workspace [LINSOLVE_MARKOV_REGULARIZED_WORK_SIZE(n)]
+ **/
+void linsolve_markov_regularized(float *g, const float *const y, const float *const u,
+				 uint16_t m, uint16_t n, float lambda, float *work);
+/**
+ * \brief Least squares Markov parameters of a MIMO system
+ * \details
+ *   y [p * n]
+ *
+ *   u [q * n]
+ *
+ *   G [p * (q*L)] = [G_0 G_1 ... G_L-1]
+ *
+ *   Fits y(t) = sum G_s*u(t - s) over the first L lags. Input
+ *   auto-correlations and input-output cross-correlations are computed with
+ *   FFT and the block Toeplitz normal equations are solved with the block
+ *   Levinson recursion in O(L^2 * q^2 * (q + p)), without forming them. The
+ *   correlations assume zero signals outside of the record, which is exact
+ *   when the output has settled at the end of the record.
+ * \param G Markov parameters
+ * \param y Output signals, one per row
+ * \param u Input signals, one per row
+ * \param outputs Number of outputs p
+ * \param inputs Number of inputs q
+ * \param column Number of samples n
+ * \param lags Number of Markov parameters L <= n
+ * \param lambda Ridge regularization relative to the mean input power, 0 for none
+ * \param work Workspace [LINSOLVE_MARKOV_MIMO_WORK_SIZE(q, n, L)]
+ * \retval 0 Success
+ * \retval -EINVAL Invalid dimensions
+ * \retval -ENOTSUP Input is not persistently exciting, increase lambda
+ **/
+int linsolve_markov_mimo(float *G, const float *const y, const float *const u, uint16_t outputs,
+			 uint16_t inputs, uint16_t column, uint16_t lags, float lambda,
+			 float *work);
 
 /**
  * \brief Do LU-decomposition with partial pivoting
@@ -349,20 +673,189 @@ void cholupdate(float *L, const float *const x, uint16_t row, bool rank_one_upda
  **/
 void linsolve_chol(const float *const A, float *x, const float *const b, uint16_t row);
 
+/**
+ * \brief Linear operator y = Op(x) for matrix-free solvers
+ * \details
+ *   Used both for the system matrix and for preconditioners, which apply an
+ *   approximation of the inverse. ctx is passed through unchanged.
+ * \param y Output vector [row]
+ * \param x Input vector [row]
+ * \param row Length of the vectors
+ * \param ctx User context
+ **/
+typedef void (*linear_operator_t)(float *y, const float *const x, uint16_t row, void *ctx);
+
+/**
+ * \brief Settings for the iterative solvers
+ **/
+struct linsolve_options {
+	float tolerance; // Stop when the relative residual is at or below this
+	uint16_t max_iterations; // Maximum number of operator applications
+	uint16_t restart; // Krylov basis size of linsolve_gmres() (0 = LINSOLVE_GMRES_RESTART)
+	linear_operator_t preconditioner; // Approximate inverse of A or NULL
+	void *preconditioner_ctx; // Context passed to preconditioner
+};
+
+/**
+ * \brief Outcome of an iterative solve
+ **/
+struct linsolve_stats {
+	uint16_t iterations; // Number of iterations done
+	float residual; // Relative residual when the solver stopped
+};
+
+/**
+ * \brief Solve Ax=b with preconditioned conjugate gradients
+ * \details
+ *   A must be symmetric positive definite and so must the preconditioner.
+ *   A is only accessed through the operator so it never has to be stored
+ *   densely. The residual is ||b - Ax|| / ||b|| from the recursively updated
+ *   residual.
+ *
+ *   Memory use is 4 vectors of length row.
+ * \param x Initial guess on input, solution on output [row]
+ * \param A Operator computing A*x
+ * \param ctx Context passed to A
+ * \param b Right hand side [row]
+ * \param row Size of the system
+ * \param options Tolerance, iteration limit and preconditioner
+ * \param stats Iterations and final residual, may be NULL
+ * \retval 0 Converged
+ * \retval -EINVAL Invalid arguments
+ * \retval -ENOTSUP Not converged or A is not positive definite
+ **/
+int linsolve_cg(float *x, linear_operator_t A, void *ctx, const float *const b, uint16_t row,
+		const struct linsolve_options *options, struct linsolve_stats *stats);
+/**
+ * \brief Solve Ax=b with preconditioned MINRES
+ * \details
+ *   A must be symmetric but may be indefinite, for example saddle point
+ *   systems from constrained least squares. The preconditioner must be
+ *   symmetric positive definite. The residual is the recursive estimate of
+ *   the residual relative to b, both in the norm of the preconditioner.
+ *
+ *   Paige and Saunders: Solution of sparse indefinite systems of linear
+ *   equations, 1975.
+ *
+ *   Memory use is 7 vectors of length row.
+ * \param x Initial guess on input, solution on output [row]
+ * \param A Operator computing A*x
+ * \param ctx Context passed to A
+ * \param b Right hand side [row]
+ * \param row Size of the system
+ * \param options Tolerance, iteration limit and preconditioner
+ * \param stats Iterations and final residual, may be NULL
+ * \retval 0 Converged
+ * \retval -EINVAL Invalid arguments
+ * \retval -ENOTSUP Not converged or the preconditioner is not positive definite
+ **/
+int linsolve_minres(float *x, linear_operator_t A, void *ctx, const float *const b, uint16_t row,
+		    const struct linsolve_options *options, struct linsolve_stats *stats);
+/**
+ * \brief Solve Ax=b with restarted right preconditioned GMRES
+ * \details
+ *   Works for any nonsingular A. The Krylov basis is orthogonalized with
+ *   modified Gram-Schmidt and the least squares problem is updated with
+ *   Givens rotations, so the residual ||b - Ax|| / ||b|| is known every
+ *   iteration without forming x.
+ *
+ *   Saad and Schultz: GMRES, a generalized minimal residual algorithm, 1986.
+ *
+ *   The Krylov basis of restart + 1 vectors of length row and the
+ *   Hessenberg matrix live in the caller provided workspace, so large
+ *   systems do not need a large stack.
+ * \param x Initial guess on input, solution on output [row]
+ * \param A Operator computing A*x
+ * \param ctx Context passed to A
+ * \param b Right hand side [row]
+ * \param row Size of the system
+ * \param options Tolerance, iteration limit, restart length and preconditioner
+ * \param stats Iterations and final residual, may be NULL
+ * \param work Workspace [LINSOLVE_GMRES_WORK_SIZE(row, options->restart)]
+ * \retval 0 Converged
+ * \retval -EINVAL Invalid arguments
+ * \retval -ENOTSUP Not converged
+ **/
+int linsolve_gmres(float *x, linear_operator_t A, void *ctx, const float *const b, uint16_t row,
+		   const struct linsolve_options *options, struct linsolve_stats *stats,
+		   float *work);
+/**
+ * \brief Jacobi preconditioner y = x ./ diag(A)
+ * \details
+ *   Matches linear_operator_t so it can be used as preconditioner of the
+ *   iterative solvers. Zero diagonal entries pass x through unchanged.
+ * \param y Output vector [row]
+ * \param x Input vector [row]
+ * \param row Length of the vectors
+ * \param ctx Diagonal of A as const float [row]
+ **/
+void linsolve_jacobi_preconditioner(float *y, const float *const x, uint16_t row, void *ctx);
 /**
  * \brief Pseudo inverse by using Singular Value Decomposition
  * \details
  *   A [m*n]
  *
- *   m >= n
+ *   Ai [n*m]
  *
  *   Ai = V*inv(S)*U'
+ *
+ *   The SVD is computed with svd_jacobi() for any shape of A. Singular
+ *   values below max(m, n) * S[0] * FLT_EPSILON are treated as zero. Ai is
+ *   zero when the SVD does not converge.
  * \param Ai Result matrix (can be same as input matrix)
  * \param A Input matrix
  * \param row Number of rows in A
  * \param column Number of columns in A
  **/
 void pinv(float *Ai, const float *const A, uint16_t row, uint16_t column);
+/**
+ * \brief Pseudo inverse of A truncated to its dominant singular values
+ * \details
+ *   Ai [n*m]
+ *
+ *   Ai = V(:, 1:r)*inv(S(1:r, 1:r))*U(:, 1:r)'
+ *
+ *   where r is the number of singular values above rcond * S[0], at most
+ *   max_rank. Only the kept singular vectors enter the product so a low
+ *   rank result is cheaper to form than the full pseudo inverse.
+ * \param Ai Result matrix (can be same as input matrix)
+ * \param A Input matrix
+ * \param row Number of rows in A
+ * \param column Number of columns in A
+ * \param rcond Relative singular value cutoff, 0 for max(m, n) * FLT_EPSILON
+ * \param max_rank Largest number of singular values to keep
+ * \returns Number of singular values kept, 0 with Ai set to zero when the
+ *   SVD did not converge
+ **/
+uint16_t pinv_truncated(float *Ai, const float *const A, uint16_t row, uint16_t column,
+			float rcond, uint16_t max_rank);
+/**
+ * \brief Least squares solution of A*X = B without forming pinv(A)
+ * \details
+ *   A [m*n]
+ *
+ *   B [m*p]
+ *
+ *   X [n*p]
+ *
+ *   Tall and square problems are solved with Householder QR with column
+ *   pivoting, O(m*n^2). When the pivoted R shows that A is rank deficient
+ *   to rcond, or when A is wide, the minimum norm solution is computed from
+ *   svd_jacobi() with singular values below rcond * S[0] dropped.
+ * \param X Output solution (can be same as B when B is large enough)
+ * \param A Input matrix
+ * \param B Right hand sides
+ * \param row Number of rows in A
+ * \param column Number of columns in A
+ * \param column_b Number of columns in B
+ * \param rcond Relative singular value cutoff, 0 for max(m, n) * FLT_EPSILON
+ * \param rank Numerical rank of A used for the solution (can be NULL)
+ * \retval 0 Success
+ * \retval -EINVAL Empty dimensions
+ * \retval -ENOTSUP The SVD fallback did not converge
+ **/
+int lstsq(float *X, const float *const A, const float *const B, uint16_t row, uint16_t column,
+	  uint16_t column_b, float rcond, uint16_t *rank);
 /**
  * \brief Create hankel matrix of vector V. Step is just the shift. Normaly set this to 0.
  * \details
@@ -383,6 +876,58 @@ void pinv(float *Ai, const float *const A, uint16_t row, uint16_t column);
  **/
 int hankel(const float *const V, float *H, uint16_t row_v, uint16_t column_v, uint16_t row_h,
 	   uint16_t column_h, uint16_t shift);
+/**
+ * \brief Hankel matrix of hankel() represented by the spectra of V
+ * \details
+ *   Products with H and H' are computed as correlations with FFT in
+ *   O(row_v * n * log(n)) with n = fft_size(row_h / row_v + column_h - 1),
+ *   so H is never formed. Storage is provided by the caller.
+ **/
+struct hankel_operator {
+	uint16_t row_v; // Rows of V
+	uint16_t row; // Rows of H
+	uint16_t column; // Columns of H
+	struct fft_plan plan; // Transform of length n
+	float *spectrum; // Transform of every row of V [row_v*2*n]
+	float *work; // Work buffers [4*n]
+};
+/**
+ * \brief Number of floats of storage needed by hankel_operator_init()
+ * \param row_v Number of rows in V
+ * \param row_h Number of rows in H
+ * \param column_h Number of columns in H
+ * \returns Storage size in floats
+ **/
+uint32_t hankel_operator_storage_size(uint16_t row_v, uint16_t row_h, uint16_t column_h);
+/**
+ * \brief Prepare an implicit Hankel matrix of V with the same layout as hankel()
+ * \details
+ *   V is only read during initialization.
+ * \param self Operator to initialize
+ * \param V Input vector [row_v*column_v]
+ * \param row_v Number of rows in V
+ * \param column_v Number of columns in V
+ * \param row_h Number of rows in H, a multiple of row_v
+ * \param column_h Number of columns in H
+ * \param shift Shift of the first element
+ * \param storage Storage [hankel_operator_storage_size(row_v, row_h, column_h)]
+ * \retval 0 Success
+ * \retval -EINVAL Invalid dimensions
+ **/
+int hankel_operator_init(struct hankel_operator *self, const float *const V, uint16_t row_v,
+			 uint16_t column_v, uint16_t row_h, uint16_t column_h, uint16_t shift,
+			 float *storage);
+/**
+ * \brief Product with an implicit Hankel matrix, y = H*x or y = H'*x
+ * \details
+ *   Matches matrix_operator_t for use with svd_lanczos(). Not reentrant
+ *   because the work buffers are shared.
+ * \param y Output vector [row_h] or [column_h] when transposed
+ * \param x Input vector [column_h] or [row_h] when transposed
+ * \param transposed Apply H' instead of H
+ * \param ctx Operator as struct hankel_operator *
+ **/
+void hankel_operator(float *y, const float *const x, bool transposed, void *ctx);
 /**
  * \brief Balance a matrix A to reduce numerical errors in future calculations
  * \param A Square matrix
@@ -399,12 +944,54 @@ void balance(float A[], uint16_t row);
  *   wi [m]
  *
  *   n == m
+ *
+ *   Matrices of at least EIG_FRANCIS_AED_MIN_ROW rows use eig_francis() and
+ *   fall back to the plain shifted QR when it does not converge.
  * \param A Input matrix
  * \param wr Real eigenvalues
  * \param wi Imaginary eigenvalues
  * \param row Number of rows in A
  **/
 void eig(const float *const A, float *wr, float *wi, uint16_t row);
+/**
+ * \brief Find eigenvalues and optionally right eigenvectors of a general matrix
+ * \details
+ *   The matrix is balanced, reduced to Hessenberg form with Householder
+ *   reflections and brought to real Schur form with the Francis double-shift
+ *   QR algorithm. Matrices with at least EIG_FRANCIS_AED_MIN_ROW rows use a
+ *   multishift iteration where shifts come from an aggressive early deflation
+ *   window at the bottom of the active block.
+ *
+ *   A [m*n]
+ *
+ *   wr [m]
+ *
+ *   wi [m]
+ *
+ *   V [m*n] (can be NULL)
+ *
+ *   work [EIG_FRANCIS_WORK_SIZE(m)]
+ *
+ *   n == m
+ *
+ *   Complex conjugate eigenvalues are stored next to each other with the
+ *   positive imaginary part first. For such a pair in columns j and j + 1 the
+ *   eigenvectors are V(:, j) + i * V(:, j + 1) and V(:, j) - i * V(:, j + 1).
+ *   Every eigenvector is normalized to unit length.
+ *
+ *   No memory is allocated so the same workspace can be reused for every call.
+ *   A may point to the start of work.
+ * \param A Input matrix
+ * \param wr Real part of the eigenvalues
+ * \param wi Imaginary part of the eigenvalues
+ * \param V Output right eigenvectors, one per column. Pass NULL for eigenvalues only.
+ * \param work Workspace of EIG_FRANCIS_WORK_SIZE(row) floats
+ * \param row Number of rows in A
+ * \retval 0 Success
+ * \retval -EINVAL Invalid arguments
+ * \retval -ENOTSUP QR iteration did not converge
+ **/
+int eig_francis(const float *const A, float *wr, float *wi, float *V, float *work, uint16_t row);
 /**
  * \brief Compute eigenvalues and eigenvectors from a symmetrical square matrix A
  * \details
@@ -448,12 +1035,60 @@ void sum(float *Ar, const float *const A, uint16_t row, uint16_t column, uint8_t
  *   l = 1 = L1-norm
  *
  *   l = 2 = L2-norm
+ *
+ *   The L2-norm of a matrix is its largest singular value. It is found with
+ *   norm2_estimate() instead of a full SVD.
  * \param A Input matrix A
  * \param row Number of rows in A
  * \param column Number of columns in A
  * \param l Whether to return L1 or L2 norm
  **/
 float norm(const float *const A, uint16_t row, uint16_t column, uint8_t l);
+/**
+ * \brief Estimate the largest singular value of A by power iteration on A'A
+ * \details
+ *   A[m*n]
+ *
+ *   Every iteration costs two matrix vector products, O(m*n). Iteration
+ *   stops when the estimate changes less than tolerance relative to its
+ *   value. Convergence is governed by (s2/s1)^2 so the estimate is accurate
+ *   after a few iterations unless the two largest singular values are close.
+ *   The estimate never exceeds the true 2-norm.
+ * \param A Input matrix A
+ * \param row Number of rows in A
+ * \param column Number of columns in A
+ * \param tolerance Relative change that stops the iteration
+ * \param max_iterations Maximum number of iterations
+ * \returns Estimate of norm(A, 2)
+ **/
+float norm2_estimate(const float *const A, uint16_t row, uint16_t column, float tolerance,
+		     uint8_t max_iterations);
+/**
+ * \brief Estimate the reciprocal 1-norm condition number from an LU factorization
+ * \details
+ *   LU and P are the output of lup(). norm(inv(A), 1) is estimated with the
+ *   Hager/Higham method, which needs a handful of solves with A and A' on
+ *   the existing factors, so the cost is O(n^2).
+ *
+ *   Higham: FORTRAN codes for estimating the one-norm of a real or complex
+ *   matrix, 1988.
+ * \param LU Factorization from lup() [n*n]
+ * \param P Pivot vector from lup() [n]
+ * \param row Size of A
+ * \param anorm norm(A, 1) of the factorized matrix
+ * \returns Estimate of 1 / (norm(A, 1) * norm(inv(A), 1)), 0 if A is singular
+ **/
+float rcond_lup(const float *const LU, const uint8_t *const P, uint16_t row, float anorm);
+/**
+ * \brief Estimate the reciprocal 1-norm condition number from a Cholesky factor
+ * \details
+ *   L is the output of chol(), A = LL'. Same method as rcond_lup().
+ * \param L Lower triangular Cholesky factor [n*n]
+ * \param row Size of A
+ * \param anorm norm(A, 1) of the factorized matrix
+ * \returns Estimate of 1 / (norm(A, 1) * norm(inv(A), 1)), 0 if A is singular
+ **/
+float rcond_chol(const float *const L, uint16_t row, float anorm);
 /**
  * \brief Find matrix exponential, return A as A = expm(A)
  * \details
@@ -465,9 +1100,155 @@ float norm(const float *const A, uint16_t row, uint16_t column, uint8_t l);
  * \param row Size of input matrix (must be square)
  **/
 void expm(const float *const A, float *exp, uint16_t row);
+/**
+ * \brief Solve the nonlinear system dx = f(b, x) = 0
+ * \details
+ *   With random_guess_active, NONLINSOLVE_ITERATIONS random guesses between
+ *   min_value and max_value are evaluated with a time based seed and the best
+ *   one is refined with nonlinsolve_refine(). Otherwise x is refined directly.
+ *   Use nonlinsolve_multistart() for reproducible or parallel guesses.
+ * \param nonlinear_equation_system Function computing dx from b and x
+ * \param b Parameters passed to the function
+ * \param x Initial guess and solution [elements]
+ * \param elements Number of unknowns
+ * \param alpha Gradient step size, a small positive number
+ * \param max_value Upper bound of random guesses
+ * \param min_value Lower bound of random guesses
+ * \param random_guess_active Start from random guesses instead of x
+ **/
 void nonlinsolve(void (*nonlinear_equation_system)(float[], float[], float[]), float b[], float x[],
 		 uint8_t elements, float alpha, float max_value, float min_value,
 		 bool random_guess_active);
+/**
+ * \brief Evaluate a range of random candidates of the nonlinear system
+ * \details
+ *   Candidate i is drawn from a counter based generator keyed by seed and i,
+ *   so candidates do not depend on how the range is split. Each thread or
+ *   core evaluates its own range of [0, total) and the partial results are
+ *   combined with nonlinsolve_multistart_merge(). The best candidate is then
+ *   the same for any split and any merge order.
+ * \param nonlinear_equation_system Function computing dx from b and x, must
+ *   be safe to call concurrently when ranges are evaluated in parallel
+ * \param b Parameters passed to the function
+ * \param x Best candidate of the range, unchanged without a finite residual [elements]
+ * \param elements Number of unknowns
+ * \param max_value Upper bound of candidates
+ * \param min_value Lower bound of candidates
+ * \param seed Seed of the candidate sequence
+ * \param first Index of the first candidate
+ * \param count Number of candidates
+ * \param index Index of the best candidate, the lowest one on ties
+ * \returns Residual norm(dx) of the best candidate, FLT_MAX when every residual is NaN
+ **/
+float nonlinsolve_multistart(void (*nonlinear_equation_system)(float[], float[], float[]),
+			     float b[], float x[], uint8_t elements, float max_value,
+			     float min_value, uint32_t seed, uint32_t first, uint32_t count,
+			     uint32_t *index);
+/**
+ * \brief Combine two results of nonlinsolve_multistart()
+ * \details
+ *   Keeps the lower residual and the lower candidate index on ties, which
+ *   makes the reduction independent of the order of merges.
+ * \param x Best candidate so far, replaced by x_other when it is better [elements]
+ * \param residual Residual of x
+ * \param index Candidate index of x, updated with x
+ * \param x_other Other candidate [elements]
+ * \param residual_other Residual of x_other
+ * \param index_other Candidate index of x_other
+ * \param elements Number of unknowns
+ * \returns Residual of the kept candidate
+ **/
+float nonlinsolve_multistart_merge(float x[], float residual, uint32_t *index,
+				   const float *const x_other, float residual_other,
+				   uint32_t index_other, uint8_t elements);
+/**
+ * \brief Refine a solution of the nonlinear system with stochastic gradient descent
+ * \param nonlinear_equation_system Function computing dx from b and x
+ * \param b Parameters passed to the function
+ * \param x Initial guess and best solution found [elements]
+ * \param elements Number of unknowns
+ * \param alpha Gradient step size, a small positive number
+ **/
+void nonlinsolve_refine(void (*nonlinear_equation_system)(float[], float[], float[]), float b[],
+			float x[], uint8_t elements, float alpha);
+/**
+ * \brief Residuals R = f(X) of count points for nonlinsolve_lm()
+ * \details
+ *   Point k is X[k*column .. k*column + column - 1] and its residuals go to
+ *   R[k*row .. k*row + row - 1]. The columns of a finite difference Jacobian
+ *   are requested in one call so the model can evaluate them together.
+ * \param R Output residuals [count*row]
+ * \param X Input points [count*column]
+ * \param count Number of points
+ * \param ctx User context
+ **/
+typedef void (*nonlinsolve_residual_t)(float *R, const float *const X, uint16_t count, void *ctx);
+/**
+ * \brief Analytic Jacobian J = df/dx for nonlinsolve_lm()
+ * \param J Output Jacobian [row*column]
+ * \param x Point [column]
+ * \param ctx User context
+ **/
+typedef void (*nonlinsolve_jacobian_t)(float *J, const float *const x, void *ctx);
+
+/**
+ * \brief Settings for nonlinsolve_lm()
+ **/
+struct nonlinsolve_lm_options {
+	float tolerance; // Stop when ||delta|| <= tolerance * (||x|| + tolerance)
+	float gradient_tolerance; // Stop when max |J'*r| is at or below this
+	float lambda; // Initial damping, 0 starts with Gauss-Newton steps
+	float step; // Relative finite difference step (0 = sqrt(FLT_EPSILON))
+	uint16_t max_iterations; // Maximum number of steps
+	nonlinsolve_jacobian_t jacobian; // Analytic Jacobian or NULL for finite differences
+};
+
+/**
+ * \brief Reason nonlinsolve_lm() stopped
+ **/
+enum nonlinsolve_status {
+	NONLINSOLVE_STEP, // Step below tolerance
+	NONLINSOLVE_GRADIENT, // Gradient below gradient_tolerance or zero residual
+	NONLINSOLVE_MAX_ITERATIONS, // Iteration limit reached
+	NONLINSOLVE_SINGULAR // Least squares step could not be computed
+};
+
+/**
+ * \brief Outcome of nonlinsolve_lm()
+ **/
+struct nonlinsolve_lm_stats {
+	uint16_t iterations; // Number of steps tried
+	uint32_t evaluations; // Number of points passed to the residual function
+	float residual; // ||f(x)|| at the returned x
+	enum nonlinsolve_status status; // Termination reason
+};
+
+/**
+ * \brief Nonlinear least squares min ||f(x)|| with Levenberg-Marquardt
+ * \details
+ *   Every step solves min ||[J; sqrt(lambda)*D]*delta + [f(x); 0]|| with
+ *   lstsq(), which uses pivoted QR instead of the normal equations. D holds
+ *   the largest column norms of J seen so far (Marquardt scaling). With
+ *   lambda = 0 the step is Gauss-Newton. Damping is raised when a step does
+ *   not reduce the residual and lowered with Nielsen's rule otherwise.
+ *
+ *   Typically converges in tens of iterations from a reasonable start. Use
+ *   nonlinsolve_multistart() to find one.
+ *
+ *   Nielsen: Damping parameter in Marquardt's method, 1999.
+ * \param x Initial guess on input, solution on output [column]
+ * \param f Residual function
+ * \param ctx Context passed to f and to the Jacobian
+ * \param row Number of residuals
+ * \param column Number of unknowns
+ * \param options Tolerances, damping, iteration limit and Jacobian
+ * \param stats Iterations, evaluations, residual and status, may be NULL
+ * \retval 0 Converged
+ * \retval -EINVAL Invalid arguments
+ * \retval -ENOTSUP Iteration limit reached or step could not be computed
+ **/
+int nonlinsolve_lm(float *x, nonlinsolve_residual_t f, void *ctx, uint16_t row, uint16_t column,
+		   const struct nonlinsolve_lm_options *options, struct nonlinsolve_lm_stats *stats);
 /**
  * \brief Solve Ax = b using gaussian elemination
  * \details
@@ -0,0 +1,384 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+/*
+ * Optional header-only C++ wrapper over the C linear algebra routines.
+ *
+ * control::Matrix<R, C> owns aligned storage with compile-time dimensions so
+ * no dimension arguments need to be passed around. Arithmetic builds
+ * expression objects that are evaluated in a single loop when assigned, so
+ * x = A * x + B * u produces no intermediate matrices for the sum and only a
+ * temporary for the result because x is read by the product while written.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+
+extern "C" {
+#include "control/linalg.h"
+}
+
+namespace control
+{
+
+template <std::size_t R, std::size_t C> class Matrix;
+
+/*
+ * Base of all matrix expressions. Every expression E provides:
+ *   rows, cols                  compile-time dimensions
+ *   operator()(i, j)            element (i, j) of the result
+ *   references(p)               true if storage p is read at all
+ *   aliases(p)                  true if storage p is read at other positions
+ *                               than the one being computed, which makes
+ *                               evaluation into p unsafe
+ */
+template <class E> struct Expression {
+	const E &self() const
+	{
+		return static_cast<const E &>(*this);
+	}
+};
+
+namespace detail
+{
+// Matrices are held by reference in expressions, sub-expressions by value
+template <class E> struct operand {
+	using type = const E;
+};
+template <std::size_t R, std::size_t C> struct operand<Matrix<R, C> > {
+	using type = const Matrix<R, C> &;
+};
+
+// Products read every operand element many times, so sub-expressions are evaluated first
+template <class E> struct product_operand {
+	using type = const Matrix<E::rows, E::cols>;
+};
+template <std::size_t R, std::size_t C> struct product_operand<Matrix<R, C> > {
+	using type = const Matrix<R, C> &;
+};
+} // namespace detail
+
+template <class L, class R> class Sum : public Expression<Sum<L, R> > {
+    public:
+	static constexpr std::size_t rows = L::rows;
+	static constexpr std::size_t cols = L::cols;
+	static_assert(L::rows == R::rows && L::cols == R::cols, "Dimensions must agree");
+
+	Sum(const L &l, const R &r) : l_(l), r_(r)
+	{
+	}
+	float operator()(std::size_t i, std::size_t j) const
+	{
+		return l_(i, j) + r_(i, j);
+	}
+	bool references(const float *p) const
+	{
+		return l_.references(p) || r_.references(p);
+	}
+	bool aliases(const float *p) const
+	{
+		return l_.aliases(p) || r_.aliases(p);
+	}
+
+    private:
+	typename detail::operand<L>::type l_;
+	typename detail::operand<R>::type r_;
+};
+
+template <class L, class R> class Difference : public Expression<Difference<L, R> > {
+    public:
+	static constexpr std::size_t rows = L::rows;
+	static constexpr std::size_t cols = L::cols;
+	static_assert(L::rows == R::rows && L::cols == R::cols, "Dimensions must agree");
+
+	Difference(const L &l, const R &r) : l_(l), r_(r)
+	{
+	}
+	float operator()(std::size_t i, std::size_t j) const
+	{
+		return l_(i, j) - r_(i, j);
+	}
+	bool references(const float *p) const
+	{
+		return l_.references(p) || r_.references(p);
+	}
+	bool aliases(const float *p) const
+	{
+		return l_.aliases(p) || r_.aliases(p);
+	}
+
+    private:
+	typename detail::operand<L>::type l_;
+	typename detail::operand<R>::type r_;
+};
+
+template <class E> class Scale : public Expression<Scale<E> > {
+    public:
+	static constexpr std::size_t rows = E::rows;
+	static constexpr std::size_t cols = E::cols;
+
+	Scale(const E &e, float s) : e_(e), s_(s)
+	{
+	}
+	float operator()(std::size_t i, std::size_t j) const
+	{
+		return s_ * e_(i, j);
+	}
+	bool references(const float *p) const
+	{
+		return e_.references(p);
+	}
+	bool aliases(const float *p) const
+	{
+		return e_.aliases(p);
+	}
+
+    private:
+	typename detail::operand<E>::type e_;
+	float s_;
+};
+
+template <class E> class Transpose : public Expression<Transpose<E> > {
+    public:
+	static constexpr std::size_t rows = E::cols;
+	static constexpr std::size_t cols = E::rows;
+
+	explicit Transpose(const E &e) : e_(e)
+	{
+	}
+	float operator()(std::size_t i, std::size_t j) const
+	{
+		return e_(j, i);
+	}
+	bool references(const float *p) const
+	{
+		return e_.references(p);
+	}
+	bool aliases(const float *p) const
+	{
+		return e_.references(p);
+	}
+
+    private:
+	typename detail::operand<E>::type e_;
+};
+
+template <class L, class R> class Product : public Expression<Product<L, R> > {
+    public:
+	static constexpr std::size_t rows = L::rows;
+	static constexpr std::size_t cols = R::cols;
+	static_assert(L::cols == R::rows, "Inner dimensions must agree");
+
+	Product(const L &l, const R &r) : l_(l), r_(r)
+	{
+	}
+	float operator()(std::size_t i, std::size_t j) const
+	{
+		float sum = 0.0f;
+
+		for (std::size_t k = 0; k < L::cols; k++)
+			sum += l_(i, k) * r_(k, j);
+		return sum;
+	}
+	bool references(const float *p) const
+	{
+		return l_.references(p) || r_.references(p);
+	}
+	bool aliases(const float *p) const
+	{
+		return references(p);
+	}
+
+    private:
+	typename detail::product_operand<L>::type l_;
+	typename detail::product_operand<R>::type r_;
+};
+
+/*
+ * Dense row-major matrix with compile-time dimensions. The storage layout is
+ * the same as the C API uses so data() can be passed to any C routine.
+ */
+template <std::size_t R, std::size_t C> class Matrix : public Expression<Matrix<R, C> > {
+    public:
+	static constexpr std::size_t rows = R;
+	static constexpr std::size_t cols = C;
+	static_assert(R > 0 && C > 0, "Matrix must not be empty");
+
+	// Zero matrix
+	Matrix() : data_()
+	{
+	}
+	// Row-major elements, missing elements are zero
+	Matrix(std::initializer_list<float> values) : data_()
+	{
+		std::size_t k = 0;
+
+		for (float v : values) {
+			if (k == R * C)
+				break;
+			data_[k++] = v;
+		}
+	}
+	template <class E> Matrix(const Expression<E> &e)
+	{
+		assign(e.self());
+	}
+	template <class E> Matrix &operator=(const Expression<E> &e)
+	{
+		// Evaluate into a temporary only when the expression reads this matrix out of order
+		if (e.self().aliases(data_)) {
+			const Matrix tmp(e);
+
+			*this = tmp;
+		} else {
+			assign(e.self());
+		}
+		return *this;
+	}
+	template <class E> Matrix &operator+=(const Expression<E> &e)
+	{
+		return *this = Sum<Matrix, E>(*this, e.self());
+	}
+	template <class E> Matrix &operator-=(const Expression<E> &e)
+	{
+		return *this = Difference<Matrix, E>(*this, e.self());
+	}
+	Matrix &operator*=(float s)
+	{
+		for (std::size_t k = 0; k < R * C; k++)
+			data_[k] *= s;
+		return *this;
+	}
+
+	static Matrix identity()
+	{
+		Matrix I;
+
+		for (std::size_t i = 0; i < (R < C ? R : C); i++)
+			I(i, i) = 1.0f;
+		return I;
+	}
+
+	float &operator()(std::size_t i, std::size_t j)
+	{
+		return data_[C * i + j];
+	}
+	float operator()(std::size_t i, std::size_t j) const
+	{
+		return data_[C * i + j];
+	}
+	float *data()
+	{
+		return data_;
+	}
+	const float *data() const
+	{
+		return data_;
+	}
+	// View for the ld-aware C kernels
+	struct mat_view view()
+	{
+		return mat_view_init(data_, R, C);
+	}
+
+	bool references(const float *p) const
+	{
+		return p == data_;
+	}
+	bool aliases(const float *) const
+	{
+		return false;
+	}
+
+    private:
+	template <class E> void assign(const E &e)
+	{
+		for (std::size_t i = 0; i < R; i++)
+			for (std::size_t j = 0; j < C; j++)
+				data_[C * i + j] = e(i, j);
+	}
+
+	alignas(16) float data_[R * C];
+};
+
+template <std::size_t R, std::size_t C> constexpr std::size_t Matrix<R, C>::rows;
+template <std::size_t R, std::size_t C> constexpr std::size_t Matrix<R, C>::cols;
+
+template <class L, class R> Sum<L, R> operator+(const Expression<L> &l, const Expression<R> &r)
+{
+	return Sum<L, R>(l.self(), r.self());
+}
+
+template <class L, class R>
+Difference<L, R> operator-(const Expression<L> &l, const Expression<R> &r)
+{
+	return Difference<L, R>(l.self(), r.self());
+}
+
+template <class E> Scale<E> operator-(const Expression<E> &e)
+{
+	return Scale<E>(e.self(), -1.0f);
+}
+
+template <class E> Scale<E> operator*(float s, const Expression<E> &e)
+{
+	return Scale<E>(e.self(), s);
+}
+
+template <class E> Scale<E> operator*(const Expression<E> &e, float s)
+{
+	return Scale<E>(e.self(), s);
+}
+
+template <class E> Scale<E> operator/(const Expression<E> &e, float s)
+{
+	return Scale<E>(e.self(), 1.0f / s);
+}
+
+template <class L, class R>
+Product<L, R> operator*(const Expression<L> &l, const Expression<R> &r)
+{
+	return Product<L, R>(l.self(), r.self());
+}
+
+template <class E> Transpose<E> transpose(const Expression<E> &e)
+{
+	return Transpose<E>(e.self());
+}
+
+/*
+ * Wrappers over the C routines. Return codes are the same as for the
+ * corresponding C function.
+ */
+template <std::size_t N> int inv(Matrix<N, N> &Ai, const Matrix<N, N> &A)
+{
+	return ::inv(Ai.data(), A.data(), N);
+}
+
+template <std::size_t N> float det(const Matrix<N, N> &A)
+{
+	return ::det(A.data(), N);
+}
+
+template <std::size_t R, std::size_t C> Matrix<C, R> pinv(const Matrix<R, C> &A)
+{
+	Matrix<C, R> Ai;
+
+	::pinv(Ai.data(), A.data(), R, C);
+	return Ai;
+}
+
+template <std::size_t N>
+int linsolve(Matrix<N, 1> &x, const Matrix<N, N> &A, const Matrix<N, 1> &b)
+{
+	return ::linsolve_lup(A.data(), x.data(), b.data(), N);
+}
+
+} // namespace control
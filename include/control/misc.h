@@ -108,11 +108,91 @@ void print(float A[], uint16_t row, uint16_t column);
  * \retval 0 If number is zero
  **/
 float sign(float number);
+/**
+ * \brief Random number stream
+ * \details
+ *   Philox4x32-10 counter based generator. Word i of a stream is a pure
+ *   function of the seed, the stream number and i, so streams with different
+ *   numbers are independent and can be handed to separate threads without
+ *   any locking, and any position can be reached in constant time.
+ *
+ *   Salmon, Moraes, Dror and Shaw: Parallel random numbers, as easy as
+ *   1, 2, 3, 2011.
+ **/
+struct rng {
+	uint32_t key[2]; // Seed
+	uint32_t counter[4]; // Block index in words 0 and 1, stream in word 2
+	uint32_t buffer[4]; // Last generated block
+	uint8_t index; // Next unused word of buffer, 4 when empty
+};
+
+/**
+ * \brief Initialize a random number stream
+ * \param self Stream to initialize
+ * \param seed Seed shared by all streams of one run
+ * \param stream Stream number, use one per thread or per task
+ **/
+void rng_init(struct rng *self, uint64_t seed, uint32_t stream);
+/**
+ * \brief Move a stream to a position
+ * \details
+ *   Lets a range of samples of a stream be generated out of order, for
+ *   example sample block k of a simulation starting at word k*words_per_sample.
+ * \param self Stream
+ * \param position Index of the next word to generate
+ **/
+void rng_seek(struct rng *self, uint64_t position);
+/**
+ * \brief Next uniformly distributed 32 bit word of a stream
+ * \param self Stream
+ * \returns Random word
+ **/
+uint32_t rng_next(struct rng *self);
+/**
+ * \brief Fill a buffer with uniformly distributed 32 bit words
+ * \details
+ *   Gives the same words as the same number of rng_next() calls, but whole
+ *   blocks are written directly to w.
+ * \param self Stream
+ * \param w Output words [length]
+ * \param length Number of words
+ **/
+void rng_fill(struct rng *self, uint32_t *w, uint32_t length);
+/**
+ * \brief Next uniformly distributed number in [0, 1)
+ * \param self Stream
+ * \returns Random number with 24 random bits
+ **/
+float rng_uniform(struct rng *self);
+/**
+ * \brief Fill a buffer with uniformly distributed numbers in [low, high)
+ * \param self Stream
+ * \param x Output numbers [length]
+ * \param length Number of values
+ * \param low Lower bound
+ * \param high Upper bound
+ **/
+void rng_fill_uniform(struct rng *self, float *x, uint32_t length, float low, float high);
+/**
+ * \brief Fill a buffer with normally distributed numbers
+ * \details
+ *   Box-Muller transform of pairs of words. Words are generated and
+ *   transformed in chunks with branch free loops that the compiler can
+ *   vectorize. Two words are used per pair of outputs, an odd length
+ *   discards the last output of its pair.
+ * \param self Stream
+ * \param x Output numbers [length]
+ * \param length Number of values
+ * \param mu Mean of the distribution
+ * \param sigma Standard deviation
+ **/
+void rng_fill_normal(struct rng *self, float *x, uint32_t length, float mu, float sigma);
 /**
  * \brief Compute Gaussian Distribution
  * \details
- * Make sure that you initialize your random number generator to a seed before
- * startup!
+ * Every call keys a stream with two values from rand(), so srand() selects
+ * the sequence of calls as before. rand() is not thread safe, use
+ * rng_fill_normal() with one stream per thread instead.
  * \param x Vector: x[length]
  * \param length length of vector x
  * \param mu Mean of the distribution
@@ -133,3 +213,109 @@ float mean(const float *const x, uint16_t length);
  * \returns Standard deviation of elments in x
  **/
 float stddev(const float *const x, uint16_t length);
+
+/**
+ * \brief Running mean, variance, minimum and maximum of a stream of samples
+ * \details
+ *   Samples are added one at a time or in blocks of any 64 bit length and
+ *   partial results of separate threads or channels can be merged. The
+ *   variance uses Welford's update for single samples and Chan's pairwise
+ *   combination for blocks and merges, which avoids the cancellation of the
+ *   sum of squares formula.
+ *
+ *   Chan, Golub and LeVeque: Updating formulae and a pairwise algorithm for
+ *   computing sample variances, 1979.
+ **/
+struct stats {
+	uint64_t count; // Number of samples
+	float mean; // Mean of the samples
+	float m2; // Sum of squared deviations from the mean
+	float min; // Smallest sample, INFINITY when empty
+	float max; // Largest sample, -INFINITY when empty
+};
+
+/**
+ * \brief Initialize empty statistics
+ * \param self Statistics
+ **/
+void stats_init(struct stats *self);
+/**
+ * \brief Add one sample
+ * \param self Statistics
+ * \param x Sample
+ **/
+void stats_update(struct stats *self, float x);
+/**
+ * \brief Add a block of samples
+ * \details
+ *   The block is processed in chunks whose sums, squared deviations and
+ *   extremes are computed with plain loops the compiler can vectorize, then
+ *   every chunk is merged into the statistics.
+ * \param self Statistics
+ * \param x Samples [length]
+ * \param length Number of samples
+ **/
+void stats_update_block(struct stats *self, const float *const x, uint64_t length);
+/**
+ * \brief Combine the statistics of another set of samples
+ * \param self Statistics to add to
+ * \param other Statistics of the other samples
+ **/
+void stats_merge(struct stats *self, const struct stats *other);
+/**
+ * \brief Sample variance with n - 1 normalization
+ * \param self Statistics
+ * \returns Variance, 0 with fewer than two samples
+ **/
+float stats_variance(const struct stats *self);
+/**
+ * \brief Sample standard deviation, same as stddev() of all samples
+ * \param self Statistics
+ * \returns Standard deviation, 0 with fewer than two samples
+ **/
+float stats_stddev(const struct stats *self);
+
+/**
+ * \brief Streaming quantile estimate with the P-square algorithm
+ * \details
+ *   Tracks one quantile with five markers in constant memory, without
+ *   storing the samples. The estimate is approximate and the markers can not
+ *   be merged, use mcs_histogram from filter.h when partial results of
+ *   several threads must be combined exactly.
+ *
+ *   Jain and Chlamtac: The P-square algorithm for dynamic calculation of
+ *   quantiles and histograms without storing observations, 1985.
+ **/
+struct p2_quantile {
+	float p; // Tracked probability
+	uint64_t count; // Number of samples
+	float q[5]; // Marker heights, the first samples until there are five
+	int64_t n[5]; // Marker positions
+	float offset[5]; // Desired minus actual marker positions
+};
+
+/**
+ * \brief Initialize a quantile estimator
+ * \param self Estimator
+ * \param p Probability in (0, 1), 0.5 for the median
+ **/
+void p2_quantile_init(struct p2_quantile *self, float p);
+/**
+ * \brief Add one sample to a quantile estimator
+ * \param self Estimator
+ * \param x Sample
+ **/
+void p2_quantile_update(struct p2_quantile *self, float x);
+/**
+ * \brief Add a block of samples to a quantile estimator
+ * \param self Estimator
+ * \param x Samples [length]
+ * \param length Number of samples
+ **/
+void p2_quantile_update_block(struct p2_quantile *self, const float *const x, uint64_t length);
+/**
+ * \brief Current quantile estimate
+ * \param self Estimator
+ * \returns Estimate, NaN when there are no samples
+ **/
+float p2_quantile_value(const struct p2_quantile *self);
@@ -0,0 +1,259 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * \brief Compressed sparse row matrix
+ * \details
+ *   Nonzeros of row i are values[row_ptr[i] .. row_ptr[i + 1] - 1] with
+ *   column indices col_idx[] in increasing order. Storage is provided by the
+ *   caller and capacity is the number of entries col_idx and values can hold.
+ **/
+struct sparse_csr {
+	uint16_t rows; // Number of rows
+	uint16_t cols; // Number of columns
+	uint32_t nnz; // Number of stored entries
+	uint32_t capacity; // Size of col_idx and values
+	uint32_t *row_ptr; // Start of every row in col_idx and values [rows + 1]
+	uint16_t *col_idx; // Column of every entry [capacity]
+	float *values; // Value of every entry [capacity]
+};
+
+/**
+ * \brief Compressed sparse column matrix
+ * \details
+ *   Nonzeros of column j are values[col_ptr[j] .. col_ptr[j + 1] - 1] with
+ *   row indices row_idx[] in increasing order. Storage is provided by the
+ *   caller and capacity is the number of entries row_idx and values can hold.
+ **/
+struct sparse_csc {
+	uint16_t rows; // Number of rows
+	uint16_t cols; // Number of columns
+	uint32_t nnz; // Number of stored entries
+	uint32_t capacity; // Size of row_idx and values
+	uint32_t *col_ptr; // Start of every column in row_idx and values [cols + 1]
+	uint16_t *row_idx; // Row of every entry [capacity]
+	float *values; // Value of every entry [capacity]
+};
+
+/**
+ * \brief Initialize an empty CSR matrix on caller provided storage
+ * \param self Matrix to initialize
+ * \param rows Number of rows
+ * \param cols Number of columns
+ * \param row_ptr Row pointer storage [rows + 1]
+ * \param col_idx Column index storage [capacity]
+ * \param values Value storage [capacity]
+ * \param capacity Maximum number of nonzeros
+ * \retval 0 Success
+ * \retval -EINVAL Invalid arguments
+ **/
+int csr_init(struct sparse_csr *self, uint16_t rows, uint16_t cols, uint32_t *row_ptr,
+	     uint16_t *col_idx, float *values, uint32_t capacity);
+/**
+ * \brief Convert a dense matrix to CSR
+ * \details
+ *   Entries with absolute value at or below tolerance are dropped. Use 0 to
+ *   keep every nonzero.
+ * \param self Initialized CSR matrix with the same dimensions as A
+ * \param A Dense row-major matrix [rows*cols]
+ * \param tolerance Drop tolerance
+ * \retval 0 Success
+ * \retval -ENOMEM More nonzeros than capacity
+ **/
+int csr_from_dense(struct sparse_csr *self, const float *const A, float tolerance);
+/**
+ * \brief Expand a CSR matrix to dense row-major storage
+ * \param A Output dense matrix [rows*cols]
+ * \param self CSR matrix
+ **/
+void csr_to_dense(float *A, const struct sparse_csr *self);
+
+/**
+ * \brief Initialize an empty CSC matrix on caller provided storage
+ * \param self Matrix to initialize
+ * \param rows Number of rows
+ * \param cols Number of columns
+ * \param col_ptr Column pointer storage [cols + 1]
+ * \param row_idx Row index storage [capacity]
+ * \param values Value storage [capacity]
+ * \param capacity Maximum number of nonzeros
+ * \retval 0 Success
+ * \retval -EINVAL Invalid arguments
+ **/
+int csc_init(struct sparse_csc *self, uint16_t rows, uint16_t cols, uint32_t *col_ptr,
+	     uint16_t *row_idx, float *values, uint32_t capacity);
+/**
+ * \brief Convert a dense matrix to CSC
+ * \details
+ *   Entries with absolute value at or below tolerance are dropped.
+ * \param self Initialized CSC matrix with the same dimensions as A
+ * \param A Dense row-major matrix [rows*cols]
+ * \param tolerance Drop tolerance
+ * \retval 0 Success
+ * \retval -ENOMEM More nonzeros than capacity
+ **/
+int csc_from_dense(struct sparse_csc *self, const float *const A, float tolerance);
+/**
+ * \brief Convert a CSR matrix to CSC with the same entries
+ * \details
+ *   This is a counting sort over the columns and runs in O(nnz + cols).
+ * \param self Initialized CSC matrix with the same dimensions as A
+ * \param A CSR matrix
+ * \retval 0 Success
+ * \retval -EINVAL Dimensions do not match
+ * \retval -ENOMEM More nonzeros than capacity
+ **/
+int csc_from_csr(struct sparse_csc *self, const struct sparse_csr *A);
+/**
+ * \brief Expand a CSC matrix to dense row-major storage
+ * \param A Output dense matrix [rows*cols]
+ * \param self CSC matrix
+ **/
+void csc_to_dense(float *A, const struct sparse_csc *self);
+
+/**
+ * \brief Sparse matrix vector product y = A*x
+ * \param y Output vector [rows] (must not overlap x)
+ * \param A CSR matrix
+ * \param x Input vector [cols]
+ **/
+void csr_spmv(float *y, const struct sparse_csr *A, const float *const x);
+/**
+ * \brief Sparse transposed matrix vector product y = A'*x
+ * \param y Output vector [cols] (must not overlap x)
+ * \param A CSR matrix
+ * \param x Input vector [rows]
+ **/
+void csr_spmv_transposed(float *y, const struct sparse_csr *A, const float *const x);
+/**
+ * \brief Sparse matrix vector product y = A*x
+ * \param y Output vector [rows] (must not overlap x)
+ * \param A CSC matrix
+ * \param x Input vector [cols]
+ **/
+void csc_spmv(float *y, const struct sparse_csc *A, const float *const x);
+/**
+ * \brief Sparse times dense matrix product C = A*B
+ * \details
+ *   B [cols*column_b]
+ *
+ *   C [rows*column_b]
+ *
+ *   Rows of B are streamed contiguously for every nonzero of A and C is
+ *   accumulated in place, so no copy of the output is kept on the stack.
+ * \param C Output dense matrix (must not overlap B)
+ * \param A CSR matrix
+ * \param B Input dense matrix
+ * \param column_b Number of columns in B
+ **/
+void csr_spmm(float *C, const struct sparse_csr *A, const float *const B, uint16_t column_b);
+
+/**
+ * \brief Solve Lx = b where L is a sparse lower triangular CSR matrix
+ * \details
+ *   Entries above the diagonal are ignored. Use with the L factor of LU or
+ *   Cholesky.
+ * \param x Output vector [rows] (can be same as b)
+ * \param L Lower triangular CSR matrix
+ * \param b Right hand side [rows]
+ * \retval 0 Success
+ * \retval -EINVAL L is not square
+ * \retval -ENOTSUP Zero or missing diagonal entry
+ **/
+int csr_linsolve_lower_triangular(float *x, const struct sparse_csr *L, const float *const b);
+/**
+ * \brief Solve Ux = b where U is a sparse upper triangular CSR matrix
+ * \details
+ *   Entries below the diagonal are ignored. Use with the U factor of LU.
+ * \param x Output vector [rows] (can be same as b)
+ * \param U Upper triangular CSR matrix
+ * \param b Right hand side [rows]
+ * \retval 0 Success
+ * \retval -EINVAL U is not square
+ * \retval -ENOTSUP Zero or missing diagonal entry
+ **/
+int csr_linsolve_upper_triangular(float *x, const struct sparse_csr *U, const float *const b);
+/**
+ * \brief Solve L'x = b where L is a sparse lower triangular CSR matrix
+ * \details
+ *   Rows of L are the columns of L' so this is a column oriented backward
+ *   substitution. Together with csr_linsolve_lower_triangular() it solves
+ *   LL'x = b for a Cholesky factor L without forming L'.
+ * \param x Output vector [rows] (can be same as b)
+ * \param L Lower triangular CSR matrix
+ * \param b Right hand side [rows]
+ * \retval 0 Success
+ * \retval -EINVAL L is not square
+ * \retval -ENOTSUP Zero or missing diagonal entry
+ **/
+int csr_linsolve_lower_triangular_transposed(float *x, const struct sparse_csr *L,
+					     const float *const b);
+
+/**
+ * \brief Linear operator y = A*x for a CSR matrix
+ * \details
+ *   Matches linear_operator_t so a sparse matrix can be passed to the
+ *   iterative solvers in linalg.h.
+ * \param y Output vector [row] (must not overlap x)
+ * \param x Input vector [row]
+ * \param row Number of rows in A
+ * \param ctx CSR matrix as const struct sparse_csr *
+ **/
+void csr_operator(float *y, const float *const x, uint16_t row, void *ctx);
+/**
+ * \brief Incomplete LU factorization without fill-in, ILU(0)
+ * \details
+ *   LU gets the sparsity pattern of A. The strictly lower part holds L with
+ *   an implicit unit diagonal and the rest holds U. Every diagonal entry of A
+ *   must be stored.
+ * \param LU Initialized CSR matrix with capacity for the nonzeros of A (can be same as A)
+ * \param A Square CSR matrix
+ * \retval 0 Success
+ * \retval -EINVAL A is not square or dimensions do not match
+ * \retval -ENOMEM LU is too small
+ * \retval -ENOTSUP Zero pivot or missing diagonal
+ **/
+int csr_ilu0(struct sparse_csr *LU, const struct sparse_csr *A);
+/**
+ * \brief Apply an ILU(0) preconditioner y = inv(LU)*x
+ * \details
+ *   Matches linear_operator_t for use as preconditioner of linsolve_gmres().
+ * \param y Output vector [row] (can be same as x)
+ * \param x Input vector [row]
+ * \param row Size of the system
+ * \param ctx Factor from csr_ilu0() as const struct sparse_csr *
+ **/
+void csr_ilu0_preconditioner(float *y, const float *const x, uint16_t row, void *ctx);
+/**
+ * \brief Incomplete Cholesky factorization without fill-in, IC(0)
+ * \details
+ *   L gets the lower triangle of the symmetric matrix A, diagonal included,
+ *   such that LL' matches A on that pattern.
+ * \param L Initialized CSR matrix with capacity for the lower triangle of A
+ * \param A Symmetric CSR matrix with both triangles stored
+ * \retval 0 Success
+ * \retval -EINVAL A is not square or dimensions do not match
+ * \retval -ENOMEM L is too small
+ * \retval -ENOTSUP A non positive pivot was found
+ **/
+int csr_ic0(struct sparse_csr *L, const struct sparse_csr *A);
+/**
+ * \brief Apply an IC(0) preconditioner y = inv(LL')*x
+ * \details
+ *   Matches linear_operator_t for use as preconditioner of linsolve_cg() and
+ *   linsolve_minres().
+ * \param y Output vector [row] (can be same as x)
+ * \param x Input vector [row]
+ * \param row Size of the system
+ * \param ctx Factor from csr_ic0() as const struct sparse_csr *
+ **/
+void csr_ic0_preconditioner(float *y, const float *const x, uint16_t row, void *ctx);
@@ -35,6 +35,13 @@ int rls(unsigned int NP, unsigned int NZ, unsigned int NZE, float theta[], float
 	float Pq, float forgetting);
 /**
  * \brief Eigensystem Realization Algorithm.
+ * \details
+ *   Only the first row_a singular triplets of the Hankel matrix are needed.
+ *   When row_a is small compared to the number of Hankel columns a
+ *   Lanczos truncated SVD of an FFT based hankel_operator() is used, so the
+ *   Hankel matrices are never formed and memory grows linearly with the
+ *   record length. Otherwise a full decomposition of the dense Hankel
+ *   matrix is computed.
  * \param A [ADIM*ADIM] // System matrix with dimension ADIM*ADIM
  * \param B [ADIM*io_row] // Input matrix with dimension ADIM*inputs_outputs
  * \param C [io_row*ADIM] // Output matrix with dimension inputs_outputs*ADMIN
@@ -45,6 +52,7 @@ int rls(unsigned int NP, unsigned int NZ, unsigned int NZE, float theta[], float
  * \param row_a Rows in A
  * \retval 0 Success
  * \retval -EINVAL Invalid parameters
+ * \retval -ENOTSUP SVD of the Hankel matrix failed
  **/
 int okid_era(float *A, float *B, float *C, uint8_t row_a, const float *const y,
 	     const float *const u, uint16_t io_row, uint16_t io_column);
@@ -66,3 +74,40 @@ int okid_era(float *A, float *B, float *C, uint8_t row_a, const float *const y,
  **/
 int sqr_ukf_id(float d[], float what[], float Re[], float x[], void (*G)(float[], float[], float[]),
 	       float lambda_rls, float Sw[], float alpha, float beta, uint8_t L);
+/**
+ * \brief Model of a batch of parameter sigma points for sqr_ukf_id_batch()
+ * \details
+ *   Sigma point j is the contiguous vector W[j*L .. j*L + L - 1] and its
+ *   model output goes to D[j*L .. j*L + L - 1]. Points are independent, so
+ *   a model can vectorize across them or hand ranges of j to worker threads.
+ * \param D Model outputs [count * L]
+ * \param x State vector [L]
+ * \param W Parameter sigma points [count * L]
+ * \param count Number of sigma points
+ * \param L Number of parameters
+ * \param ctx User context
+ **/
+typedef void (*sqr_ukf_id_model_t)(float *D, const float *const x, const float *const W,
+				   uint16_t count, uint8_t L, void *ctx);
+/**
+ * \brief Square Root Unscented Kalman Filter for parameter estimation with a batched model
+ * \details
+ *   Same as sqr_ukf_id() but G is called once per step with all 2*L + 1
+ *   sigma points instead of once per sigma point.
+ * \param d [L] Measurement parameter (our output)
+ * \param what [L] Estimated parameter (our input)
+ * \param Re [L * L] Measurement noise covariance matrix
+ * \param x [L] State vector
+ * \param G Model of all sigma points
+ * \param ctx User context passed to G
+ * \param lambda_rls Scalar factor 0 <= lambda_rls <= 1, close to 1 like 0.995
+ * \param Sw [L * L] Parameter estimate error covariance
+ * \param alpha Spread of the sigma points around what, 0.01 <= alpha <= 1
+ * \param beta Prior knowledge of the distribution, 2 for Gaussian
+ * \param L Number of parameters
+ * \retval 0 Success
+ * \retval -EINVAL Invalid parameters
+ **/
+int sqr_ukf_id_batch(float d[], float what[], float Re[], const float *const x,
+		     sqr_ukf_id_model_t G, void *ctx, float lambda_rls, float Sw[], float alpha,
+		     float beta, uint8_t L);
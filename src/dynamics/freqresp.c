@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/dynamics.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+int freqresp_init(struct freqresp *self, const float *const A, const float *const B,
+		  const float *const C, uint8_t ADIM, uint8_t RDIM, uint8_t YDIM, float *storage)
+{
+	if (ADIM == 0 || RDIM == 0 || YDIM == 0)
+		return -EINVAL;
+
+	const uint8_t n = ADIM;
+	float *H = storage;
+	float *Bq = H + n * n;
+	float *Cq = Bq + n * RDIM;
+	float v[n];
+
+	self->ADIM = ADIM;
+	self->RDIM = RDIM;
+	self->YDIM = YDIM;
+	self->H = H;
+	self->B = Bq;
+	self->C = Cq;
+	memcpy(H, A, n * n * sizeof(float));
+	memcpy(Bq, B, n * RDIM * sizeof(float));
+	memcpy(Cq, C, YDIM * n * sizeof(float));
+
+	// Reflect column k below the subdiagonal to zero, P = I - 2*v*v'/(v'*v)
+	for (int k = 0; k + 2 < n; k++) {
+		float norm = 0.0f;
+
+		for (uint8_t i = k + 1; i < n; i++)
+			norm += H[i * n + k] * H[i * n + k];
+		norm = sqrtf(norm);
+		if (norm == 0.0f)
+			continue;
+
+		const float alpha = H[(k + 1) * n + k] > 0.0f ? -norm : norm;
+		float vv = 0.0f;
+
+		for (uint8_t i = k + 1; i < n; i++)
+			v[i] = H[i * n + k];
+		v[k + 1] -= alpha;
+		for (uint8_t i = k + 1; i < n; i++)
+			vv += v[i] * v[i];
+		if (vv == 0.0f)
+			continue;
+
+		// H = P*H and B = P*B
+		for (uint8_t j = 0; j < n; j++) {
+			float dot = 0.0f;
+
+			for (uint8_t i = k + 1; i < n; i++)
+				dot += v[i] * H[i * n + j];
+			dot *= 2.0f / vv;
+			for (uint8_t i = k + 1; i < n; i++)
+				H[i * n + j] -= dot * v[i];
+		}
+		for (uint8_t j = 0; j < RDIM; j++) {
+			float dot = 0.0f;
+
+			for (uint8_t i = k + 1; i < n; i++)
+				dot += v[i] * Bq[i * RDIM + j];
+			dot *= 2.0f / vv;
+			for (uint8_t i = k + 1; i < n; i++)
+				Bq[i * RDIM + j] -= dot * v[i];
+		}
+		// H = H*P and C = C*P
+		for (uint8_t i = 0; i < n; i++) {
+			float dot = 0.0f;
+
+			for (uint8_t j = k + 1; j < n; j++)
+				dot += H[i * n + j] * v[j];
+			dot *= 2.0f / vv;
+			for (uint8_t j = k + 1; j < n; j++)
+				H[i * n + j] -= dot * v[j];
+		}
+		for (uint8_t i = 0; i < YDIM; i++) {
+			float dot = 0.0f;
+
+			for (uint8_t j = k + 1; j < n; j++)
+				dot += Cq[i * n + j] * v[j];
+			dot *= 2.0f / vv;
+			for (uint8_t j = k + 1; j < n; j++)
+				Cq[i * n + j] -= dot * v[j];
+		}
+		// Entries below the subdiagonal are zero up to rounding
+		H[(k + 1) * n + k] = alpha;
+		for (uint8_t i = k + 2; i < n; i++)
+			H[i * n + k] = 0.0f;
+	}
+	return 0;
+}
+
+static inline void swap(float *a, float *b)
+{
+	const float t = *a;
+
+	*a = *b;
+	*b = t;
+}
+
+/*
+ * Solve (s*I - H)*X = B for upper Hessenberg H. Only one entry per column is
+ * below the diagonal, so elimination with pivoting between neighbouring rows
+ * takes O(n^2) and the back substitution O(n^2) per column of B.
+ */
+static bool hessenberg_solve(float *Xr, float *Xi, const struct freqresp *self, float sr, float si)
+{
+	const uint8_t n = self->ADIM;
+	const uint8_t m = self->RDIM;
+	float Mr[n * n], Mi[n * n];
+
+	for (uint8_t i = 0; i < n; i++) {
+		for (uint8_t j = 0; j < n; j++) {
+			Mr[i * n + j] = -self->H[i * n + j];
+			Mi[i * n + j] = 0.0f;
+		}
+		Mr[i * n + i] += sr;
+		Mi[i * n + i] += si;
+	}
+	for (uint16_t i = 0; i < n * m; i++) {
+		Xr[i] = self->B[i];
+		Xi[i] = 0.0f;
+	}
+
+	for (uint8_t k = 0; k + 1 < n; k++) {
+		const uint8_t l = k + 1;
+
+		if (hypotf(Mr[l * n + k], Mi[l * n + k]) > hypotf(Mr[k * n + k], Mi[k * n + k])) {
+			for (uint8_t j = k; j < n; j++) {
+				swap(&Mr[k * n + j], &Mr[l * n + j]);
+				swap(&Mi[k * n + j], &Mi[l * n + j]);
+			}
+			for (uint8_t j = 0; j < m; j++) {
+				swap(&Xr[k * m + j], &Xr[l * m + j]);
+				swap(&Xi[k * m + j], &Xi[l * m + j]);
+			}
+		}
+
+		const float pr = Mr[k * n + k], pi = Mi[k * n + k];
+		const float d = pr * pr + pi * pi;
+
+		if (d == 0.0f)
+			return false;
+
+		// f = M[l][k] / M[k][k]
+		const float ar = Mr[l * n + k], ai = Mi[l * n + k];
+		const float fr = (ar * pr + ai * pi) / d;
+		const float fi = (ai * pr - ar * pi) / d;
+
+		for (uint8_t j = l; j < n; j++) {
+			Mr[l * n + j] -= fr * Mr[k * n + j] - fi * Mi[k * n + j];
+			Mi[l * n + j] -= fr * Mi[k * n + j] + fi * Mr[k * n + j];
+		}
+		for (uint8_t j = 0; j < m; j++) {
+			Xr[l * m + j] -= fr * Xr[k * m + j] - fi * Xi[k * m + j];
+			Xi[l * m + j] -= fr * Xi[k * m + j] + fi * Xr[k * m + j];
+		}
+	}
+
+	for (int i = n - 1; i >= 0; i--) {
+		const float pr = Mr[i * n + i], pi = Mi[i * n + i];
+		const float d = pr * pr + pi * pi;
+
+		if (d == 0.0f)
+			return false;
+		for (uint8_t j = 0; j < m; j++) {
+			float sumr = Xr[i * m + j], sumi = Xi[i * m + j];
+
+			for (uint8_t k = i + 1; k < n; k++) {
+				sumr -= Mr[i * n + k] * Xr[k * m + j] - Mi[i * n + k] * Xi[k * m + j];
+				sumi -= Mr[i * n + k] * Xi[k * m + j] + Mi[i * n + k] * Xr[k * m + j];
+			}
+			Xr[i * m + j] = (sumr * pr + sumi * pi) / d;
+			Xi[i * m + j] = (sumi * pr - sumr * pi) / d;
+		}
+	}
+	return true;
+}
+
+void freqresp(const struct freqresp *self, float *mag, float *phase, const float *const w,
+	      uint16_t count, float sample_time)
+{
+	const uint8_t n = self->ADIM;
+	const uint8_t m = self->RDIM;
+	const uint8_t p = self->YDIM;
+	float Xr[n * m], Xi[n * m];
+
+	for (uint16_t f = 0; f < count; f++) {
+		float *G_mag = &mag[f * p * m];
+		float *G_phase = &phase[f * p * m];
+		float sr = 0.0f, si = w[f];
+
+		if (sample_time > 0.0f) {
+			sr = cosf(w[f] * sample_time);
+			si = sinf(w[f] * sample_time);
+		}
+
+		if (!hessenberg_solve(Xr, Xi, self, sr, si)) {
+			for (uint16_t i = 0; i < p * m; i++) {
+				G_mag[i] = INFINITY;
+				G_phase[i] = 0.0f;
+			}
+			continue;
+		}
+
+		// G = C*X
+		for (uint8_t i = 0; i < p; i++) {
+			for (uint8_t j = 0; j < m; j++) {
+				float gr = 0.0f, gi = 0.0f;
+
+				for (uint8_t k = 0; k < n; k++) {
+					gr += self->C[i * n + k] * Xr[k * m + j];
+					gi += self->C[i * n + k] * Xi[k * m + j];
+				}
+				G_mag[i * m + j] = hypotf(gr, gi);
+				G_phase[i * m + j] = atan2f(gi, gr);
+			}
+		}
+	}
+}
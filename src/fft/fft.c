@@ -0,0 +1,449 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/fft.h"
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*
+ * Split n into radix stages, 4 and 2 first since they need no
+ * multiplications inside the butterfly. Returns false when a prime factor
+ * is larger than FFT_MAX_RADIX or there are too many stages.
+ */
+static bool factorize(uint32_t n, uint8_t *factors, uint8_t *count)
+{
+	*count = 0;
+	while (n % 4 == 0 && *count < FFT_MAX_FACTORS) {
+		factors[(*count)++] = 4;
+		n /= 4;
+	}
+	for (uint32_t p = 2; p <= FFT_MAX_RADIX && *count < FFT_MAX_FACTORS; p++) {
+		while (n % p == 0 && *count < FFT_MAX_FACTORS) {
+			factors[(*count)++] = (uint8_t)p;
+			n /= p;
+		}
+	}
+	return n == 1;
+}
+
+static void twiddles(float *w, uint32_t n)
+{
+	for (uint32_t k = 0; k < n; k++) {
+		const float angle = -2.0f * (float)M_PI * (float)k / (float)n;
+
+		w[2 * k] = cosf(angle);
+		w[2 * k + 1] = sinf(angle);
+	}
+}
+
+static void stockham(struct fft_plan *self, uint32_t N, float *x, bool inverse);
+
+uint32_t fft_size(uint32_t n)
+{
+	uint32_t size = 1;
+
+	while (size < n)
+		size <<= 1;
+	return size;
+}
+
+uint32_t fft_plan_storage_size(uint32_t n)
+{
+	uint8_t factors[FFT_MAX_FACTORS];
+	uint8_t count;
+
+	if (n == 0)
+		return 0;
+	if (factorize(n, factors, &count))
+		return 4 * n;
+
+	// Chirp, then twiddles, work, filter and buffer of the convolution length
+	return 2 * n + 8 * fft_size(2 * n - 1);
+}
+
+int fft_plan_init(struct fft_plan *self, uint32_t n, float *storage)
+{
+	if (n == 0)
+		return -EINVAL;
+
+	memset(self, 0, sizeof(*self));
+	self->n = n;
+
+	if (factorize(n, self->factors, &self->factor_count)) {
+		self->twiddle = storage;
+		self->work = storage + 2 * n;
+		twiddles(self->twiddle, n);
+		return 0;
+	}
+
+	// Bluestein: X[k] = c[k] * sum x[j]*c[j]*conj(c[k - j]) with c[k] = exp(-pi*i*k^2/n)
+	const uint32_t m = fft_size(2 * n - 1);
+
+	if (!factorize(m, self->factors, &self->factor_count))
+		return -ENOTSUP;
+
+	self->m = m;
+	self->chirp = storage;
+	self->twiddle = self->chirp + 2 * n;
+	self->work = self->twiddle + 2 * m;
+	self->filter = self->work + 2 * m;
+	self->buffer = self->filter + 2 * m;
+	twiddles(self->twiddle, m);
+
+	for (uint32_t k = 0; k < n; k++) {
+		// k^2 modulo 2n keeps the angle accurate for long transforms
+		const uint32_t k2 = (uint32_t)(((uint64_t)k * k) % (2 * (uint64_t)n));
+		const float angle = -(float)M_PI * (float)k2 / (float)n;
+
+		self->chirp[2 * k] = cosf(angle);
+		self->chirp[2 * k + 1] = sinf(angle);
+	}
+
+	memset(self->filter, 0, 2 * m * sizeof(float));
+	for (uint32_t k = 0; k < n; k++) {
+		self->filter[2 * k] = self->chirp[2 * k];
+		self->filter[2 * k + 1] = -self->chirp[2 * k + 1];
+		if (k > 0) {
+			self->filter[2 * (m - k)] = self->chirp[2 * k];
+			self->filter[2 * (m - k) + 1] = -self->chirp[2 * k + 1];
+		}
+	}
+
+	stockham(self, m, self->filter, false);
+
+	return 0;
+}
+
+/*
+ * One Stockham stage of radix r. The input is viewed as r blocks of length
+ * m*s and the output gets the r butterfly results of every group next to
+ * each other, so no bit reversal is needed at the end. All s elements of a
+ * group share the twiddle factor and are contiguous in memory.
+ */
+static void stage(float *y, const float *const x, const float *const w, uint32_t N, uint8_t r,
+		  uint32_t m, uint32_t s, float sign)
+{
+	for (uint32_t p = 0; p < m; p++) {
+		if (r == 2) {
+			const float wr = w[2 * (p * s)];
+			const float wi = sign * w[2 * (p * s) + 1];
+
+			for (uint32_t q = 0; q < s; q++) {
+				const float *a = &x[2 * (q + s * p)];
+				const float *b = &x[2 * (q + s * (p + m))];
+				float *y0 = &y[2 * (q + s * (2 * p))];
+				float *y1 = &y[2 * (q + s * (2 * p + 1))];
+				const float dr = a[0] - b[0];
+				const float di = a[1] - b[1];
+
+				y0[0] = a[0] + b[0];
+				y0[1] = a[1] + b[1];
+				y1[0] = dr * wr - di * wi;
+				y1[1] = dr * wi + di * wr;
+			}
+		} else if (r == 4) {
+			const float w1r = w[2 * (p * s)], w1i = sign * w[2 * (p * s) + 1];
+			const float w2r = w[2 * (2 * p * s)], w2i = sign * w[2 * (2 * p * s) + 1];
+			const float w3r = w[2 * (3 * p * s)], w3i = sign * w[2 * (3 * p * s) + 1];
+
+			for (uint32_t q = 0; q < s; q++) {
+				const float *a0 = &x[2 * (q + s * p)];
+				const float *a1 = &x[2 * (q + s * (p + m))];
+				const float *a2 = &x[2 * (q + s * (p + 2 * m))];
+				const float *a3 = &x[2 * (q + s * (p + 3 * m))];
+				float *y0 = &y[2 * (q + s * (4 * p))];
+				float *y1 = &y[2 * (q + s * (4 * p + 1))];
+				float *y2 = &y[2 * (q + s * (4 * p + 2))];
+				float *y3 = &y[2 * (q + s * (4 * p + 3))];
+				const float t0r = a0[0] + a2[0], t0i = a0[1] + a2[1];
+				const float t1r = a0[0] - a2[0], t1i = a0[1] - a2[1];
+				const float t2r = a1[0] + a3[0], t2i = a1[1] + a3[1];
+				// (a1 - a3) * -i for the forward transform, * i for the inverse
+				const float t3r = sign * (a1[1] - a3[1]);
+				const float t3i = -sign * (a1[0] - a3[0]);
+				const float b1r = t1r + t3r, b1i = t1i + t3i;
+				const float b2r = t0r - t2r, b2i = t0i - t2i;
+				const float b3r = t1r - t3r, b3i = t1i - t3i;
+
+				y0[0] = t0r + t2r;
+				y0[1] = t0i + t2i;
+				y1[0] = b1r * w1r - b1i * w1i;
+				y1[1] = b1r * w1i + b1i * w1r;
+				y2[0] = b2r * w2r - b2i * w2i;
+				y2[1] = b2r * w2i + b2i * w2r;
+				y3[0] = b3r * w3r - b3i * w3i;
+				y3[1] = b3r * w3i + b3i * w3r;
+			}
+		} else {
+			// Direct DFT of length r for the remaining small primes
+			const uint32_t root = N / r;
+
+			for (uint32_t q = 0; q < s; q++) {
+				for (uint8_t k = 0; k < r; k++) {
+					float sr = 0.0f, si = 0.0f;
+
+					for (uint8_t j = 0; j < r; j++) {
+						const float *a = &x[2 * (q + s * (p + j * m))];
+						const uint32_t e = root * ((j * k) % r);
+						const float er = w[2 * e];
+						const float ei = sign * w[2 * e + 1];
+
+						sr += a[0] * er - a[1] * ei;
+						si += a[0] * ei + a[1] * er;
+					}
+
+					const uint32_t e = p * k * s;
+					const float wr = w[2 * e];
+					const float wi = sign * w[2 * e + 1];
+					float *out = &y[2 * (q + s * (r * p + k))];
+
+					out[0] = sr * wr - si * wi;
+					out[1] = sr * wi + si * wr;
+				}
+			}
+		}
+	}
+}
+
+// Mixed radix transform of length N, without scaling
+static void stockham(struct fft_plan *self, uint32_t N, float *x, bool inverse)
+{
+	const float sign = inverse ? -1.0f : 1.0f;
+	float *in = x;
+	float *out = self->work;
+	uint32_t n = N;
+	uint32_t s = 1;
+
+	for (uint8_t f = 0; f < self->factor_count; f++) {
+		const uint8_t r = self->factors[f];
+		const uint32_t m = n / r;
+
+		stage(out, in, self->twiddle, N, r, m, s, sign);
+
+		float *tmp = in;
+
+		in = out;
+		out = tmp;
+		n = m;
+		s *= r;
+	}
+	if (in != x)
+		memcpy(x, in, 2 * N * sizeof(float));
+}
+
+static void bluestein(struct fft_plan *self, float *x)
+{
+	const uint32_t n = self->n;
+	const uint32_t m = self->m;
+	float *b = self->buffer;
+
+	memset(b, 0, 2 * m * sizeof(float));
+	for (uint32_t k = 0; k < n; k++) {
+		const float cr = self->chirp[2 * k], ci = self->chirp[2 * k + 1];
+
+		b[2 * k] = x[2 * k] * cr - x[2 * k + 1] * ci;
+		b[2 * k + 1] = x[2 * k] * ci + x[2 * k + 1] * cr;
+	}
+
+	stockham(self, m, b, false);
+	for (uint32_t k = 0; k < m; k++) {
+		const float fr = self->filter[2 * k], fi = self->filter[2 * k + 1];
+		const float br = b[2 * k], bi = b[2 * k + 1];
+
+		b[2 * k] = br * fr - bi * fi;
+		b[2 * k + 1] = br * fi + bi * fr;
+	}
+	stockham(self, m, b, true);
+
+	const float scale = 1.0f / (float)m;
+
+	for (uint32_t k = 0; k < n; k++) {
+		const float cr = self->chirp[2 * k], ci = self->chirp[2 * k + 1];
+		const float br = b[2 * k] * scale, bi = b[2 * k + 1] * scale;
+
+		x[2 * k] = br * cr - bi * ci;
+		x[2 * k + 1] = br * ci + bi * cr;
+	}
+}
+
+void fft_forward(struct fft_plan *self, float *x)
+{
+	if (self->m)
+		bluestein(self, x);
+	else
+		stockham(self, self->n, x, false);
+}
+
+void fft_inverse(struct fft_plan *self, float *x)
+{
+	const uint32_t n = self->n;
+	const float scale = 1.0f / (float)n;
+
+	if (self->m) {
+		// inverse(x) = conj(forward(conj(x))) / n
+		for (uint32_t k = 0; k < n; k++)
+			x[2 * k + 1] = -x[2 * k + 1];
+		bluestein(self, x);
+		for (uint32_t k = 0; k < n; k++) {
+			x[2 * k] *= scale;
+			x[2 * k + 1] *= -scale;
+		}
+		return;
+	}
+
+	stockham(self, n, x, true);
+	for (uint32_t k = 0; k < 2 * n; k++)
+		x[k] *= scale;
+}
+
+void fft_forward_batch(struct fft_plan *self, float *x, uint16_t count, uint32_t stride)
+{
+	for (uint16_t c = 0; c < count; c++)
+		fft_forward(self, &x[c * stride]);
+}
+
+void fft_inverse_batch(struct fft_plan *self, float *x, uint16_t count, uint32_t stride)
+{
+	for (uint16_t c = 0; c < count; c++)
+		fft_inverse(self, &x[c * stride]);
+}
+
+uint32_t fft_real_plan_storage_size(uint32_t n)
+{
+	if (n == 0)
+		return 0;
+	if (n & 1)
+		return fft_plan_storage_size(n) + 2 * n;
+	return fft_plan_storage_size(n / 2) + n;
+}
+
+int fft_real_plan_init(struct fft_real_plan *self, uint32_t n, float *storage)
+{
+	if (n == 0)
+		return -EINVAL;
+
+	self->n = n;
+	if (n & 1) {
+		self->twiddle = NULL;
+		self->buffer = storage;
+		return fft_plan_init(&self->plan, n, storage + 2 * n);
+	}
+
+	self->buffer = NULL;
+	self->twiddle = storage;
+	// Split step factors exp(-2*pi*i*k/n) for k < n/2
+	for (uint32_t k = 0; k < n / 2; k++) {
+		const float angle = -2.0f * (float)M_PI * (float)k / (float)n;
+
+		self->twiddle[2 * k] = cosf(angle);
+		self->twiddle[2 * k + 1] = sinf(angle);
+	}
+	return fft_plan_init(&self->plan, n / 2, storage + n);
+}
+
+void fft_forward_real(struct fft_real_plan *self, float *X, const float *const x)
+{
+	const uint32_t n = self->n;
+
+	if (n & 1) {
+		float *z = self->buffer;
+
+		for (uint32_t k = 0; k < n; k++) {
+			z[2 * k] = x[k];
+			z[2 * k + 1] = 0.0f;
+		}
+		fft_forward(&self->plan, z);
+		memcpy(X, z, 2 * (n / 2 + 1) * sizeof(float));
+		return;
+	}
+
+	// Pack even samples as real and odd samples as imaginary parts
+	const uint32_t h = n / 2;
+
+	if (X != x)
+		memcpy(X, x, n * sizeof(float));
+	fft_forward(&self->plan, X);
+
+	// Split Z into the transforms E of the even and O of the odd samples, X = E + W^k*O
+	X[2 * h] = X[0];
+	X[2 * h + 1] = X[1];
+	for (uint32_t k = 0; k <= h / 2; k++) {
+		const uint32_t j = h - k;
+		const float zr = X[2 * k], zi = X[2 * k + 1];
+		const float cr = X[2 * j], ci = -X[2 * j + 1];
+		const float er = 0.5f * (zr + cr), ei = 0.5f * (zi + ci);
+		// O = (Z - conj(Z[h - k])) / 2i
+		const float or_ = 0.5f * (zi - ci), oi = -0.5f * (zr - cr);
+		const float wr = self->twiddle[2 * (k % h)], wi = self->twiddle[2 * (k % h) + 1];
+		const float tr = wr * or_ - wi * oi, ti = wr * oi + wi * or_;
+
+		// Bin h - k is the mirror: E[h-k] = conj(E[k]), O[h-k] = conj(O[k]), W^(h-k) = -conj(W^k)
+		X[2 * k] = er + tr;
+		X[2 * k + 1] = ei + ti;
+		X[2 * j] = er - tr;
+		X[2 * j + 1] = -(ei - ti);
+	}
+}
+
+void fft_inverse_real(struct fft_real_plan *self, float *x, const float *const X)
+{
+	const uint32_t n = self->n;
+
+	if (n & 1) {
+		float *z = self->buffer;
+
+		z[0] = X[0];
+		z[1] = 0.0f;
+		for (uint32_t k = 1; k <= n / 2; k++) {
+			z[2 * k] = X[2 * k];
+			z[2 * k + 1] = X[2 * k + 1];
+			z[2 * (n - k)] = X[2 * k];
+			z[2 * (n - k) + 1] = -X[2 * k + 1];
+		}
+		fft_inverse(&self->plan, z);
+		for (uint32_t k = 0; k < n; k++)
+			x[k] = z[2 * k];
+		return;
+	}
+
+	// Z = E + i*O with E and O recovered from the mirrored bins
+	const uint32_t h = n / 2;
+	const float first_r = X[0], last_r = X[2 * h];
+
+	for (uint32_t k = 0; k <= h / 2; k++) {
+		const uint32_t j = h - k;
+		const float ar = k == 0 ? first_r : X[2 * k];
+		const float ai = k == 0 ? 0.0f : X[2 * k + 1];
+		const float br = k == 0 ? last_r : X[2 * j];
+		const float bi = k == 0 ? 0.0f : -X[2 * j + 1];
+		const float er = 0.5f * (ar + br), ei = 0.5f * (ai + bi);
+		const float dr = 0.5f * (ar - br), di = 0.5f * (ai - bi);
+		// O = D * conj(W^k)
+		const float wr = self->twiddle[2 * (k % h)], wi = -self->twiddle[2 * (k % h) + 1];
+		const float or_ = dr * wr - di * wi, oi = dr * wi + di * wr;
+
+		x[2 * k] = er - oi;
+		x[2 * k + 1] = ei + or_;
+		if (j != k && j < h) {
+			// E[j] = conj(E[k]), O[j] = conj(O[k])
+			x[2 * j] = er + oi;
+			x[2 * j + 1] = -ei + or_;
+		}
+	}
+	fft_inverse(&self->plan, x);
+}
+
+void fft_forward_real_batch(struct fft_real_plan *self, float *X, const float *const x,
+			    uint16_t count, uint32_t stride_X, uint32_t stride_x)
+{
+	for (uint16_t c = 0; c < count; c++)
+		fft_forward_real(self, &X[c * stride_X], &x[c * stride_x]);
+}
@@ -0,0 +1,256 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/filter.h"
+
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+int ekf_init(struct ekf *self, sqr_ukf_transition_t F, void *F_ctx, sqr_ukf_measurement_t H,
+	     void *H_ctx, uint8_t L, uint8_t M, uint8_t iterations, const float *const Q,
+	     const float *const R, float *storage)
+{
+	if (L == 0 || M == 0 || iterations == 0 || F == NULL || H == NULL)
+		return -EINVAL;
+
+	self->L = L;
+	self->M = M;
+	self->iterations = iterations;
+	self->step = sqrtf(FLT_EPSILON);
+	self->Q = Q;
+	self->R = R;
+	self->F = F;
+	self->F_ctx = F_ctx;
+	self->H = H;
+	self->H_ctx = H_ctx;
+	self->JF = NULL;
+	self->JH = NULL;
+
+	self->x = storage;
+	storage += L;
+	self->P = storage;
+	storage += L * L;
+	self->prior = storage;
+	storage += L * L;
+	self->J = storage;
+	storage += L * L;
+	self->T = storage;
+	storage += L * L;
+	self->X = storage;
+	storage += (L + 1) * L;
+	self->Z = storage;
+	storage += (L + 1) * L;
+	self->Y = storage;
+	storage += (L + 1) * M;
+	self->Hj = storage;
+	storage += M * L;
+	self->xp = storage;
+	storage += L;
+	self->xi = storage;
+	storage += L;
+	self->k = storage;
+
+	memset(self->x, 0, L * sizeof(float));
+	memset(self->P, 0, L * L * sizeof(float));
+	for (uint8_t i = 0; i < L; i++)
+		self->P[i * L + i] = 1.0f;
+	return 0;
+}
+
+void ekf_set_jacobians(struct ekf *self, ekf_jacobian_t JF, ekf_jacobian_t JH)
+{
+	self->JF = JF;
+	self->JH = JH;
+}
+
+void ekf_reset(struct ekf *self, const float *const x, const float *const P)
+{
+	memcpy(self->x, x, self->L * sizeof(float));
+	memcpy(self->P, P, self->L * self->L * sizeof(float));
+}
+
+/*
+ * Points x and x + h_j*e_j one after the other in X, returns the steps in h.
+ * With an analytic Jacobian only the first point is used.
+ */
+static void create_points(struct ekf *self, const float *const x, float *h)
+{
+	const uint8_t L = self->L;
+
+	memcpy(self->X, x, L * sizeof(float));
+	for (uint8_t j = 0; j < L; j++) {
+		float *p = &self->X[(j + 1) * L];
+		const float scale = fabsf(x[j]) > 1.0f ? fabsf(x[j]) : 1.0f;
+
+		memcpy(p, x, L * sizeof(float));
+		p[j] += self->step * scale;
+		// Use the step that is representable after rounding
+		h[j] = p[j] - x[j];
+	}
+}
+
+// J[i, j] = (Z[j + 1, i] - Z[0, i]) / h[j] for points Z of rows elements
+static void jacobian_fd(float *J, const float *const Z, const float *const h, uint8_t rows,
+			uint8_t L)
+{
+	for (uint8_t i = 0; i < rows; i++)
+		for (uint8_t j = 0; j < L; j++)
+			J[i * L + j] = (Z[(j + 1) * rows + i] - Z[i]) / h[j];
+}
+
+void ekf_predict(struct ekf *self, const float *const u)
+{
+	const uint8_t L = self->L;
+	float *J = self->J;
+	float *T = self->T;
+	float *P = self->P;
+	float *h = self->k;
+
+	/* State and Jacobian of F from one batched call */
+	if (self->JF) {
+		self->F(self->Z, self->x, u, 1, L, self->F_ctx);
+		self->JF(J, self->x, u, self->F_ctx);
+	} else {
+		create_points(self, self->x, h);
+		self->F(self->Z, self->X, u, L + 1, L, self->F_ctx);
+		jacobian_fd(J, self->Z, h, L, L);
+	}
+	memcpy(self->x, self->Z, L * sizeof(float));
+
+	/* P = J*P*J' + Q */
+	for (uint8_t i = 0; i < L; i++) {
+		for (uint8_t j = 0; j < L; j++) {
+			float sum = 0.0f;
+
+			for (uint8_t c = 0; c < L; c++)
+				sum += J[i * L + c] * P[c * L + j];
+			T[i * L + j] = sum;
+		}
+	}
+	for (uint8_t i = 0; i < L; i++) {
+		for (uint8_t j = i; j < L; j++) {
+			float sum = 0.0f;
+
+			for (uint8_t c = 0; c < L; c++)
+				sum += T[i * L + c] * J[j * L + c];
+			P[i * L + j] = sum + 0.5f * (self->Q[i * L + j] + self->Q[j * L + i]);
+			P[j * L + i] = P[i * L + j];
+		}
+	}
+}
+
+/*
+ * Joseph form update with one scalar measurement row a and variance r,
+ * P = (I - k*a)*P*(I - k*a)' + r*k*k', applied as the rank one steps
+ * B = P - k*(P*a')' and P = B - (B*a')*k' + r*k*k'.
+ */
+static int scalar_update(struct ekf *self, const float *const a, float innovation, float r)
+{
+	const uint8_t L = self->L;
+	float *P = self->P;
+	float *p = self->T;
+	float *q = self->Z;
+	float *k = self->k;
+	float s = r;
+
+	for (uint8_t i = 0; i < L; i++) {
+		float sum = 0.0f;
+
+		for (uint8_t j = 0; j < L; j++)
+			sum += P[i * L + j] * a[j];
+		p[i] = sum;
+		s += a[i] * sum;
+	}
+	if (!(s > 0.0f))
+		return -ENOTSUP;
+
+	for (uint8_t i = 0; i < L; i++) {
+		k[i] = p[i] / s;
+		self->x[i] += k[i] * innovation;
+	}
+
+	// B = (I - k*a)*P, p is row a*P since P is symmetric
+	for (uint8_t i = 0; i < L; i++)
+		for (uint8_t j = 0; j < L; j++)
+			P[i * L + j] -= k[i] * p[j];
+
+	// q = B*a'
+	for (uint8_t i = 0; i < L; i++) {
+		float sum = 0.0f;
+
+		for (uint8_t j = 0; j < L; j++)
+			sum += P[i * L + j] * a[j];
+		q[i] = sum;
+	}
+
+	// P = B*(I - k*a)' + r*k*k'
+	for (uint8_t i = 0; i < L; i++)
+		for (uint8_t j = 0; j < L; j++)
+			P[i * L + j] += r * k[i] * k[j] - q[i] * k[j];
+
+	// Remove the rounding asymmetry
+	for (uint8_t i = 0; i < L; i++) {
+		for (uint8_t j = i + 1; j < L; j++) {
+			const float m = 0.5f * (P[i * L + j] + P[j * L + i]);
+
+			P[i * L + j] = m;
+			P[j * L + i] = m;
+		}
+	}
+	return 0;
+}
+
+int ekf_update(struct ekf *self, const float *const y)
+{
+	const uint8_t L = self->L;
+	const uint8_t M = self->M;
+	float *Hj = self->Hj;
+
+	memcpy(self->xp, self->x, L * sizeof(float));
+	memcpy(self->prior, self->P, L * L * sizeof(float));
+
+	for (uint8_t it = 0; it < self->iterations; it++) {
+		/* Linearize H around the latest estimate */
+		memcpy(self->xi, self->x, L * sizeof(float));
+		if (self->JH) {
+			self->H(self->Y, self->xi, 1, L, M, self->H_ctx);
+			self->JH(Hj, self->xi, NULL, self->H_ctx);
+		} else {
+			float *h = self->k;
+
+			create_points(self, self->xi, h);
+			self->H(self->Y, self->X, L + 1, L, M, self->H_ctx);
+			jacobian_fd(Hj, self->Y, h, M, L);
+		}
+
+		/* Restart from the prediction with the new linearization */
+		memcpy(self->x, self->xp, L * sizeof(float));
+		memcpy(self->P, self->prior, L * L * sizeof(float));
+
+		/* y ~ H(xi) + Hj*(x - xi), applied one measurement at a time */
+		for (uint8_t m = 0; m < M; m++) {
+			const float *a = &Hj[m * L];
+			float innovation = y[m] - self->Y[m];
+
+			for (uint8_t j = 0; j < L; j++)
+				innovation -= a[j] * (self->x[j] - self->xi[j]);
+
+			const int r = scalar_update(self, a, innovation, self->R[m]);
+
+			if (r != 0) {
+				// Leave the prediction as it was before the update
+				memcpy(self->x, self->xp, L * sizeof(float));
+				memcpy(self->P, self->prior, L * L * sizeof(float));
+				return r;
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/fft.h"
+#include "control/filter.h"
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define FIR_MIN_BLOCK 16 // Smaller partitions spend more time in FFT overhead than they save
+
+uint32_t fir_block_size(uint32_t taps)
+{
+	if (taps <= FIR_DIRECT_TAPS)
+		return 0;
+	const uint32_t block = fft_size((uint32_t)(2.0f * sqrtf((float)taps)));
+
+	return block < FIR_MIN_BLOCK ? FIR_MIN_BLOCK : block;
+}
+
+static bool fir_direct(uint32_t taps, uint32_t block)
+{
+	return block == 0 || block >= taps;
+}
+
+uint32_t fir_storage_size(uint32_t taps, uint16_t channels, uint32_t block)
+{
+	if (fir_direct(taps, block))
+		return taps + 2 * channels * taps;
+
+	const uint32_t partitions = (taps - 1) / block; // ceil((taps - block) / block)
+	const uint32_t bins = 2 * (block + 1);
+
+	return block + 2 * channels * block + fft_real_plan_storage_size(2 * block) +
+	       partitions * bins + partitions * channels * bins + channels * 2 * block +
+	       channels * bins;
+}
+
+int fir_init(struct fir *self, const float *const h, uint32_t taps, uint16_t channels,
+	     uint32_t block, float *storage)
+{
+	if (taps == 0 || channels == 0)
+		return -EINVAL;
+
+	const bool direct = fir_direct(taps, block);
+
+	self->taps = taps;
+	self->channels = channels;
+	self->block = direct ? 0 : block;
+	self->length = direct ? taps : block;
+	self->partitions = direct ? 0 : (taps - 1) / block;
+
+	self->head = storage;
+	storage += self->length;
+	self->delay = storage;
+	storage += 2 * channels * self->length;
+
+	// Reversed so the dot product runs forward through the delay line
+	for (uint32_t k = 0; k < self->length; k++)
+		self->head[k] = h[self->length - 1 - k];
+
+	if (!direct) {
+		const uint32_t bins = 2 * (block + 1);
+		const uint32_t plan_size = fft_real_plan_storage_size(2 * block);
+		const int r = fft_real_plan_init(&self->plan, 2 * block, storage);
+
+		if (r != 0)
+			return r;
+		storage += plan_size;
+		self->kernel = storage;
+		storage += self->partitions * bins;
+		self->spectrum = storage;
+		storage += self->partitions * channels * bins;
+		self->input = storage;
+		storage += channels * 2 * block;
+		self->output = storage;
+
+		// Partition p holds taps (p + 1)*B .. (p + 2)*B - 1 padded with B zeros
+		float *padded = self->input;
+
+		for (uint32_t p = 0; p < self->partitions; p++) {
+			const uint32_t first = (p + 1) * block;
+			const uint32_t count = taps - first < block ? taps - first : block;
+
+			memset(padded, 0, 2 * block * sizeof(float));
+			memcpy(padded, &h[first], count * sizeof(float));
+			fft_forward_real(&self->plan, &self->kernel[p * bins], padded);
+		}
+	}
+
+	fir_reset(self);
+	return 0;
+}
+
+void fir_reset(struct fir *self)
+{
+	const uint16_t channels = self->channels;
+
+	memset(self->delay, 0, 2 * channels * self->length * sizeof(float));
+	self->position = 0;
+	self->fill = 0;
+	self->slot = 0;
+	if (self->block == 0)
+		return;
+
+	const uint32_t bins = 2 * (self->block + 1);
+
+	memset(self->spectrum, 0, self->partitions * channels * bins * sizeof(float));
+	memset(self->input, 0, channels * 2 * self->block * sizeof(float));
+	memset(self->output, 0, channels * bins * sizeof(float));
+}
+
+// Contribution of the partitioned taps to the next block of every channel
+static void fir_partitions(struct fir *self)
+{
+	const uint16_t channels = self->channels;
+	const uint32_t block = self->block;
+	const uint32_t bins = 2 * (block + 1);
+	const uint32_t partitions = self->partitions;
+
+	// Input frames are the two most recent complete blocks of each channel
+	self->slot = self->slot + 1 == partitions ? 0 : self->slot + 1;
+	float *newest = &self->spectrum[self->slot * channels * bins];
+
+	fft_forward_real_batch(&self->plan, newest, self->input, channels, bins, 2 * block);
+
+	for (uint16_t c = 0; c < channels; c++) {
+		float *Y = &self->output[c * bins];
+		uint32_t slot = self->slot;
+
+		memset(Y, 0, bins * sizeof(float));
+		for (uint32_t p = 0; p < partitions; p++) {
+			const float *H = &self->kernel[p * bins];
+			const float *X = &self->spectrum[(slot * channels + c) * bins];
+
+			for (uint32_t k = 0; k < bins; k += 2) {
+				Y[k] += H[k] * X[k] - H[k + 1] * X[k + 1];
+				Y[k + 1] += H[k] * X[k + 1] + H[k + 1] * X[k];
+			}
+			slot = slot == 0 ? partitions - 1 : slot - 1;
+		}
+		// The last B samples of the circular convolution are the valid ones
+		fft_inverse_real(&self->plan, Y, Y);
+
+		float *in = &self->input[c * 2 * block];
+
+		memcpy(in, &in[block], block * sizeof(float));
+	}
+}
+
+void fir_process(struct fir *self, float *y, const float *const x, uint64_t frames)
+{
+	const uint16_t channels = self->channels;
+	const uint32_t length = self->length;
+	const uint32_t block = self->block;
+
+	for (uint64_t t = 0; t < frames; t++) {
+		if (block != 0 && self->fill == 0)
+			fir_partitions(self);
+
+		const uint32_t position = self->position;
+
+		for (uint16_t c = 0; c < channels; c++) {
+			const float v = x[t * channels + c];
+			float *d = &self->delay[c * 2 * length];
+
+			// Both copies keep the last length samples contiguous at d[position + 1]
+			d[position] = v;
+			d[position + length] = v;
+
+			const float *w = &d[position + 1];
+			float sum = 0.0f;
+
+			for (uint32_t k = 0; k < length; k++)
+				sum += self->head[k] * w[k];
+
+			if (block != 0) {
+				sum += self->output[c * 2 * (block + 1) + block + self->fill];
+				self->input[c * 2 * block + block + self->fill] = v;
+			}
+			y[t * channels + c] = sum;
+		}
+
+		self->position = position + 1 == length ? 0 : position + 1;
+		if (block != 0 && ++self->fill == block)
+			self->fill = 0;
+	}
+}
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/filter.h"
+
+#include <errno.h>
+#include <math.h>
+
+int lowpass_init(struct lowpass *self, float cutoff, float sample_rate)
+{
+	if (!(cutoff > 0.0f) || !(sample_rate > 0.0f))
+		return -EINVAL;
+
+	// Exact discretization of the pole of 1 / (s / (2*pi*cutoff) + 1)
+	self->alpha = 1.0f - expf(-2.0f * (float)M_PI * cutoff / sample_rate);
+	self->y = 0.0f;
+	return 0;
+}
+
+void lowpass_reset(struct lowpass *self, float y)
+{
+	self->y = y;
+}
+
+float lowpass_step(struct lowpass *self, float x)
+{
+	self->y += self->alpha * (x - self->y);
+	return self->y;
+}
+
+void lowpass_process_block(struct lowpass *self, float *y, const float *const x, uint32_t length)
+{
+	for (uint32_t i = 0; i < length; i++)
+		y[i] = lowpass_step(self, x[i]);
+}
+
+static int biquad_init(struct biquad *self, float b0, float b1, float b2, float a0, float a1,
+		       float a2)
+{
+	self->b0 = b0 / a0;
+	self->b1 = b1 / a0;
+	self->b2 = b2 / a0;
+	self->a1 = a1 / a0;
+	self->a2 = a2 / a0;
+	biquad_reset(self, 0.0f);
+	return 0;
+}
+
+int biquad_lowpass_init(struct biquad *self, float cutoff, float q, float sample_rate)
+{
+	if (!(cutoff > 0.0f && cutoff < 0.5f * sample_rate) || !(q > 0.0f))
+		return -EINVAL;
+
+	const float w0 = 2.0f * (float)M_PI * cutoff / sample_rate;
+	const float c = cosf(w0);
+	const float alpha = sinf(w0) / (2.0f * q);
+
+	return biquad_init(self, (1.0f - c) / 2.0f, 1.0f - c, (1.0f - c) / 2.0f, 1.0f + alpha,
+			   -2.0f * c, 1.0f - alpha);
+}
+
+int biquad_notch_init(struct biquad *self, float center, float q, float sample_rate)
+{
+	if (!(center > 0.0f && center < 0.5f * sample_rate) || !(q > 0.0f))
+		return -EINVAL;
+
+	const float w0 = 2.0f * (float)M_PI * center / sample_rate;
+	const float c = cosf(w0);
+	const float alpha = sinf(w0) / (2.0f * q);
+
+	return biquad_init(self, 1.0f, -2.0f * c, 1.0f, 1.0f + alpha, -2.0f * c, 1.0f - alpha);
+}
+
+void biquad_reset(struct biquad *self, float x)
+{
+	const float den = 1.0f + self->a1 + self->a2;
+	const float y = den != 0.0f ? x * (self->b0 + self->b1 + self->b2) / den : 0.0f;
+
+	// Steady state of the transposed direct form II for input x and output y
+	self->z2 = self->b2 * x - self->a2 * y;
+	self->z1 = self->b1 * x - self->a1 * y + self->z2;
+}
+
+float biquad_step(struct biquad *self, float x)
+{
+	const float y = self->b0 * x + self->z1;
+
+	self->z1 = self->b1 * x - self->a1 * y + self->z2;
+	self->z2 = self->b2 * x - self->a2 * y;
+	return y;
+}
+
+void biquad_process_block(struct biquad *self, float *y, const float *const x, uint32_t length)
+{
+	for (uint32_t i = 0; i < length; i++)
+		y[i] = biquad_step(self, x[i]);
+}
@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/filter.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+int mcs_histogram_init(struct mcs_histogram *self, uint8_t row_x, uint16_t bins,
+		       const float *const low, const float *const high, uint32_t *storage)
+{
+	if (row_x == 0 || bins == 0)
+		return -EINVAL;
+	for (uint8_t i = 0; i < row_x; i++)
+		if (!(high[i] > low[i]))
+			return -EINVAL;
+
+	self->row_x = row_x;
+	self->bins = bins;
+	self->low = low;
+	self->high = high;
+	self->count = storage;
+	memset(storage, 0, MCS_HISTOGRAM_STORAGE_SIZE(row_x, bins) * sizeof(uint32_t));
+	return 0;
+}
+
+void mcs_histogram_collect(struct mcs_histogram *self, const float *const x)
+{
+	const uint32_t stride = (uint32_t)self->bins + 2;
+
+	for (uint8_t i = 0; i < self->row_x; i++) {
+		uint32_t *count = &self->count[i * stride];
+
+		if (isnan(x[i]))
+			continue;
+		if (x[i] < self->low[i]) {
+			count[0]++;
+		} else if (x[i] >= self->high[i]) {
+			count[stride - 1]++;
+		} else {
+			const float width = (self->high[i] - self->low[i]) / (float)self->bins;
+			uint32_t bin = (uint32_t)((x[i] - self->low[i]) / width);
+
+			// Rounding can put values just below high one bin too far
+			if (bin >= self->bins)
+				bin = self->bins - 1;
+			count[1 + bin]++;
+		}
+	}
+}
+
+int mcs_histogram_merge(struct mcs_histogram *self, const struct mcs_histogram *other)
+{
+	if (self->row_x != other->row_x || self->bins != other->bins)
+		return -EINVAL;
+	for (uint8_t i = 0; i < self->row_x; i++)
+		if (self->low[i] != other->low[i] || self->high[i] != other->high[i])
+			return -EINVAL;
+
+	const uint32_t size = MCS_HISTOGRAM_STORAGE_SIZE(self->row_x, self->bins);
+
+	for (uint32_t k = 0; k < size; k++)
+		self->count[k] += other->count[k];
+	return 0;
+}
+
+uint64_t mcs_histogram_total(const struct mcs_histogram *self, uint8_t variable)
+{
+	const uint32_t stride = (uint32_t)self->bins + 2;
+	const uint32_t *count = &self->count[variable * stride];
+	uint64_t total = 0;
+
+	for (uint32_t k = 0; k < stride; k++)
+		total += count[k];
+	return total;
+}
+
+float mcs_histogram_mode(const struct mcs_histogram *self, uint8_t variable)
+{
+	const uint32_t stride = (uint32_t)self->bins + 2;
+	const uint32_t *count = &self->count[variable * stride + 1];
+	const float width = (self->high[variable] - self->low[variable]) / (float)self->bins;
+	uint16_t best = 0;
+
+	for (uint16_t k = 1; k < self->bins; k++)
+		if (count[k] > count[best])
+			best = k;
+	if (count[best] == 0)
+		return NAN;
+	return self->low[variable] + ((float)best + 0.5f) * width;
+}
+
+float mcs_histogram_quantile(const struct mcs_histogram *self, uint8_t variable, float p)
+{
+	const uint32_t stride = (uint32_t)self->bins + 2;
+	const uint32_t *count = &self->count[variable * stride];
+	const float low = self->low[variable];
+	const float high = self->high[variable];
+	const float width = (high - low) / (float)self->bins;
+	const uint64_t total = mcs_histogram_total(self, variable);
+
+	if (total == 0)
+		return NAN;
+	if (p < 0.0f)
+		p = 0.0f;
+	if (p > 1.0f)
+		p = 1.0f;
+
+	// Rank of the quantile among the total samples, float would lose the
+	// counts above 2^24
+	const double rank = (double)p * (double)total;
+	uint64_t below = count[0];
+
+	if (rank <= (double)below && below > 0)
+		return low;
+	for (uint16_t k = 0; k < self->bins; k++) {
+		const uint32_t c = count[1 + k];
+
+		if (c > 0 && rank <= (double)(below + c)) {
+			const double fraction = (rank - (double)below) / (double)c;
+
+			return low + ((float)k + (float)fraction) * width;
+		}
+		below += c;
+	}
+	return high;
+}
+
+void mcs_histogram_quantile_bounds(const struct mcs_histogram *self, uint8_t variable, float p,
+				   float z, float *lower, float *upper)
+{
+	const float n = (float)mcs_histogram_total(self, variable);
+	const float spread = n > 0.0f ? z * sqrtf(p * (1.0f - p) / n) : 0.0f;
+
+	*lower = mcs_histogram_quantile(self, variable, p - spread);
+	*upper = mcs_histogram_quantile(self, variable, p + spread);
+}
+
+void mcs_run(struct mcs_histogram *self, mcs_simulation_t simulate, void *ctx, uint64_t seed,
+	     uint64_t first, uint64_t count)
+{
+	float x[self->row_x];
+	struct rng rng;
+
+	for (uint64_t sample = first; sample - first < count; sample++) {
+		// Low bits select the stream, high bits a far away part of it
+		rng_init(&rng, seed, (uint32_t)sample);
+		rng_seek(&rng, (sample >> 32) << 48);
+		simulate(x, sample, &rng, ctx);
+		mcs_histogram_collect(self, x);
+	}
+}
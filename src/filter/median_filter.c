@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/filter.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+int median_filter_init(struct median_filter *self, float *storage, uint16_t length)
+{
+	if (length == 0)
+		return -EINVAL;
+
+	self->buffer = storage;
+	self->sorted = storage + length;
+	self->length = length;
+	median_filter_reset(self);
+	return 0;
+}
+
+void median_filter_reset(struct median_filter *self)
+{
+	self->index = 0;
+	self->count = 0;
+}
+
+// First position in sorted[0 .. count - 1] with a value not below x
+static uint16_t lower_bound(const float *const sorted, uint16_t count, float x)
+{
+	uint16_t low = 0, high = count;
+
+	while (low < high) {
+		const uint16_t mid = (uint16_t)((low + high) / 2);
+
+		if (sorted[mid] < x)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return low;
+}
+
+// Median of the sorted window
+static float median(const struct median_filter *self)
+{
+	const uint16_t mid = self->count / 2;
+
+	if (self->count % 2)
+		return self->sorted[mid];
+	return 0.5f * (self->sorted[mid - 1] + self->sorted[mid]);
+}
+
+float median_filter_step(struct median_filter *self, float x)
+{
+	float *sorted = self->sorted;
+	uint16_t count = self->count;
+
+	// NaN has no place in the sorted window, keep the current median
+	if (isnan(x))
+		return count ? median(self) : x;
+
+	if (count == self->length) {
+		// Drop the oldest sample from the sorted window
+		const float old = self->buffer[self->index];
+		const uint16_t i = lower_bound(sorted, count, old);
+
+		count--;
+		memmove(&sorted[i], &sorted[i + 1], (count - i) * sizeof(float));
+	}
+
+	const uint16_t j = lower_bound(sorted, count, x);
+
+	memmove(&sorted[j + 1], &sorted[j], (count - j) * sizeof(float));
+	sorted[j] = x;
+	self->count = count + 1;
+	self->buffer[self->index] = x;
+	if (++self->index == self->length)
+		self->index = 0;
+	return median(self);
+}
+
+void median_filter_process_block(struct median_filter *self, float *y, const float *const x,
+				 uint32_t length)
+{
+	for (uint32_t i = 0; i < length; i++)
+		y[i] = median_filter_step(self, x[i]);
+}
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/filter.h"
+
+#include <errno.h>
+
+int moving_average_init(struct moving_average *self, float *buffer, uint16_t length)
+{
+	if (length == 0)
+		return -EINVAL;
+
+	self->buffer = buffer;
+	self->length = length;
+	moving_average_reset(self);
+	return 0;
+}
+
+void moving_average_reset(struct moving_average *self)
+{
+	self->index = 0;
+	self->count = 0;
+	self->sum = 0.0f;
+}
+
+float moving_average_step(struct moving_average *self, float x)
+{
+	if (self->count == self->length)
+		self->sum -= self->buffer[self->index];
+	else
+		self->count++;
+	self->buffer[self->index] = x;
+	self->sum += x;
+
+	if (++self->index == self->length) {
+		self->index = 0;
+		// Fresh sum once per window keeps the cost O(1) per sample on average
+		if (self->count == self->length) {
+			float sum = 0.0f;
+
+			for (uint16_t i = 0; i < self->length; i++)
+				sum += self->buffer[i];
+			self->sum = sum;
+		}
+	}
+	return self->sum / (float)self->count;
+}
+
+void moving_average_process_block(struct moving_average *self, float *y, const float *const x,
+				  uint32_t length)
+{
+	for (uint32_t i = 0; i < length; i++)
+		y[i] = moving_average_step(self, x[i]);
+}
@@ -0,0 +1,273 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/filter.h"
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*
+ * Turn analog prototype poles (for a cutoff of 1 rad/s) into digital
+ * sections. Pole k of the upper half plane is pr[k] + i*pi[k], a real pole
+ * has pi[k] = 0 and gives a first order section.
+ */
+static int design(float *coeff, const float *const pr, const float *const pi, uint8_t order,
+		  enum sos_response response, float cutoff, float sample_rate, float gain)
+{
+	const float fs2 = 2.0f * sample_rate;
+	// Prewarped analog cutoff so the digital cutoff lands on the requested frequency
+	const float wc = fs2 * tanf((float)M_PI * cutoff / sample_rate);
+	const float sign = response == SOS_LOWPASS ? 1.0f : -1.0f;
+	const uint8_t sections = SOS_SECTIONS(order);
+
+	for (uint8_t k = 0; k < sections; k++) {
+		float *c = &coeff[5 * k];
+		float qr, qi;
+
+		// Low pass scales the prototype, high pass inverts it
+		if (response == SOS_LOWPASS) {
+			qr = wc * pr[k];
+			qi = wc * pi[k];
+		} else {
+			const float d = pr[k] * pr[k] + pi[k] * pi[k];
+
+			qr = wc * pr[k] / d;
+			qi = -wc * pi[k] / d;
+		}
+
+		// Bilinear transform z = (fs2 + q) / (fs2 - q)
+		const float nr = fs2 + qr, ni = qi;
+		const float dr = fs2 - qr, di = -qi;
+		const float dd = dr * dr + di * di;
+		const float zr = (nr * dr + ni * di) / dd;
+		const float zi = (ni * dr - nr * di) / dd;
+
+		if (pi[k] == 0.0f) {
+			// Zero at z = -1 for low pass and z = 1 for high pass
+			c[0] = 1.0f;
+			c[1] = sign;
+			c[2] = 0.0f;
+			c[3] = -zr;
+			c[4] = 0.0f;
+		} else {
+			c[0] = 1.0f;
+			c[1] = 2.0f * sign;
+			c[2] = 1.0f;
+			c[3] = -2.0f * zr;
+			c[4] = zr * zr + zi * zi;
+		}
+
+		// Unity gain at z = 1 for low pass and z = -1 for high pass
+		const float num = c[0] + sign * c[1] + c[2];
+		const float den = 1.0f + sign * c[3] + c[4];
+		const float scale = (k == 0 ? gain : 1.0f) * den / num;
+
+		c[0] *= scale;
+		c[1] *= scale;
+		c[2] *= scale;
+	}
+	return sections;
+}
+
+static bool valid(uint8_t order, float cutoff, float sample_rate)
+{
+	return order > 0 && cutoff > 0.0f && cutoff < 0.5f * sample_rate;
+}
+
+int sos_butterworth(float *coeff, uint8_t order, enum sos_response response, float cutoff,
+		    float sample_rate)
+{
+	if (!valid(order, cutoff, sample_rate))
+		return -EINVAL;
+
+	const uint8_t sections = SOS_SECTIONS(order);
+	float pr[sections], pi[sections];
+
+	// Poles on the left half of the unit circle, the real one last for odd orders
+	for (uint8_t k = 0; k < sections; k++) {
+		const float theta = (float)M_PI * (float)(2 * k + 1) / (float)(2 * order);
+
+		pr[k] = -sinf(theta);
+		pi[k] = cosf(theta);
+		if (2 * k + 1 == order) {
+			pr[k] = -1.0f;
+			pi[k] = 0.0f;
+		}
+	}
+	return design(coeff, pr, pi, order, response, cutoff, sample_rate, 1.0f);
+}
+
+int sos_chebyshev1(float *coeff, uint8_t order, enum sos_response response, float ripple,
+		   float cutoff, float sample_rate)
+{
+	if (!valid(order, cutoff, sample_rate) || !(ripple > 0.0f))
+		return -EINVAL;
+
+	const uint8_t sections = SOS_SECTIONS(order);
+	const float epsilon = sqrtf(powf(10.0f, ripple / 10.0f) - 1.0f);
+	const float mu = asinhf(1.0f / epsilon) / (float)order;
+	float pr[sections], pi[sections];
+
+	// Butterworth poles squeezed onto an ellipse
+	for (uint8_t k = 0; k < sections; k++) {
+		const float theta = (float)M_PI * (float)(2 * k + 1) / (float)(2 * order);
+
+		pr[k] = -sinhf(mu) * sinf(theta);
+		pi[k] = coshf(mu) * cosf(theta);
+		if (2 * k + 1 == order)
+			pi[k] = 0.0f;
+	}
+
+	// Even orders start at the bottom of the ripple
+	const float gain = order % 2 ? 1.0f : 1.0f / sqrtf(1.0f + epsilon * epsilon);
+
+	return design(coeff, pr, pi, order, response, cutoff, sample_rate, gain);
+}
+
+int sos_filter_init(struct sos_filter *self, const float *const coeff, uint8_t sections,
+		    uint16_t channels, float *state)
+{
+	if (sections == 0 || channels == 0)
+		return -EINVAL;
+
+	self->sections = sections;
+	self->channels = channels;
+	self->coeff = coeff;
+	self->state = state;
+	sos_filter_reset(self);
+	return 0;
+}
+
+void sos_filter_reset(struct sos_filter *self)
+{
+	memset(self->state, 0, SOS_STATE_SIZE(self->sections, self->channels) * sizeof(float));
+}
+
+// Filter one frame of all channels in place
+static void step(struct sos_filter *self, float *v)
+{
+	const uint16_t channels = self->channels;
+
+	for (uint8_t k = 0; k < self->sections; k++) {
+		const float *c = &self->coeff[5 * k];
+		const float b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+		float *z1 = &self->state[2 * k * channels];
+		float *z2 = z1 + channels;
+
+		for (uint16_t ch = 0; ch < channels; ch++) {
+			const float in = v[ch];
+			const float out = b0 * in + z1[ch];
+
+			z1[ch] = b1 * in - a1 * out + z2[ch];
+			z2[ch] = b2 * in - a2 * out;
+			v[ch] = out;
+		}
+	}
+}
+
+void sos_filter_process(struct sos_filter *self, float *y, const float *const x, uint64_t frames)
+{
+	const uint16_t channels = self->channels;
+
+	for (uint64_t t = 0; t < frames; t++) {
+		float *v = &y[t * channels];
+
+		if (v != &x[t * channels])
+			memcpy(v, &x[t * channels], channels * sizeof(float));
+		step(self, v);
+	}
+}
+
+// State of every section in steady state for a constant input v per channel
+static void steady_state(struct sos_filter *self, const float *const v)
+{
+	const uint16_t channels = self->channels;
+	float level = 1.0f;
+
+	for (uint8_t k = 0; k < self->sections; k++) {
+		const float *c = &self->coeff[5 * k];
+		const float den = 1.0f + c[3] + c[4];
+		float *z1 = &self->state[2 * k * channels];
+		float *z2 = z1 + channels;
+
+		// A pole at z = 1 has no steady state
+		if (den == 0.0f) {
+			memset(z1, 0, 2 * channels * sizeof(float));
+			level = 0.0f;
+			continue;
+		}
+
+		// Unit step: y = gain, z2 = b2 - a2*y, z1 = b1 - a1*y + z2
+		const float gain = (c[0] + c[1] + c[2]) / den;
+		const float s2 = c[2] - c[4] * gain;
+		const float s1 = c[1] - c[3] * gain + s2;
+
+		for (uint16_t ch = 0; ch < channels; ch++) {
+			z1[ch] = level * s1 * v[ch];
+			z2[ch] = level * s2 * v[ch];
+		}
+		level *= gain;
+	}
+}
+
+void sos_filtfilt(struct sos_filter *self, float *y, const float *const x, uint64_t frames)
+{
+	const uint16_t channels = self->channels;
+	uint32_t pad = 3 * (2 * (uint32_t)self->sections + 1);
+
+	if (frames == 0)
+		return;
+	if (pad > frames - 1)
+		pad = (uint32_t)(frames - 1);
+
+	const uint64_t last = frames - 1;
+	float first[channels], end[channels], v[channels];
+	// Samples needed by the end reflection, saved before y overwrites them
+	float tail[(pad + 1) * channels];
+	// Forward output of the end reflection, where the backward pass starts
+	float reflection[pad * channels + 1];
+
+	memcpy(first, x, sizeof(first));
+	memcpy(end, &x[last * channels], sizeof(end));
+	memcpy(tail, &x[(last - pad) * channels], sizeof(tail));
+
+	// Forward pass: reflection 2*x[0] - x[pad .. 1], then the signal
+	for (uint16_t ch = 0; ch < channels; ch++)
+		v[ch] = 2.0f * first[ch] - x[pad * channels + ch];
+	steady_state(self, v);
+	for (uint32_t j = pad; j >= 1; j--) {
+		for (uint16_t ch = 0; ch < channels; ch++)
+			v[ch] = 2.0f * first[ch] - x[j * channels + ch];
+		step(self, v);
+	}
+	sos_filter_process(self, y, x, frames);
+	// Reflection 2*x[last] - x[last - 1 .. last - pad]
+	for (uint32_t j = 1; j <= pad; j++) {
+		float *r = &reflection[(j - 1) * channels];
+
+		for (uint16_t ch = 0; ch < channels; ch++)
+			r[ch] = 2.0f * end[ch] - tail[(pad - j) * channels + ch];
+		step(self, r);
+	}
+
+	// Backward pass from the end of the reflection to the first sample
+	if (pad > 0)
+		steady_state(self, &reflection[(pad - 1) * channels]);
+	else
+		steady_state(self, &y[last * channels]);
+	for (uint32_t j = pad; j >= 1; j--) {
+		memcpy(v, &reflection[(j - 1) * channels], sizeof(v));
+		step(self, v);
+	}
+	for (uint64_t t = frames; t-- > 0;)
+		step(self, &y[t * channels]);
+
+	sos_filter_reset(self);
+}
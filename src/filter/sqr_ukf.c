@@ -44,50 +44,42 @@ static void create_sigma_point_matrix(float X[], float x[], float S[], float alp
 	float lambda = alpha * alpha * ((float)L + kappa) - (float)L;
 	float gamma = sqrtf((float)L + lambda);
 
-	/* Insert first column in X */
+	/* Sigma points are stored one after the other, insert the first point in X */
 	for (uint8_t i = 0; i < L; i++)
-		X[i * N] = x[i];
+		X[i] = x[i];
 
-	/* Insert in to the middle of the columns - Positive */
+	/* Insert the middle points - Positive */
 	for (uint8_t j = 1; j < K; j++)
 		for (uint8_t i = 0; i < L; i++)
-			X[i * N + j] = x[i] + gamma * S[i * L + j - 1];
+			X[j * L + i] = x[i] + gamma * S[i * L + j - 1];
 
-	/* Insert in the rest of the columns - Negative */
+	/* Insert the rest of the points - Negative */
 	for (uint8_t j = K; j < N; j++)
 		for (uint8_t i = 0; i < L; i++)
-			X[i * N + j] = x[i] - gamma * S[i * L + j - K];
+			X[j * L + i] = x[i] - gamma * S[i * L + j - K];
 }
 
-static void compute_transistion_function(float Xstar[], float X[], float u[],
-					 void (*F)(float[], float[], float[]), uint8_t L)
-{
-	/* Create the size N */
-	uint8_t N = 2 * L + 1;
-
-	/* Create the derivative state and state vector */
-	float dx[L];
-	float x[L];
-
-	/* Call the F transition function with X matrix */
-	for (uint8_t j = 0; j < N; j++) {
-		/* Fill the state vector x with every row from X */
-		for (uint8_t i = 0; i < L; i++)
-			x[i] = X[i * N + j];
+struct point_transition {
+	void (*F)(float dx[], float x[], float u[]);
+	float *u;
+};
 
-		/* Call the transition function */
-		F(dx, x, u);
+// Calls a transition function of one sigma point for each point of the batch
+static void transition_each(float *dX, const float *const X, const float *const u, uint16_t count,
+			    uint8_t L, void *ctx)
+{
+	(void)u;
+	struct point_transition *pt = (struct point_transition *)ctx;
 
-		/* Get dx into Xstar */
-		for (uint8_t i = 0; i < L; i++)
-			Xstar[i * N + j] = dx[i];
-	}
+	// X is scratch of sqr_ukf_batch() that is rebuilt after the transition, no copy is needed
+	for (uint16_t j = 0; j < count; j++)
+		pt->F(&dX[j * L], (float *)&X[j * L], pt->u);
 }
 
 /**
  * \brief Multiply x = W * X
  * \param x Vector [L * 1]
- * \param X Matrix [L * N];
+ * \param X Sigma points [N * L], one point per row
  * \param W Weights vector [(2 * L + 1) * 1]
  * \param L Size
  **/
@@ -102,7 +94,7 @@ static void multiply_sigma_point_matrix_to_weights(float x[], float X[], float W
 	/* Multiply x = W*X */
 	for (uint8_t j = 0; j < N; j++) {
 		for (uint8_t i = 0; i < L; i++) {
-			x[i] += W[j] * X[i * N + j];
+			x[i] += W[j] * X[j * L + i];
 		}
 	}
 }
@@ -110,8 +102,7 @@ static void multiply_sigma_point_matrix_to_weights(float x[], float X[], float W
 static void create_state_estimation_error_covariance_matrix(float S[], float W[], float X[],
 							    float x[], float R[], uint8_t L)
 {
-	/* Create the size N, M and K */
-	uint8_t N = 2 * L + 1;
+	/* Create the size M and K */
 	uint8_t M = 2 * L + L;
 	uint8_t K = 2 * L;
 
@@ -119,21 +110,19 @@ static void create_state_estimation_error_covariance_matrix(float S[], float W[]
 	float weight1 = sqrtf(fabsf(W[1]));
 
 	/* Create [Q, R_] = qr(A') */
-	float AT[L * M];
+	float AT[M * L];
 	float Q[M * M];
 	float R_[M * L];
 
+	/* A' has one sigma point per row like X, so it is filled without a transpose */
 	for (uint8_t j = 0; j < K; j++) {
 		for (uint8_t i = 0; i < L; i++) {
-			AT[i * M + j] = weight1 * (X[i * N + j + 1] - x[i]);
+			AT[j * L + i] = weight1 * (X[(j + 1) * L + i] - x[i]);
 		}
 	}
 	for (uint8_t j = K; j < M; j++)
 		for (uint8_t i = 0; i < L; i++)
-			AT[i * M + j] = sqrtf(R[i * L + j - K]);
-
-	/* We need to do transpose on A according to the SR-UKF paper */
-	tran(AT, AT, L, M);
+			AT[j * L + i] = sqrtf(R[i * L + j - K]);
 
 	/* Solve [Q, R_] = qr(A') but we only need R_ matrix */
 	qr(AT, Q, R_, M, L, true);
@@ -145,7 +134,7 @@ static void create_state_estimation_error_covariance_matrix(float S[], float W[]
 	float b[L];
 
 	for (uint8_t i = 0; i < L; i++)
-		b[i] = X[i * N] - x[i];
+		b[i] = X[i] - x[i];
 
 	bool rank_one_update = W[0] < 0.0f ? false : true;
 
@@ -164,35 +153,29 @@ static void H(float Y[], float X[], uint8_t L)
 static void create_state_cross_covariance_matrix(float P[], float W[], float X[], float Y[],
 						 float x[], float y[], uint8_t L)
 {
-	/* Create the size N and K */
+	/* Create the size N */
 	uint8_t N = 2 * L + 1;
-	uint8_t K = 2 * L;
 
 	/* clear P */
-	memset(P, 0, K * sizeof(float));
+	memset(P, 0, L * L * sizeof(float));
 
-	/* Subtract the matrices */
+	/* Subtract the means */
 	for (uint8_t j = 0; j < N; j++) {
 		for (uint8_t i = 0; i < L; i++) {
-			X[i * N + j] -= x[i];
-			Y[i * N + j] -= y[i];
+			X[j * L + i] -= x[i];
+			Y[j * L + i] -= y[i];
 		}
 	}
 
-	/* Create diagonal matrix */
-	float diagonal_W[N * N];
-
-	memset(diagonal_W, 0, N * N * sizeof(float));
-	for (uint8_t i = 0; i < N; i++)
-		diagonal_W[i * N + i] = W[i];
-
-	/* Do P = X*diagonal_W*Y' */
-	tran(Y, Y, L, N);
-
-	float diagonal_WY[N * L];
+	/* Do P = X'*diag(W)*Y with one sigma point per row of X and Y */
+	for (uint8_t j = 0; j < N; j++) {
+		for (uint8_t i = 0; i < L; i++) {
+			const float wx = W[j] * X[j * L + i];
 
-	mul(diagonal_WY, diagonal_W, Y, N, N, N, L);
-	mul(P, X, diagonal_WY, L, N, N, L);
+			for (uint8_t k = 0; k < L; k++)
+				P[i * L + k] += wx * Y[j * L + k];
+		}
+	}
 }
 
 static void update_state_covarariance_matrix_and_state_estimation_vector(float S[], float xhat[],
@@ -246,6 +229,14 @@ static void update_state_covarariance_matrix_and_state_estimation_vector(float S
 
 int sqr_ukf(float y[], float xhat[], float Rn[], float Rv[], float u[],
 	    void (*F)(float[], float[], float[]), float S[], float alpha, float beta, uint8_t L)
+{
+	struct point_transition pt = { .F = F, .u = u };
+
+	return sqr_ukf_batch(y, xhat, Rn, Rv, u, transition_each, &pt, S, alpha, beta, L);
+}
+
+int sqr_ukf_batch(float y[], float xhat[], float Rn[], float Rv[], const float *const u,
+		  sqr_ukf_transition_t F, void *ctx, float S[], float alpha, float beta, uint8_t L)
 {
 	if (L == 0) {
 		// L can not be zero
@@ -266,14 +257,14 @@ int sqr_ukf(float y[], float xhat[], float Rn[], float Rv[], float u[],
 	create_weights(Wc, Wm, alpha, beta, kappa, L);
 
 	/* Predict: Create sigma point matrix for F function  */
-	float X[L * N];
+	float X[N * L];
 
 	create_sigma_point_matrix(X, xhat, S, alpha, kappa, L);
 
 	/* Predict: Compute the transition function F */
-	float Xstar[L * N];
+	float Xstar[N * L];
 
-	compute_transistion_function(Xstar, X, u, F, L);
+	F(Xstar, X, u, N, L, ctx);
 
 	/* Predict: Multiply sigma points to weights for xhat */
 	multiply_sigma_point_matrix_to_weights(xhat, Xstar, Wm, L);
@@ -288,7 +279,7 @@ int sqr_ukf(float y[], float xhat[], float Rn[], float Rv[], float u[],
 	create_sigma_point_matrix(X, xhat, S, alpha, kappa, L);
 
 	/* Predict: Compute the observability function H */
-	float Y[L * N];
+	float Y[N * L];
 
 	H(Y, X, L);
 
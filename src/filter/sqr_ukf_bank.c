@@ -0,0 +1,357 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/filter.h"
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*
+ * Every loop over the filters of the bank is innermost and contiguous.
+ * Branches inside those loops are selects, so they do not stop the
+ * compiler from vectorizing them.
+ */
+
+int sqr_ukf_bank_init(struct sqr_ukf_bank *self, sqr_ukf_bank_transition_t F, void *F_ctx,
+		      sqr_ukf_bank_measurement_t H, void *H_ctx, uint8_t L, uint8_t M,
+		      uint16_t count, float alpha, float beta, float kappa, const float *const Sv,
+		      const float *const Sn, float *storage)
+{
+	if (L == 0 || M == 0 || count == 0 || F == NULL || (H == NULL && M != L))
+		return -EINVAL;
+
+	const uint16_t N = 2 * (uint16_t)L + 1;
+	const uint32_t n = count;
+	const float lambda = alpha * alpha * ((float)L + kappa) - (float)L;
+
+	if (!((float)L + lambda > 0.0f))
+		return -EINVAL;
+
+	self->L = L;
+	self->M = M;
+	self->count = count;
+	self->F = F;
+	self->F_ctx = F_ctx;
+	self->H = H;
+	self->H_ctx = H_ctx;
+	self->Sv = Sv;
+	self->Sn = Sn;
+
+	self->Wm = storage;
+	storage += N;
+	self->Wc = storage;
+	storage += N;
+	self->x = storage;
+	storage += L * n;
+	self->S = storage;
+	storage += L * L * n;
+	self->X = storage;
+	storage += N * L * n;
+	self->Xs = storage;
+	storage += N * L * n;
+	self->Y = storage;
+	storage += N * M * n;
+	self->A = storage;
+	storage += (3 * L * L + (2 * L + M) * M) * n;
+	self->Sy = storage;
+	storage += M * M * n;
+	self->K = storage;
+	storage += L * M * n;
+	self->yhat = storage;
+	storage += M * n;
+	self->v = storage;
+	storage += (L + M) * n;
+	self->t = storage;
+
+	self->gamma = sqrtf((float)L + lambda);
+	self->Wm[0] = lambda / ((float)L + lambda);
+	self->Wc[0] = self->Wm[0] + 1.0f - alpha * alpha + beta;
+	for (uint16_t j = 1; j < N; j++) {
+		self->Wm[j] = 0.5f / ((float)L + lambda);
+		self->Wc[j] = self->Wm[j];
+	}
+
+	memset(self->x, 0, L * n * sizeof(float));
+	memset(self->S, 0, L * L * n * sizeof(float));
+	for (uint8_t i = 0; i < L; i++)
+		for (uint32_t b = 0; b < n; b++)
+			self->S[(i * L + i) * n + b] = 1.0f;
+	return 0;
+}
+
+void sqr_ukf_bank_reset(struct sqr_ukf_bank *self, uint16_t index, const float *const x,
+			const float *const S)
+{
+	const uint8_t L = self->L;
+	const uint32_t n = self->count;
+
+	for (uint8_t i = 0; i < L; i++)
+		self->x[i * n + index] = x[i];
+	for (uint16_t i = 0; i < L * L; i++)
+		self->S[i * n + index] = S[i];
+}
+
+// Sigma points x, x + gamma*S(k, :)', x - gamma*S(k, :)' of every filter
+static void create_sigma_points(const struct sqr_ukf_bank *self)
+{
+	const uint8_t L = self->L;
+	const uint32_t n = self->count;
+	const float gamma = self->gamma;
+	const float *x = self->x;
+
+	memcpy(self->X, x, L * n * sizeof(float));
+	for (uint8_t k = 0; k < L; k++) {
+		float *plus = &self->X[(1 + k) * L * n];
+		float *minus = &self->X[(1 + L + k) * L * n];
+		const float *s = &self->S[k * L * n];
+
+		for (uint32_t e = 0; e < L * n; e++) {
+			plus[e] = x[e] + gamma * s[e];
+			minus[e] = x[e] - gamma * s[e];
+		}
+	}
+}
+
+// Weighted mean of points vectors of size elements, all filters at once
+static void weighted_mean(float *mean, const float *const W, const float *const Z, uint16_t points,
+			  uint32_t size)
+{
+	memset(mean, 0, size * sizeof(float));
+	for (uint16_t j = 0; j < points; j++)
+		for (uint32_t e = 0; e < size; e++)
+			mean[e] += W[j] * Z[j * size + e];
+}
+
+// Householder triangularization of A [rows * dim] of every filter, R gets positive diagonal
+static void triangularize(const struct sqr_ukf_bank *self, float *R, float *A, uint16_t rows,
+			  uint8_t dim)
+{
+	const uint32_t n = self->count;
+	float *alpha = &self->t[0];
+	float *v0 = &self->t[n];
+	float *scale = &self->t[2 * n];
+	float *s = &self->t[3 * n];
+
+	for (uint8_t k = 0; k < dim; k++) {
+		float *Akk = &A[(k * dim + k) * n];
+
+		memset(alpha, 0, n * sizeof(float));
+		for (uint16_t i = k; i < rows; i++) {
+			const float *a = &A[(i * dim + k) * n];
+
+			for (uint32_t b = 0; b < n; b++)
+				alpha[b] += a[b] * a[b];
+		}
+		for (uint32_t b = 0; b < n; b++) {
+			const float norm = sqrtf(alpha[b]);
+			const float vv = 2.0f * norm * (norm + fabsf(Akk[b]));
+
+			alpha[b] = Akk[b] > 0.0f ? -norm : norm;
+			v0[b] = Akk[b] - alpha[b];
+			scale[b] = vv > 0.0f ? 2.0f / vv : 0.0f;
+		}
+
+		for (uint8_t j = k + 1; j < dim; j++) {
+			float *Akj = &A[(k * dim + j) * n];
+
+			for (uint32_t b = 0; b < n; b++)
+				s[b] = v0[b] * Akj[b];
+			for (uint16_t i = k + 1; i < rows; i++) {
+				const float *a = &A[(i * dim + k) * n];
+				const float *c = &A[(i * dim + j) * n];
+
+				for (uint32_t b = 0; b < n; b++)
+					s[b] += a[b] * c[b];
+			}
+			for (uint32_t b = 0; b < n; b++) {
+				s[b] *= scale[b];
+				Akj[b] -= s[b] * v0[b];
+			}
+			for (uint16_t i = k + 1; i < rows; i++) {
+				const float *a = &A[(i * dim + k) * n];
+				float *c = &A[(i * dim + j) * n];
+
+				for (uint32_t b = 0; b < n; b++)
+					c[b] -= s[b] * a[b];
+			}
+		}
+		memcpy(Akk, alpha, n * sizeof(float));
+	}
+
+	for (uint8_t i = 0; i < dim; i++) {
+		const float *d = &A[(i * dim + i) * n];
+
+		for (uint8_t j = 0; j < dim; j++) {
+			float *r = &R[(i * dim + j) * n];
+			const float *a = &A[(i * dim + j) * n];
+
+			for (uint32_t b = 0; b < n; b++)
+				r[b] = j < i ? 0.0f : (d[b] < 0.0f ? -a[b] : a[b]);
+		}
+	}
+}
+
+// R'*R + sigma*v*v' for upper triangular R of every filter, same update as sqr_ukf_filter.c
+static bool rank_one_update(const struct sqr_ukf_bank *self, float *R, float *v, uint8_t dim,
+			    float sigma)
+{
+	const uint32_t n = self->count;
+	float *d = &self->t[0];
+	float *r = &self->t[n];
+	bool ok = true;
+
+	for (uint8_t k = 0; k < dim; k++) {
+		float *Rkk = &R[(k * dim + k) * n];
+		const float *vk = &v[k * n];
+
+		for (uint32_t b = 0; b < n; b++) {
+			const float r2 = Rkk[b] * Rkk[b] + sigma * vk[b] * vk[b];
+
+			ok &= r2 > 0.0f;
+			d[b] = Rkk[b];
+			r[b] = sqrtf(r2);
+			Rkk[b] = r[b];
+		}
+		for (uint8_t j = k + 1; j < dim; j++) {
+			float *Rkj = &R[(k * dim + j) * n];
+			float *vj = &v[j * n];
+
+			for (uint32_t b = 0; b < n; b++) {
+				const float old = Rkj[b];
+
+				Rkj[b] = (d[b] * old + sigma * vk[b] * vj[b]) / r[b];
+				vj[b] = (d[b] * vj[b] - vk[b] * old) / r[b];
+			}
+		}
+	}
+	return ok;
+}
+
+// Square root of the weighted covariance of the points Z around mean plus the noise N'*N
+static bool covariance_root(const struct sqr_ukf_bank *self, float *R, const float *const Z,
+			    const float *const mean, const float *const noise, uint8_t dim)
+{
+	const uint16_t points = 2 * (uint16_t)self->L;
+	const uint32_t n = self->count;
+	const uint32_t size = dim * n;
+	const float w = sqrtf(fabsf(self->Wc[1]));
+	float *A = self->A;
+
+	for (uint16_t j = 0; j < points; j++) {
+		const float *z = &Z[(j + 1) * size];
+		float *a = &A[j * size];
+
+		for (uint32_t e = 0; e < size; e++)
+			a[e] = w * (z[e] - mean[e]);
+	}
+	for (uint16_t e = 0; e < dim * dim; e++)
+		for (uint32_t b = 0; b < n; b++)
+			A[points * size + e * n + b] = noise[e];
+
+	triangularize(self, R, A, points + dim, dim);
+
+	const float w0 = sqrtf(fabsf(self->Wc[0]));
+	float *v = self->v;
+
+	for (uint32_t e = 0; e < size; e++)
+		v[e] = w0 * (Z[e] - mean[e]);
+	return rank_one_update(self, R, v, dim, self->Wc[0] < 0.0f ? -1.0f : 1.0f);
+}
+
+int sqr_ukf_bank_step(struct sqr_ukf_bank *self, const float *const y, const float *const u)
+{
+	const uint8_t L = self->L;
+	const uint8_t M = self->M;
+	const uint16_t N = 2 * (uint16_t)L + 1;
+	const uint32_t n = self->count;
+	const float *const Wc = self->Wc;
+	bool ok = true;
+
+	/* Predict: propagate the sigma points of all filters through F */
+	create_sigma_points(self);
+	self->F(self->Xs, self->X, u, N, L, self->count, self->F_ctx);
+	weighted_mean(self->x, self->Wm, self->Xs, N, L * n);
+	ok &= covariance_root(self, self->S, self->Xs, self->x, self->Sv, L);
+
+	/* Update: new sigma points around the predictions through H */
+	create_sigma_points(self);
+	if (self->H)
+		self->H(self->Y, self->X, N, L, M, self->count, self->H_ctx);
+	else
+		memcpy(self->Y, self->X, N * L * n * sizeof(float));
+	weighted_mean(self->yhat, self->Wm, self->Y, N, M * n);
+	ok &= covariance_root(self, self->Sy, self->Y, self->yhat, self->Sn, M);
+
+	/* Update: cross covariances Pxy = sum Wc*(X - x)*(Y - yhat)' */
+	float *K = self->K;
+	float *dx = self->v;
+
+	memset(K, 0, L * M * n * sizeof(float));
+	for (uint16_t j = 0; j < N; j++) {
+		const float *X = &self->X[j * L * n];
+		const float *Y = &self->Y[j * M * n];
+
+		for (uint8_t i = 0; i < L; i++) {
+			for (uint32_t b = 0; b < n; b++)
+				dx[b] = Wc[j] * (X[i * n + b] - self->x[i * n + b]);
+			for (uint8_t k = 0; k < M; k++) {
+				float *Kik = &K[(i * M + k) * n];
+
+				for (uint32_t b = 0; b < n; b++)
+					Kik[b] += dx[b] * (Y[k * n + b] - self->yhat[k * n + b]);
+			}
+		}
+	}
+
+	/* Update: K = Pxy * inv(Sy'*Sy) with triangular solves */
+	const float *Sy = self->Sy;
+
+	for (uint8_t i = 0; i < L; i++) {
+		float *k = &K[i * M * n];
+
+		for (uint8_t a = 0; a < M; a++) {
+			for (uint8_t c = 0; c < a; c++)
+				for (uint32_t b = 0; b < n; b++)
+					k[a * n + b] -= Sy[(c * M + a) * n + b] * k[c * n + b];
+			for (uint32_t b = 0; b < n; b++)
+				k[a * n + b] /= Sy[(a * M + a) * n + b];
+		}
+		for (uint8_t a = M; a-- > 0;) {
+			for (uint8_t c = a + 1; c < M; c++)
+				for (uint32_t b = 0; b < n; b++)
+					k[a * n + b] -= Sy[(a * M + c) * n + b] * k[c * n + b];
+			for (uint32_t b = 0; b < n; b++)
+				k[a * n + b] /= Sy[(a * M + a) * n + b];
+		}
+	}
+
+	/* Update: x = x + K*(y - yhat) */
+	for (uint8_t i = 0; i < L; i++)
+		for (uint8_t k = 0; k < M; k++)
+			for (uint32_t b = 0; b < n; b++)
+				self->x[i * n + b] += K[(i * M + k) * n + b] *
+						      (y[k * n + b] - self->yhat[k * n + b]);
+
+	/* Update: downdate S with every column of U = K*Sy' */
+	float *v = self->v;
+
+	for (uint8_t a = 0; a < M; a++) {
+		for (uint8_t i = 0; i < L; i++) {
+			float *vi = &v[i * n];
+
+			memset(vi, 0, n * sizeof(float));
+			for (uint8_t c = a; c < M; c++)
+				for (uint32_t b = 0; b < n; b++)
+					vi[b] += K[(i * M + c) * n + b] * Sy[(a * M + c) * n + b];
+		}
+		ok &= rank_one_update(self, self->S, v, L, -1.0f);
+	}
+	return ok ? 0 : -ENOTSUP;
+}
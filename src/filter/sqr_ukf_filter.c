@@ -0,0 +1,295 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/filter.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+int sqr_ukf_filter_init(struct sqr_ukf_filter *self, sqr_ukf_transition_t F, void *F_ctx,
+			sqr_ukf_measurement_t H, void *H_ctx, uint8_t L, uint8_t M, float alpha,
+			float beta, float kappa, const float *const Sv, const float *const Sn,
+			float *storage)
+{
+	if (L == 0 || M == 0 || F == NULL || (H == NULL && M != L))
+		return -EINVAL;
+
+	const uint16_t N = 2 * (uint16_t)L + 1;
+	const float lambda = alpha * alpha * ((float)L + kappa) - (float)L;
+
+	if (!((float)L + lambda > 0.0f))
+		return -EINVAL;
+
+	self->L = L;
+	self->M = M;
+	self->F = F;
+	self->F_ctx = F_ctx;
+	self->H = H;
+	self->H_ctx = H_ctx;
+	self->Sv = Sv;
+	self->Sn = Sn;
+
+	self->Wm = storage;
+	storage += N;
+	self->Wc = storage;
+	storage += N;
+	self->x = storage;
+	storage += L;
+	self->S = storage;
+	storage += L * L;
+	self->X = storage;
+	storage += N * L;
+	self->Xs = storage;
+	storage += N * L;
+	self->Y = storage;
+	storage += N * M;
+	self->A = storage;
+	storage += 3 * L * L + (2 * L + M) * M;
+	self->Sy = storage;
+	storage += M * M;
+	self->K = storage;
+	storage += L * M;
+	self->yhat = storage;
+	storage += M;
+	self->v = storage;
+
+	// Weights depend only on the tuning
+	self->gamma = sqrtf((float)L + lambda);
+	self->Wm[0] = lambda / ((float)L + lambda);
+	self->Wc[0] = self->Wm[0] + 1.0f - alpha * alpha + beta;
+	for (uint16_t j = 1; j < N; j++) {
+		self->Wm[j] = 0.5f / ((float)L + lambda);
+		self->Wc[j] = self->Wm[j];
+	}
+
+	memset(self->x, 0, L * sizeof(float));
+	memset(self->S, 0, L * L * sizeof(float));
+	for (uint8_t i = 0; i < L; i++)
+		self->S[i * L + i] = 1.0f;
+	return 0;
+}
+
+void sqr_ukf_filter_reset(struct sqr_ukf_filter *self, const float *const x,
+			  const float *const S)
+{
+	memcpy(self->x, x, self->L * sizeof(float));
+	memcpy(self->S, S, self->L * self->L * sizeof(float));
+}
+
+// Sigma points x, x + gamma*S(k, :)', x - gamma*S(k, :)' since P = S'*S
+static void create_sigma_points(const struct sqr_ukf_filter *self)
+{
+	const uint8_t L = self->L;
+	float *X = self->X;
+
+	memcpy(X, self->x, L * sizeof(float));
+	for (uint8_t k = 0; k < L; k++) {
+		float *plus = &X[(1 + k) * L];
+		float *minus = &X[(1 + L + k) * L];
+		const float *s = &self->S[k * L];
+
+		for (uint8_t i = 0; i < L; i++) {
+			plus[i] = self->x[i] + self->gamma * s[i];
+			minus[i] = self->x[i] - self->gamma * s[i];
+		}
+	}
+}
+
+// Weighted mean of count vectors of length n
+static void weighted_mean(float *mean, const float *const W, const float *const Z, uint16_t count,
+			  uint8_t n)
+{
+	memset(mean, 0, n * sizeof(float));
+	for (uint16_t j = 0; j < count; j++)
+		for (uint8_t i = 0; i < n; i++)
+			mean[i] += W[j] * Z[j * n + i];
+}
+
+/*
+ * Overwrite A [rows * n] with Householder reflections and store the upper
+ * triangular factor with positive diagonal in R [n * n]. Q is never formed.
+ */
+static void triangularize(float *R, float *A, uint16_t rows, uint8_t n)
+{
+	for (uint8_t k = 0; k < n; k++) {
+		float norm = 0.0f;
+
+		for (uint16_t i = k; i < rows; i++)
+			norm += A[i * n + k] * A[i * n + k];
+		norm = sqrtf(norm);
+		if (norm == 0.0f)
+			continue;
+
+		const float head = A[k * n + k];
+		const float alpha = head > 0.0f ? -norm : norm;
+		const float v0 = head - alpha;
+		// v'v of v = x - alpha*e1
+		const float vv = 2.0f * norm * (norm + fabsf(head));
+
+		for (uint8_t j = k + 1; j < n; j++) {
+			float s = v0 * A[k * n + j];
+
+			for (uint16_t i = k + 1; i < rows; i++)
+				s += A[i * n + k] * A[i * n + j];
+			s *= 2.0f / vv;
+			A[k * n + j] -= s * v0;
+			for (uint16_t i = k + 1; i < rows; i++)
+				A[i * n + j] -= s * A[i * n + k];
+		}
+		A[k * n + k] = alpha;
+	}
+
+	for (uint8_t i = 0; i < n; i++) {
+		const float sign = A[i * n + i] < 0.0f ? -1.0f : 1.0f;
+
+		for (uint8_t j = 0; j < n; j++)
+			R[i * n + j] = j < i ? 0.0f : sign * A[i * n + j];
+	}
+}
+
+/*
+ * R'*R + sigma*v*v' for upper triangular R, v is overwritten. Written without
+ * dividing by the old diagonal so a zero diagonal with r > 0 is a valid
+ * update.
+ */
+static int rank_one_update(float *R, float *v, uint8_t n, float sigma)
+{
+	for (uint8_t k = 0; k < n; k++) {
+		const float d = R[k * n + k];
+		const float r2 = d * d + sigma * v[k] * v[k];
+
+		if (!(r2 > 0.0f))
+			return -ENOTSUP;
+
+		const float r = sqrtf(r2);
+
+		R[k * n + k] = r;
+		for (uint8_t j = k + 1; j < n; j++) {
+			const float old = R[k * n + j];
+
+			R[k * n + j] = (d * old + sigma * v[k] * v[j]) / r;
+			v[j] = (d * v[j] - v[k] * old) / r;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Square root of the weighted covariance of count = 2*n_points + 1 points Z
+ * around mean plus the noise N'*N. All points but the first have weight
+ * Wc[1] and form a tall matrix with the noise, the first point is added as
+ * a rank one update since its weight can be negative.
+ */
+static int covariance_root(const struct sqr_ukf_filter *self, float *R, const float *const Z,
+			   const float *const mean, const float *const noise, uint8_t n)
+{
+	const uint16_t points = 2 * (uint16_t)self->L;
+	const float w = sqrtf(fabsf(self->Wc[1]));
+	float *A = self->A;
+
+	for (uint16_t j = 0; j < points; j++)
+		for (uint8_t i = 0; i < n; i++)
+			A[j * n + i] = w * (Z[(j + 1) * n + i] - mean[i]);
+	memcpy(&A[points * n], noise, n * n * sizeof(float));
+
+	triangularize(R, A, points + n, n);
+
+	const float w0 = sqrtf(fabsf(self->Wc[0]));
+	float *v = self->v;
+
+	for (uint8_t i = 0; i < n; i++)
+		v[i] = w0 * (Z[i] - mean[i]);
+	return rank_one_update(R, v, n, self->Wc[0] < 0.0f ? -1.0f : 1.0f);
+}
+
+int sqr_ukf_filter_step(struct sqr_ukf_filter *self, const float *const y, const float *const u)
+{
+	const uint8_t L = self->L;
+	const uint8_t M = self->M;
+	const uint16_t N = 2 * (uint16_t)L + 1;
+	const float *const Wc = self->Wc;
+	int r;
+
+	/* Predict: propagate the sigma points through F */
+	create_sigma_points(self);
+	self->F(self->Xs, self->X, u, N, L, self->F_ctx);
+	weighted_mean(self->x, self->Wm, self->Xs, N, L);
+	r = covariance_root(self, self->S, self->Xs, self->x, self->Sv, L);
+	if (r != 0)
+		return r;
+
+	/* Update: new sigma points around the prediction through H */
+	create_sigma_points(self);
+	if (self->H)
+		self->H(self->Y, self->X, N, L, M, self->H_ctx);
+	else
+		memcpy(self->Y, self->X, N * L * sizeof(float));
+	weighted_mean(self->yhat, self->Wm, self->Y, N, M);
+	r = covariance_root(self, self->Sy, self->Y, self->yhat, self->Sn, M);
+	if (r != 0)
+		return r;
+
+	/* Update: cross covariance Pxy = sum Wc*(X - x)*(Y - yhat)' */
+	float *K = self->K;
+
+	memset(K, 0, L * M * sizeof(float));
+	for (uint16_t j = 0; j < N; j++) {
+		const float *X = &self->X[j * L];
+		const float *Y = &self->Y[j * M];
+
+		for (uint8_t i = 0; i < L; i++) {
+			const float dx = Wc[j] * (X[i] - self->x[i]);
+
+			for (uint8_t k = 0; k < M; k++)
+				K[i * M + k] += dx * (Y[k] - self->yhat[k]);
+		}
+	}
+
+	/* Update: K = Pxy * inv(Sy'*Sy) one row at a time with triangular solves */
+	const float *Sy = self->Sy;
+
+	for (uint8_t i = 0; i < L; i++) {
+		float *k = &K[i * M];
+
+		for (uint8_t a = 0; a < M; a++) {
+			if (Sy[a * M + a] == 0.0f)
+				return -ENOTSUP;
+			for (uint8_t b = 0; b < a; b++)
+				k[a] -= Sy[b * M + a] * k[b];
+			k[a] /= Sy[a * M + a];
+		}
+		for (uint8_t a = M; a-- > 0;) {
+			for (uint8_t b = a + 1; b < M; b++)
+				k[a] -= Sy[a * M + b] * k[b];
+			k[a] /= Sy[a * M + a];
+		}
+	}
+
+	/* Update: x = x + K*(y - yhat) */
+	for (uint8_t i = 0; i < L; i++)
+		for (uint8_t k = 0; k < M; k++)
+			self->x[i] += K[i * M + k] * (y[k] - self->yhat[k]);
+
+	/* Update: downdate S with every column of U = K*Sy' */
+	float *v = self->v;
+
+	for (uint8_t a = 0; a < M; a++) {
+		for (uint8_t i = 0; i < L; i++) {
+			float sum = 0.0f;
+
+			for (uint8_t b = a; b < M; b++)
+				sum += K[i * M + b] * Sy[a * M + b];
+			v[i] = sum;
+		}
+		r = rank_one_update(self->S, v, L, -1.0f);
+		if (r != 0)
+			return r;
+	}
+	return 0;
+}
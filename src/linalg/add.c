@@ -9,6 +9,7 @@
 
 #include "control/linalg.h"
 
+#include <errno.h>
 #include <string.h>
 
 /*
@@ -25,3 +26,20 @@ void add(float *C, const float *const A, const float *const B, uint16_t row, uin
 	}
 	memcpy(C, Cr, sizeof(float) * row * column);
 }
+
+int add_view(struct mat_view C, const struct mat_view A, const struct mat_view B)
+{
+	if (A.rows != B.rows || A.cols != B.cols || C.rows != A.rows || C.cols != A.cols)
+		return -EINVAL;
+
+	// Element-wise, so C may be A or B
+	for (uint32_t i = 0; i < C.rows; i++) {
+		const float *a = &A.data[A.ld * i];
+		const float *b = &B.data[B.ld * i];
+		float *c = &C.data[C.ld * i];
+
+		for (uint32_t j = 0; j < C.cols; j++)
+			c[j] = a[j] + b[j];
+	}
+	return 0;
+}
@@ -8,9 +8,6 @@
  */
 
 #include "control/linalg.h"
-#include "control/misc.h"
-
-#include <string.h>
 
 /*
  * Discrete Lyapunov equation
@@ -26,16 +23,17 @@ void dlyap(const float *const A, float *P, const float *const Q, uint16_t row)
 	// Create an zero large matrix M
 	float M[row * row * row * row]; // row_a^2 * row_a^2
 
-	// Create a temporary B matrix
-	float B[row * row];
+	const struct mat_view m = mat_view_init(M, row * row, row * row);
 
-	// Fill the M matrix
+	// Fill the M matrix with blocks A*A(k, l) written straight into M
 	for (uint16_t k = 0; k < row; k++) {
 		for (uint16_t l = 0; l < row; l++) {
-			memcpy(B, A, row * row * sizeof(float)); // B = A*A(k, l);
-			for (uint16_t i = 0; i < row * row; i++)
-				B[i] *= A[row * k + l];
-			insert(M, B, row, row, row * row, row * k, row * l);
+			const struct mat_view block = mat_view_block(m, row * k, row * l, row, row);
+			const float scale = A[row * k + l];
+
+			for (uint16_t i = 0; i < row; i++)
+				for (uint16_t j = 0; j < row; j++)
+					block.data[block.ld * i + j] = A[row * i + j] * scale;
 		}
 	}
 
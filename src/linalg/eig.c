@@ -26,6 +26,14 @@ static void prepare(float *A, uint16_t row);
  */
 void eig(const float *const AA, float *wr, float *wi, uint16_t row)
 {
+	// Larger matrices benefit from aggressive early deflation, the plain QR is the fallback
+	if (row >= EIG_FRANCIS_AED_MIN_ROW) {
+		float work[EIG_FRANCIS_WORK_SIZE(row)];
+
+		if (eig_francis(AA, wr, wi, NULL, work, row) == 0)
+			return;
+	}
+
 	float A[row * row];
 
 	// create a copy since we are modifying it
@@ -0,0 +1,1021 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#define EIG_FRANCIS_EXCEPTIONAL_SHIFT 6 // Use exceptional shifts after this many idle sweeps
+
+/*
+ * Balance A by powers of two and remember the diagonal scaling so that the
+ * eigenvectors of the balanced matrix can be transformed back. Same loop as
+ * balance() but D is recorded: Ab = D^-1 * A * D
+ */
+static void balance_scaled(float *A, float *d, uint16_t row)
+{
+	bool done = false;
+
+	for (uint16_t i = 0; i < row; i++)
+		d[i] = 1.0f;
+
+	while (!done) {
+		done = true;
+		for (uint16_t i = 0; i < row; i++) {
+			float c = 0.0f;
+			float r = 0.0f;
+
+			for (uint16_t j = 0; j < row; j++) {
+				if (j != i) {
+					c += fabsf(A[row * j + i]);
+					r += fabsf(A[row * i + j]);
+				}
+			}
+			if (c == 0.0f || r == 0.0f)
+				continue;
+
+			float g = r / 2.0f;
+			float f = 1.0f;
+			float s = c + r;
+
+			while (c < g) {
+				f *= 2.0f;
+				c *= 4.0f;
+			}
+			g = r * 2.0f;
+			while (c > g) {
+				f /= 2.0f;
+				c /= 4.0f;
+			}
+			if ((c + r) / f < 0.95f * s) {
+				done = false;
+				d[i] *= f;
+				for (uint16_t j = 0; j < row; j++)
+					A[row * i + j] /= f;
+				for (uint16_t j = 0; j < row; j++)
+					A[row * j + i] *= f;
+			}
+		}
+	}
+}
+
+/*
+ * Generate a Householder reflector P = I - tau * v * v' so that P * [alpha; x] = [beta; 0]
+ * v[0] is implicitly 1 and x is overwritten with v[1..len-1]. Returns tau.
+ */
+static float reflector(float *alpha, float *x, uint16_t len, uint16_t stride)
+{
+	float xnorm = 0.0f;
+
+	for (uint16_t i = 0; i + 1 < len; i++)
+		xnorm = hypotf(xnorm, x[i * stride]);
+	if (xnorm == 0.0f)
+		return 0.0f;
+
+	float beta = -copysignf(hypotf(*alpha, xnorm), *alpha);
+	float tau = (beta - *alpha) / beta;
+	float scale = 1.0f / (*alpha - beta);
+
+	for (uint16_t i = 0; i + 1 < len; i++)
+		x[i * stride] *= scale;
+	*alpha = beta;
+	return tau;
+}
+
+// A(r0:r0+len, c0:c1) = P * A(r0:r0+len, c0:c1) with v[0] == 1
+static void reflect_rows(float *A, uint16_t ld, const float *v, uint16_t len, float tau,
+			 uint16_t r0, uint16_t c0, uint16_t c1)
+{
+	for (uint16_t j = c0; j <= c1; j++) {
+		float s = 0.0f;
+
+		for (uint16_t i = 0; i < len; i++)
+			s += v[i] * A[ld * (r0 + i) + j];
+		s *= tau;
+		for (uint16_t i = 0; i < len; i++)
+			A[ld * (r0 + i) + j] -= s * v[i];
+	}
+}
+
+// A(r0:r1, c0:c0+len) = A(r0:r1, c0:c0+len) * P with v[0] == 1
+static void reflect_columns(float *A, uint16_t ld, const float *v, uint16_t len, float tau,
+			    uint16_t c0, uint16_t r0, uint16_t r1)
+{
+	for (uint16_t i = r0; i <= r1; i++) {
+		float *a = &A[ld * i + c0];
+		float s = 0.0f;
+
+		for (uint16_t j = 0; j < len; j++)
+			s += a[j] * v[j];
+		s *= tau;
+		for (uint16_t j = 0; j < len; j++)
+			a[j] -= s * v[j];
+	}
+}
+
+// x' = c * x + s * y, y' = c * y - s * x
+static void rotate(float *x, float *y, uint16_t count, uint16_t stride, float c, float s)
+{
+	for (uint16_t i = 0; i < count; i++) {
+		float t = c * x[i * stride] + s * y[i * stride];
+
+		y[i * stride] = c * y[i * stride] - s * x[i * stride];
+		x[i * stride] = t;
+	}
+}
+
+/*
+ * Orthogonal reduction to upper Hessenberg form H = Z' * A * Z. Z is
+ * accumulated if it is not NULL. v is scratch of size row.
+ */
+static void hessenberg(float *H, float *Z, float *v, uint16_t row)
+{
+	if (Z) {
+		memset(Z, 0, row * row * sizeof(float));
+		for (uint16_t i = 0; i < row; i++)
+			Z[row * i + i] = 1.0f;
+	}
+
+	for (uint16_t k = 0; k + 2 < row; k++) {
+		uint16_t len = row - k - 1;
+		float tau = reflector(&H[row * (k + 1) + k], &H[row * (k + 2) + k], len, row);
+
+		if (tau == 0.0f)
+			continue;
+
+		v[0] = 1.0f;
+		for (uint16_t i = 1; i < len; i++) {
+			v[i] = H[row * (k + 1 + i) + k];
+			H[row * (k + 1 + i) + k] = 0.0f;
+		}
+		reflect_rows(H, row, v, len, tau, k + 1, k + 1, row - 1);
+		reflect_columns(H, row, v, len, tau, k + 1, 0, row - 1);
+		if (Z)
+			reflect_columns(Z, row, v, len, tau, k + 1, 0, row - 1);
+	}
+}
+
+/*
+ * Standardize a real 2x2 Schur block [a b; c d] with a rotation [cs sn; -sn cs].
+ * Complex eigenvalue pairs end up with a == d and b * c < 0.
+ */
+static void standardize(float *a, float *b, float *c, float *d, float *rt1r, float *rt1i,
+			float *rt2r, float *rt2i, float *cs, float *sn)
+{
+	if (*c == 0.0f) {
+		*cs = 1.0f;
+		*sn = 0.0f;
+	} else if (*b == 0.0f) {
+		// Swap rows and columns
+		float t = *d;
+
+		*cs = 0.0f;
+		*sn = 1.0f;
+		*d = *a;
+		*a = t;
+		*b = -*c;
+		*c = 0.0f;
+	} else if ((*a - *d) == 0.0f && signbit(*b) != signbit(*c)) {
+		*cs = 1.0f;
+		*sn = 0.0f;
+	} else {
+		float temp = *a - *d;
+		float p = 0.5f * temp;
+		float bcmax = fmaxf(fabsf(*b), fabsf(*c));
+		float bcmis = fminf(fabsf(*b), fabsf(*c)) * copysignf(1.0f, *b) *
+			      copysignf(1.0f, *c);
+		float scale = fmaxf(fabsf(p), bcmax);
+		float z = (p / scale) * p + (bcmax / scale) * bcmis;
+
+		if (z >= 4.0f * FLT_EPSILON) {
+			// Real eigenvalues
+			z = p + copysignf(sqrtf(scale) * sqrtf(z), p);
+			*a = *d + z;
+			*d = *d - (bcmax / z) * bcmis;
+
+			float tau = hypotf(*c, z);
+
+			*cs = z / tau;
+			*sn = *c / tau;
+			*b = *b - *c;
+			*c = 0.0f;
+		} else {
+			// Complex or almost equal real eigenvalues: make diagonal equal
+			float sigma = *b + *c;
+			float tau = hypotf(sigma, temp);
+
+			*cs = sqrtf(0.5f * (1.0f + fabsf(sigma) / tau));
+			*sn = -(p / (tau * *cs)) * copysignf(1.0f, sigma);
+
+			float aa = *a * *cs + *b * *sn;
+			float bb = -*a * *sn + *b * *cs;
+			float cc = *c * *cs + *d * *sn;
+			float dd = -*c * *sn + *d * *cs;
+
+			*a = aa * *cs + cc * *sn;
+			*b = bb * *cs + dd * *sn;
+			*c = -aa * *sn + cc * *cs;
+			*d = -bb * *sn + dd * *cs;
+
+			temp = 0.5f * (*a + *d);
+			*a = temp;
+			*d = temp;
+			if (*c != 0.0f) {
+				if (*b != 0.0f) {
+					if (signbit(*b) == signbit(*c)) {
+						// Real eigenvalues after all
+						float sab = sqrtf(fabsf(*b));
+						float sac = sqrtf(fabsf(*c));
+
+						p = copysignf(sab * sac, *c);
+						tau = 1.0f / sqrtf(fabsf(*b + *c));
+						*a = temp + p;
+						*d = temp - p;
+						*b = *b - *c;
+						*c = 0.0f;
+
+						float cs1 = sab * tau;
+						float sn1 = sac * tau;
+
+						temp = *cs * cs1 - *sn * sn1;
+						*sn = *cs * sn1 + *sn * cs1;
+						*cs = temp;
+					}
+				} else {
+					*b = -*c;
+					*c = 0.0f;
+					temp = *cs;
+					*cs = -*sn;
+					*sn = temp;
+				}
+			}
+		}
+	}
+
+	*rt1r = *a;
+	*rt2r = *d;
+	if (*c == 0.0f) {
+		*rt1i = 0.0f;
+		*rt2i = 0.0f;
+	} else {
+		*rt1i = sqrtf(fabsf(*b)) * sqrtf(fabsf(*c));
+		*rt2i = -*rt1i;
+	}
+}
+
+/*
+ * One implicit double-shift Francis sweep on the active block rows l..i of H,
+ * introducing the bulge at row m. The shift pair must be real or complex
+ * conjugate. Rows/columns i1..i2 are updated (whole matrix when computing the
+ * Schur form). Z columns are updated for the first nz rows if Z is not NULL.
+ */
+static void sweep(float *H, uint16_t ld, int l, int m, int i, int i1, int i2, float rt1r,
+		  float rt1i, float rt2r, float rt2i, float *Z, uint16_t ldz, uint16_t nz)
+{
+	float v[3];
+	float s = fabsf(H[ld * m + m] - rt2r) + fabsf(rt2i) + fabsf(H[ld * (m + 1) + m]);
+	float h21s = H[ld * (m + 1) + m] / s;
+
+	// First column of (H - s1 * I) * (H - s2 * I), scaled
+	v[0] = h21s * H[ld * m + m + 1] + (H[ld * m + m] - rt1r) * ((H[ld * m + m] - rt2r) / s) -
+	       rt1i * (rt2i / s);
+	v[1] = h21s * (H[ld * m + m] + H[ld * (m + 1) + m + 1] - rt1r - rt2r);
+	v[2] = (m + 2 <= i) ? h21s * H[ld * (m + 2) + m + 1] : 0.0f;
+
+	for (int k = m; k < i; k++) {
+		int nr = (i - k + 1) < 3 ? (i - k + 1) : 3;
+
+		if (k > m) {
+			for (int j = 0; j < nr; j++)
+				v[j] = H[ld * (k + j) + k - 1];
+		}
+
+		float t1 = reflector(&v[0], &v[1], nr, 1);
+
+		if (k > m) {
+			H[ld * k + k - 1] = v[0];
+			H[ld * (k + 1) + k - 1] = 0.0f;
+			if (k < i - 1)
+				H[ld * (k + 2) + k - 1] = 0.0f;
+		} else if (m > l) {
+			// Avoids trouble when v[1] and v[2] underflow
+			H[ld * k + k - 1] *= (1.0f - t1);
+		}
+
+		float v2 = v[1];
+		float t2 = t1 * v2;
+
+		if (nr == 3) {
+			float v3 = v[2];
+			float t3 = t1 * v3;
+			int jmax = (k + 3 < i) ? k + 3 : i;
+
+			for (int j = k; j <= i2; j++) {
+				float sum = H[ld * k + j] + v2 * H[ld * (k + 1) + j] +
+					    v3 * H[ld * (k + 2) + j];
+
+				H[ld * k + j] -= sum * t1;
+				H[ld * (k + 1) + j] -= sum * t2;
+				H[ld * (k + 2) + j] -= sum * t3;
+			}
+			for (int j = i1; j <= jmax; j++) {
+				float sum = H[ld * j + k] + v2 * H[ld * j + k + 1] +
+					    v3 * H[ld * j + k + 2];
+
+				H[ld * j + k] -= sum * t1;
+				H[ld * j + k + 1] -= sum * t2;
+				H[ld * j + k + 2] -= sum * t3;
+			}
+			if (Z) {
+				for (uint16_t j = 0; j < nz; j++) {
+					float sum = Z[ldz * j + k] + v2 * Z[ldz * j + k + 1] +
+						    v3 * Z[ldz * j + k + 2];
+
+					Z[ldz * j + k] -= sum * t1;
+					Z[ldz * j + k + 1] -= sum * t2;
+					Z[ldz * j + k + 2] -= sum * t3;
+				}
+			}
+		} else if (nr == 2) {
+			for (int j = k; j <= i2; j++) {
+				float sum = H[ld * k + j] + v2 * H[ld * (k + 1) + j];
+
+				H[ld * k + j] -= sum * t1;
+				H[ld * (k + 1) + j] -= sum * t2;
+			}
+			for (int j = i1; j <= i; j++) {
+				float sum = H[ld * j + k] + v2 * H[ld * j + k + 1];
+
+				H[ld * j + k] -= sum * t1;
+				H[ld * j + k + 1] -= sum * t2;
+			}
+			if (Z) {
+				for (uint16_t j = 0; j < nz; j++) {
+					float sum = Z[ldz * j + k] + v2 * Z[ldz * j + k + 1];
+
+					Z[ldz * j + k] -= sum * t1;
+					Z[ldz * j + k + 1] -= sum * t2;
+				}
+			}
+		}
+	}
+}
+
+/*
+ * Double-shift QR on rows/columns ilo..ihi of the Hessenberg matrix H [n*n].
+ * If wantt is set the full quasi-triangular Schur form is computed.
+ * Returns 0 on success or -ENOTSUP if the iteration did not converge.
+ */
+static int hqr(float *H, uint16_t ld, uint16_t n, int ilo, int ihi, float *wr, float *wi,
+	       float *Z, uint16_t ldz, uint16_t nz, bool wantt)
+{
+	const float ulp = FLT_EPSILON;
+	const float smlnum = FLT_MIN * ((float)(ihi - ilo + 1) / ulp);
+	const int itmax = 30 * ((ihi - ilo + 1) > 10 ? (ihi - ilo + 1) : 10);
+	int i = ihi;
+
+	// Clear out the trash below the subdiagonal
+	for (int j = ilo; j + 3 <= ihi; j++) {
+		H[ld * (j + 2) + j] = 0.0f;
+		H[ld * (j + 3) + j] = 0.0f;
+	}
+	if (ilo + 2 <= ihi)
+		H[ld * ihi + ihi - 2] = 0.0f;
+
+	while (i >= ilo) {
+		int l = ilo;
+		bool converged = false;
+
+		for (int its = 0; its <= itmax; its++) {
+			int k;
+
+			// Look for a single small subdiagonal element
+			for (k = i; k > l; k--) {
+				float hk = fabsf(H[ld * k + k - 1]);
+
+				if (hk <= smlnum)
+					break;
+
+				float tst = fabsf(H[ld * (k - 1) + k - 1]) + fabsf(H[ld * k + k]);
+
+				if (tst == 0.0f) {
+					if (k - 2 >= ilo)
+						tst += fabsf(H[ld * (k - 1) + k - 2]);
+					if (k + 1 <= ihi)
+						tst += fabsf(H[ld * (k + 1) + k]);
+				}
+				if (hk <= ulp * tst) {
+					float ab = fmaxf(hk, fabsf(H[ld * (k - 1) + k]));
+					float ba = fminf(hk, fabsf(H[ld * (k - 1) + k]));
+					float d = fabsf(H[ld * (k - 1) + k - 1] - H[ld * k + k]);
+					float aa = fmaxf(fabsf(H[ld * k + k]), d);
+					float bb = fminf(fabsf(H[ld * k + k]), d);
+					float s = aa + ab;
+
+					if (ba * (ab / s) <= fmaxf(smlnum, ulp * (bb * (aa / s))))
+						break;
+				}
+			}
+			l = k;
+			if (l > ilo)
+				H[ld * l + l - 1] = 0.0f;
+
+			// One or two eigenvalues have split off
+			if (l >= i - 1) {
+				converged = true;
+				break;
+			}
+
+			int i1 = wantt ? 0 : l;
+			int i2 = wantt ? n - 1 : i;
+			float h11, h12, h21, h22;
+
+			if (its == 10) {
+				// Exceptional shift
+				float s = fabsf(H[ld * (l + 1) + l]) +
+					  fabsf(H[ld * (l + 2) + l + 1]);
+
+				h11 = 0.75f * s + H[ld * l + l];
+				h12 = -0.4375f * s;
+				h21 = s;
+				h22 = h11;
+			} else if (its == 20) {
+				// Exceptional shift
+				float s = fabsf(H[ld * i + i - 1]) + fabsf(H[ld * (i - 1) + i - 2]);
+
+				h11 = 0.75f * s + H[ld * i + i];
+				h12 = -0.4375f * s;
+				h21 = s;
+				h22 = h11;
+			} else {
+				// Wilkinson's double shift
+				h11 = H[ld * (i - 1) + i - 1];
+				h21 = H[ld * i + i - 1];
+				h12 = H[ld * (i - 1) + i];
+				h22 = H[ld * i + i];
+			}
+
+			float rt1r = 0.0f, rt1i = 0.0f, rt2r = 0.0f, rt2i = 0.0f;
+			float s = fabsf(h11) + fabsf(h12) + fabsf(h21) + fabsf(h22);
+
+			if (s != 0.0f) {
+				h11 /= s;
+				h21 /= s;
+				h12 /= s;
+				h22 /= s;
+
+				float tr = (h11 + h22) / 2.0f;
+				float det = (h11 - tr) * (h22 - tr) - h12 * h21;
+				float rtdisc = sqrtf(fabsf(det));
+
+				if (det >= 0.0f) {
+					// Complex conjugate shifts
+					rt1r = tr * s;
+					rt2r = rt1r;
+					rt1i = rtdisc * s;
+					rt2i = -rt1i;
+				} else {
+					// Real shifts, use only the one closest to h22
+					rt1r = tr + rtdisc;
+					rt2r = tr - rtdisc;
+					if (fabsf(rt1r - h22) <= fabsf(rt2r - h22))
+						rt1r *= s;
+					else
+						rt1r = rt2r * s;
+					rt2r = rt1r;
+				}
+			}
+
+			// Look for two consecutive small subdiagonal elements
+			int m;
+
+			for (m = i - 2; m > l; m--) {
+				float h21s = H[ld * (m + 1) + m];
+				float sc = fabsf(H[ld * m + m] - rt2r) + fabsf(rt2i) + fabsf(h21s);
+
+				h21s /= sc;
+
+				float v0 = h21s * H[ld * m + m + 1] +
+					   (H[ld * m + m] - rt1r) * ((H[ld * m + m] - rt2r) / sc) -
+					   rt1i * (rt2i / sc);
+				float v1 = h21s *
+					   (H[ld * m + m] + H[ld * (m + 1) + m + 1] - rt1r - rt2r);
+				float v2 = h21s * H[ld * (m + 2) + m + 1];
+
+				sc = fabsf(v0) + fabsf(v1) + fabsf(v2);
+				v0 /= sc;
+				v1 /= sc;
+				v2 /= sc;
+
+				float h00 = fabsf(H[ld * m + m - 1]) * (fabsf(v1) + fabsf(v2));
+				float h01 = fabsf(v0) * (fabsf(H[ld * (m - 1) + m - 1]) +
+							 fabsf(H[ld * m + m]) +
+							 fabsf(H[ld * (m + 1) + m + 1]));
+
+				if (h00 <= ulp * h01)
+					break;
+			}
+
+			sweep(H, ld, l, m, i, i1, i2, rt1r, rt1i, rt2r, rt2i, Z, ldz, nz);
+		}
+
+		if (!converged)
+			return -ENOTSUP;
+
+		if (l == i) {
+			wr[i] = H[ld * i + i];
+			wi[i] = 0.0f;
+		} else {
+			float cs, sn;
+
+			standardize(&H[ld * (i - 1) + i - 1], &H[ld * (i - 1) + i],
+				    &H[ld * i + i - 1], &H[ld * i + i], &wr[i - 1], &wi[i - 1],
+				    &wr[i], &wi[i], &cs, &sn);
+			if (wantt) {
+				if (n - 1 > i)
+					rotate(&H[ld * (i - 1) + i + 1], &H[ld * i + i + 1],
+					       n - 1 - i, 1, cs, sn);
+				if (i - 1 > 0)
+					rotate(&H[i - 1], &H[i], i - 1, ld, cs, sn);
+			}
+			if (Z)
+				rotate(&Z[i - 1], &Z[i], nz, ldz, cs, sn);
+		}
+		i = l - 1;
+	}
+	return 0;
+}
+
+/*
+ * Aggressive early deflation on the trailing nw x nw window of the active
+ * block ktop..kbot. The window is brought to Schur form, converged
+ * eigenvalues are deflated using the spike and the remaining window
+ * eigenvalues are left in wr/wi[kwtop..kwtop+ns-1] to be used as shifts.
+ * T and U are [nw*nw] scratch, v is [n] scratch.
+ */
+static void aed(float *H, uint16_t n, int ktop, int kbot, int nw, float *wr, float *wi, float *Z,
+		bool wantt, float *T, float *U, float *v, int *nd, int *ns)
+{
+	const float ulp = FLT_EPSILON;
+	const float smlnum = FLT_MIN * ((float)n / ulp);
+	int jw = (nw < kbot - ktop + 1) ? nw : kbot - ktop + 1;
+	int kwtop = kbot - jw + 1;
+	float s = (kwtop == ktop) ? 0.0f : H[n * kwtop + kwtop - 1];
+
+	*nd = 0;
+	*ns = jw;
+
+	if (jw == 1) {
+		wr[kwtop] = H[n * kwtop + kwtop];
+		wi[kwtop] = 0.0f;
+		if (fabsf(s) <= fmaxf(smlnum, ulp * fabsf(H[n * kwtop + kwtop]))) {
+			*ns = 0;
+			*nd = 1;
+			if (kwtop > ktop)
+				H[n * kwtop + kwtop - 1] = 0.0f;
+		}
+		return;
+	}
+
+	// Schur form of the window: T = U' * H(window) * U
+	memset(U, 0, jw * jw * sizeof(float));
+	for (int i = 0; i < jw; i++) {
+		memcpy(&T[jw * i], &H[n * (kwtop + i) + kwtop], jw * sizeof(float));
+		U[jw * i + i] = 1.0f;
+	}
+	if (hqr(T, jw, jw, 0, jw - 1, wr + kwtop, wi + kwtop, U, jw, jw, true) != 0) {
+		// Window did not converge. Leave H untouched, sweep with the plain shifts.
+		*ns = 0;
+		return;
+	}
+
+	// Deflation check, starting from the bottom of the window
+	int k = jw;
+
+	while (k > 0) {
+		bool pair = (k >= 2) && T[jw * (k - 1) + k - 2] != 0.0f;
+
+		if (!pair) {
+			float foo = fabsf(T[jw * (k - 1) + k - 1]);
+
+			if (foo == 0.0f)
+				foo = fabsf(s);
+			if (fabsf(s * U[k - 1]) > fmaxf(smlnum, ulp * foo))
+				break;
+			k -= 1;
+		} else {
+			float foo = fabsf(T[jw * (k - 1) + k - 1]) +
+				    sqrtf(fabsf(T[jw * (k - 1) + k - 2])) *
+					    sqrtf(fabsf(T[jw * (k - 2) + k - 1]));
+
+			if (foo == 0.0f)
+				foo = fabsf(s);
+			if (fmaxf(fabsf(s * U[k - 1]), fabsf(s * U[k - 2])) >
+			    fmaxf(smlnum, ulp * foo))
+				break;
+			k -= 2;
+		}
+	}
+	*ns = k;
+	*nd = jw - k;
+
+	if (*nd == 0)
+		return;
+
+	// Spike s * U(0, :) where the deflated part is zeroed out
+	if (s != 0.0f && *ns > 1) {
+		// Reflect the spike onto e1 and restore Hessenberg form of the undeflated part
+		for (int i = 0; i < *ns; i++)
+			v[i] = s * U[i];
+
+		float tau = reflector(&v[0], &v[1], *ns, 1);
+		float beta = v[0];
+
+		v[0] = 1.0f;
+		reflect_rows(T, jw, v, *ns, tau, 0, 0, jw - 1);
+		reflect_columns(T, jw, v, *ns, tau, 0, 0, *ns - 1);
+		reflect_columns(U, jw, v, *ns, tau, 0, 0, jw - 1);
+		s = beta;
+
+		for (int c = 0; c + 2 < *ns; c++) {
+			int len = *ns - c - 1;
+			float t = reflector(&T[jw * (c + 1) + c], &T[jw * (c + 2) + c], len, jw);
+
+			if (t == 0.0f)
+				continue;
+			v[0] = 1.0f;
+			for (int i = 1; i < len; i++) {
+				v[i] = T[jw * (c + 1 + i) + c];
+				T[jw * (c + 1 + i) + c] = 0.0f;
+			}
+			reflect_rows(T, jw, v, len, t, c + 1, c + 1, jw - 1);
+			reflect_columns(T, jw, v, len, t, c + 1, 0, *ns - 1);
+			reflect_columns(U, jw, v, len, t, c + 1, 0, jw - 1);
+		}
+		if (kwtop > 0)
+			H[n * kwtop + kwtop - 1] = s;
+		for (int i = 1; i < jw; i++)
+			H[n * (kwtop + i) + kwtop - 1] = 0.0f;
+	} else if (kwtop > ktop) {
+		for (int i = 0; i < jw; i++)
+			H[n * (kwtop + i) + kwtop - 1] = (i < *ns) ? s * U[i] : 0.0f;
+	}
+
+	// Copy the window back and apply U to the rest of the matrix
+	for (int i = 0; i < jw; i++)
+		memcpy(&H[n * (kwtop + i) + kwtop], &T[jw * i], jw * sizeof(float));
+
+	int i1 = wantt ? 0 : ktop;
+	int i2 = wantt ? n - 1 : kbot;
+
+	// H(i1:kwtop-1, window) = H(i1:kwtop-1, window) * U
+	for (int i = i1; i < kwtop; i++) {
+		float *h = &H[n * i + kwtop];
+
+		for (int j = 0; j < jw; j++) {
+			float sum = 0.0f;
+
+			for (int l = 0; l < jw; l++)
+				sum += h[l] * U[jw * l + j];
+			v[j] = sum;
+		}
+		memcpy(h, v, jw * sizeof(float));
+	}
+	// H(window, kbot+1:i2) = U' * H(window, kbot+1:i2)
+	for (int j = kbot + 1; j <= i2; j++) {
+		for (int i = 0; i < jw; i++) {
+			float sum = 0.0f;
+
+			for (int l = 0; l < jw; l++)
+				sum += U[jw * l + i] * H[n * (kwtop + l) + j];
+			v[i] = sum;
+		}
+		for (int i = 0; i < jw; i++)
+			H[n * (kwtop + i) + j] = v[i];
+	}
+	if (Z) {
+		for (uint16_t i = 0; i < n; i++) {
+			float *z = &Z[n * i + kwtop];
+
+			for (int j = 0; j < jw; j++) {
+				float sum = 0.0f;
+
+				for (int l = 0; l < jw; l++)
+					sum += z[l] * U[jw * l + j];
+				v[j] = sum;
+			}
+			memcpy(z, v, jw * sizeof(float));
+		}
+	}
+}
+
+/*
+ * Multishift QR driver with aggressive early deflation. Small active blocks
+ * are finished with the plain double-shift iteration.
+ */
+static int multishift(float *H, uint16_t n, float *wr, float *wi, float *Z, bool wantt,
+		      float *T, float *U, float *v)
+{
+	int kbot = n - 1;
+	int idle = 0;
+	const int itmax = 30 * (n > 10 ? n : 10);
+
+	for (int it = 0; kbot >= 0; it++) {
+		if (it > itmax)
+			return -ENOTSUP;
+
+		int ktop = kbot;
+
+		while (ktop > 0 && H[n * ktop + ktop - 1] != 0.0f)
+			ktop--;
+
+		int nh = kbot - ktop + 1;
+
+		if (nh < EIG_FRANCIS_AED_MIN_ROW) {
+			if (hqr(H, n, n, ktop, kbot, wr, wi, Z, n, n, wantt) != 0)
+				return -ENOTSUP;
+			kbot = ktop - 1;
+			continue;
+		}
+
+		// Deflation window, limited by the scratch space of n/2 x n/2
+		int nw = nh / 4 > 4 ? nh / 4 : 4;
+
+		if (nw > n / 2)
+			nw = n / 2;
+
+		int nd, ns;
+
+		aed(H, n, ktop, kbot, nw, wr, wi, Z, wantt, T, U, v, &nd, &ns);
+
+		int kwtop = kbot - ((nw < nh) ? nw : nh) + 1;
+
+		kbot -= nd;
+		idle = (nd == 0) ? idle + 1 : 0;
+
+		// Skip the sweep if the deflation window did most of the work
+		if (nd > 0 && 100 * nd > 14 * nw)
+			continue;
+
+		int ibot = kbot;
+		int i1 = wantt ? 0 : ktop;
+		int i2 = wantt ? n - 1 : kbot;
+
+		if (ns < 2 || (idle > 0 && idle % EIG_FRANCIS_EXCEPTIONAL_SHIFT == 0)) {
+			float s = fabsf(H[n * ibot + ibot - 1]) +
+				  fabsf(H[n * (ibot - 1) + ibot - 2]);
+			float re = 0.75f * s + H[n * ibot + ibot];
+			float im = sqrtf(0.4375f) * s;
+
+			sweep(H, n, ktop, ktop, ibot, i1, i2, re, im, re, -im, Z, n, n);
+			continue;
+		}
+
+		// Use up to nh/6 window eigenvalues as shifts, two per bulge
+		int nshifts = nh / 6 > 2 ? nh / 6 : 2;
+		int used = 0;
+		int j = kwtop + ns - 1;
+
+		while (j >= kwtop && used < nshifts) {
+			if (wi[j] != 0.0f && j > kwtop) {
+				// Complex conjugate pair (positive imaginary part first)
+				sweep(H, n, ktop, ktop, ibot, i1, i2, wr[j - 1], wi[j - 1], wr[j],
+				      wi[j], Z, n, n);
+				j -= 2;
+			} else if (j > kwtop && wi[j - 1] == 0.0f) {
+				sweep(H, n, ktop, ktop, ibot, i1, i2, wr[j], 0.0f, wr[j - 1], 0.0f,
+				      Z, n, n);
+				j -= 2;
+			} else {
+				sweep(H, n, ktop, ktop, ibot, i1, i2, wr[j], 0.0f, wr[j], 0.0f, Z,
+				      n, n);
+				j -= 1;
+			}
+			used += 2;
+		}
+	}
+	return 0;
+}
+
+// c = a / b for complex numbers (Smith's algorithm)
+static void cdiv(float ar, float ai, float br, float bi, float *cr, float *ci)
+{
+	if (fabsf(br) >= fabsf(bi)) {
+		float r = bi / br;
+		float d = br + r * bi;
+
+		*cr = (ar + r * ai) / d;
+		*ci = (ai - r * ar) / d;
+	} else {
+		float r = br / bi;
+		float d = bi + r * br;
+
+		*cr = (r * ar + ai) / d;
+		*ci = (r * ai - ar) / d;
+	}
+}
+
+/*
+ * Solve (T - lambda * I) x = r by back substitution for rows 0..k-1 of the
+ * quasi-triangular T. x and r are complex vectors stored as separate real and
+ * imaginary parts. r is destroyed.
+ */
+static void back_substitute(const float *T, uint16_t n, int k, float lr, float li, float *xr,
+			    float *xi, float *rr, float *ri)
+{
+	const float smin = fmaxf(FLT_EPSILON * (fabsf(lr) + fabsf(li)), FLT_MIN);
+	int j = k - 1;
+
+	while (j >= 0) {
+		if (j > 0 && T[n * j + j - 1] != 0.0f) {
+			// 2x2 diagonal block
+			float m00r = T[n * (j - 1) + j - 1] - lr, m00i = -li;
+			float m11r = T[n * j + j] - lr, m11i = -li;
+			float m01 = T[n * (j - 1) + j];
+			float m10 = T[n * j + j - 1];
+			float detr = m00r * m11r - m00i * m11i - m01 * m10;
+			float deti = m00r * m11i + m00i * m11r;
+
+			if (fabsf(detr) + fabsf(deti) < smin)
+				detr = smin;
+
+			// x0 = (r0 * m11 - m01 * r1) / det
+			float ar = rr[j - 1] * m11r - ri[j - 1] * m11i - m01 * rr[j];
+			float ai = rr[j - 1] * m11i + ri[j - 1] * m11r - m01 * ri[j];
+
+			cdiv(ar, ai, detr, deti, &xr[j - 1], &xi[j - 1]);
+
+			// x1 = (m00 * r1 - m10 * r0) / det
+			ar = m00r * rr[j] - m00i * ri[j] - m10 * rr[j - 1];
+			ai = m00r * ri[j] + m00i * rr[j] - m10 * ri[j - 1];
+			cdiv(ar, ai, detr, deti, &xr[j], &xi[j]);
+
+			for (int i = 0; i < j - 1; i++) {
+				rr[i] -= T[n * i + j - 1] * xr[j - 1] + T[n * i + j] * xr[j];
+				ri[i] -= T[n * i + j - 1] * xi[j - 1] + T[n * i + j] * xi[j];
+			}
+			j -= 2;
+		} else {
+			float dr = T[n * j + j] - lr;
+			float di = -li;
+
+			if (fabsf(dr) + fabsf(di) < smin)
+				dr = smin;
+			cdiv(rr[j], ri[j], dr, di, &xr[j], &xi[j]);
+			for (int i = 0; i < j; i++) {
+				rr[i] -= T[n * i + j] * xr[j];
+				ri[i] -= T[n * i + j] * xi[j];
+			}
+			j -= 1;
+		}
+	}
+}
+
+/*
+ * Right eigenvectors of the Schur form T with Schur vectors in V. V is
+ * overwritten with the eigenvectors, last column first, so every column of V
+ * is still a Schur vector when it is needed. work is [4*n] scratch.
+ */
+static void eigenvectors(const float *T, float *V, const float *wr, const float *wi, uint16_t n,
+			 float *work)
+{
+	float *xr = work;
+	float *xi = work + n;
+	float *rr = work + 2 * n;
+	float *ri = work + 3 * n;
+	int k = n - 1;
+
+	while (k >= 0) {
+		bool pair = k > 0 && T[n * k + k - 1] != 0.0f;
+		int k0 = pair ? k - 1 : k;
+		float lr = wr[k0];
+		float li = pair ? fabsf(wi[k0]) : 0.0f;
+
+		memset(xr, 0, n * sizeof(float));
+		memset(xi, 0, n * sizeof(float));
+
+		if (!pair) {
+			xr[k] = 1.0f;
+		} else {
+			float a = T[n * (k - 1) + k - 1];
+			float b = T[n * (k - 1) + k];
+			float c = T[n * k + k - 1];
+			float d = T[n * k + k];
+
+			// Eigenvector of the 2x2 block [a b; c d] for lambda = lr + i * li
+			if (fabsf(b) >= fabsf(c)) {
+				xr[k - 1] = b;
+				xr[k] = lr - a;
+				xi[k] = li;
+			} else {
+				xr[k - 1] = lr - d;
+				xi[k - 1] = li;
+				xr[k] = c;
+			}
+		}
+
+		for (int i = 0; i < k0; i++) {
+			rr[i] = -(T[n * i + k0] * xr[k0]);
+			ri[i] = -(T[n * i + k0] * xi[k0]);
+			if (pair) {
+				rr[i] -= T[n * i + k] * xr[k];
+				ri[i] -= T[n * i + k] * xi[k];
+			}
+		}
+		back_substitute(T, n, k0, lr, li, xr, xi, rr, ri);
+
+		// v = V(:, 0:k) * x, written to column k (and k-1 for the imaginary part)
+		for (uint16_t i = 0; i < n; i++) {
+			float sr = 0.0f;
+			float si = 0.0f;
+
+			for (int l = 0; l <= k; l++) {
+				sr += V[n * i + l] * xr[l];
+				si += V[n * i + l] * xi[l];
+			}
+			rr[i] = sr;
+			ri[i] = si;
+		}
+		for (uint16_t i = 0; i < n; i++) {
+			if (pair) {
+				V[n * i + k - 1] = rr[i];
+				V[n * i + k] = ri[i];
+			} else {
+				V[n * i + k] = rr[i];
+			}
+		}
+		k = k0 - 1;
+	}
+}
+
+int eig_francis(const float *const A, float *wr, float *wi, float *V, float *work, uint16_t row)
+{
+	if (row == 0)
+		return -EINVAL;
+
+	// Window size is at most row/2 so two windows fit in one row x row block
+	float *H = work;
+	float *T = work + row * row;
+	float *U = T + (row / 2) * (row / 2);
+	float *scratch = work + 2 * row * row;
+	float *d = scratch + 4 * row;
+	bool wantv = V != NULL;
+
+	if (H != A)
+		memcpy(H, A, row * row * sizeof(float));
+
+	memset(wr, 0, row * sizeof(float));
+	memset(wi, 0, row * sizeof(float));
+
+	balance_scaled(H, d, row);
+	hessenberg(H, V, scratch, row);
+
+	if (row < EIG_FRANCIS_AED_MIN_ROW) {
+		if (hqr(H, row, row, 0, row - 1, wr, wi, V, row, row, wantv) != 0)
+			return -ENOTSUP;
+	} else {
+		if (multishift(H, row, wr, wi, V, wantv, T, U, scratch) != 0)
+			return -ENOTSUP;
+	}
+
+	if (!wantv)
+		return 0;
+
+	eigenvectors(H, V, wr, wi, row, scratch);
+
+	// Undo balancing and normalize every (complex) vector to unit length
+	for (uint16_t i = 0; i < row; i++)
+		for (uint16_t j = 0; j < row; j++)
+			V[row * i + j] *= d[i];
+
+	for (uint16_t j = 0; j < row; j++) {
+		bool pair = wi[j] != 0.0f && j + 1 < row;
+		float s = 0.0f;
+
+		for (uint16_t i = 0; i < row; i++) {
+			s += V[row * i + j] * V[row * i + j];
+			if (pair)
+				s += V[row * i + j + 1] * V[row * i + j + 1];
+		}
+		s = sqrtf(s);
+		if (s == 0.0f)
+			continue;
+		for (uint16_t i = 0; i < row; i++) {
+			V[row * i + j] /= s;
+			if (pair)
+				V[row * i + j + 1] /= s;
+		}
+		if (pair)
+			j++;
+	}
+
+	return 0;
+}
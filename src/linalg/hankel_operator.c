@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+
+#include <errno.h>
+#include <string.h>
+
+/*
+ * Element (i*row_v + j, c) of H is V[j][i + c + shift], so every product with
+ * H or H' is a correlation of a row of V with the (reversed) input. The
+ * correlation is a linear convolution evaluated with a transform of length
+ * n >= block_rows + column - 1, which is long enough that the circular wrap
+ * only lands in outputs that are not used.
+ */
+
+static uint32_t transform_size(uint16_t block_rows, uint16_t column_h)
+{
+	return fft_size((uint32_t)block_rows + column_h - 1);
+}
+
+uint32_t hankel_operator_storage_size(uint16_t row_v, uint16_t row_h, uint16_t column_h)
+{
+	if (row_v == 0 || row_h == 0 || column_h == 0)
+		return 0;
+
+	const uint32_t n = transform_size(row_h / row_v, column_h);
+
+	// Plan tables, one spectrum per row of V and two work buffers
+	return fft_plan_storage_size(n) + 2 * n * row_v + 4 * n;
+}
+
+int hankel_operator_init(struct hankel_operator *self, const float *const V, uint16_t row_v,
+			 uint16_t column_v, uint16_t row_h, uint16_t column_h, uint16_t shift,
+			 float *storage)
+{
+	if (row_v == 0 || row_h == 0 || column_h == 0 || row_h % row_v != 0)
+		return -EINVAL;
+
+	const uint16_t block_rows = row_h / row_v;
+	const uint32_t n = transform_size(block_rows, column_h);
+
+	if (fft_plan_init(&self->plan, n, storage) != 0)
+		return -EINVAL;
+
+	self->row_v = row_v;
+	self->row = row_h;
+	self->column = column_h;
+	self->spectrum = storage + fft_plan_storage_size(n);
+	self->work = self->spectrum + 2 * n * row_v;
+
+	// Only samples that appear in H are transformed, later ones are zero
+	const uint32_t length = (uint32_t)block_rows + column_h - 1;
+
+	for (uint16_t j = 0; j < row_v; j++) {
+		float *h = &self->spectrum[2 * n * j];
+
+		memset(h, 0, 2 * n * sizeof(float));
+		for (uint32_t t = 0; t < length && t + shift < column_v; t++)
+			h[2 * t] = V[column_v * j + t + shift];
+		fft_forward(&self->plan, h);
+	}
+
+	return 0;
+}
+
+// z = x.*y for interleaved complex vectors of length n
+static void multiply(float *z, const float *const x, const float *const y, uint32_t n)
+{
+	for (uint32_t k = 0; k < n; k++) {
+		const float re = x[2 * k] * y[2 * k] - x[2 * k + 1] * y[2 * k + 1];
+		const float im = x[2 * k] * y[2 * k + 1] + x[2 * k + 1] * y[2 * k];
+
+		z[2 * k] = re;
+		z[2 * k + 1] = im;
+	}
+}
+
+void hankel_operator(float *y, const float *const x, bool transposed, void *ctx)
+{
+	struct hankel_operator *self = ctx;
+	const uint32_t n = self->plan.n;
+	const uint16_t row_v = self->row_v;
+	const uint16_t block_rows = self->row / row_v;
+	const uint16_t column = self->column;
+	float *X = self->work;
+	float *Y = self->work + 2 * n;
+
+	if (!transposed) {
+		// y[i*row_v + j] = sum_c V[j][i + c + shift] * x[c]
+		memset(X, 0, 2 * n * sizeof(float));
+		for (uint16_t c = 0; c < column; c++)
+			X[2 * (column - 1 - c)] = x[c];
+		fft_forward(&self->plan, X);
+
+		for (uint16_t j = 0; j < row_v; j++) {
+			multiply(Y, X, &self->spectrum[2 * n * j], n);
+			fft_inverse(&self->plan, Y);
+			for (uint16_t i = 0; i < block_rows; i++)
+				y[row_v * i + j] = Y[2 * (i + column - 1)];
+		}
+		return;
+	}
+
+	// y[c] = sum_j sum_i V[j][i + c + shift] * x[i*row_v + j], summed in frequency domain
+	memset(Y, 0, 2 * n * sizeof(float));
+	for (uint16_t j = 0; j < row_v; j++) {
+		memset(X, 0, 2 * n * sizeof(float));
+		for (uint16_t i = 0; i < block_rows; i++)
+			X[2 * (block_rows - 1 - i)] = x[row_v * i + j];
+		fft_forward(&self->plan, X);
+		multiply(X, X, &self->spectrum[2 * n * j], n);
+		for (uint32_t k = 0; k < 2 * n; k++)
+			Y[k] += X[k];
+	}
+	fft_inverse(&self->plan, Y);
+	for (uint16_t c = 0; c < column; c++)
+		y[c] = Y[2 * (c + block_rows - 1)];
+}
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+#include "linalg_internal.h"
+
+#include <math.h>
+#include <string.h>
+
+void householder_apply(float *B, uint16_t ldb, uint16_t p, const float *const W, float tau,
+		       float *s, uint16_t k, uint16_t m, uint16_t n)
+{
+	if (tau == 0.0f)
+		return;
+
+	memcpy(s, &B[ldb * k], p * sizeof(float));
+	for (uint16_t i = k + 1; i < m; i++) {
+		const float v = W[n * i + k];
+
+		for (uint16_t j = 0; j < p; j++)
+			s[j] += v * B[ldb * i + j];
+	}
+	for (uint16_t j = 0; j < p; j++) {
+		s[j] *= tau;
+		B[ldb * k + j] -= s[j];
+	}
+	for (uint16_t i = k + 1; i < m; i++) {
+		const float v = W[n * i + k];
+
+		for (uint16_t j = 0; j < p; j++)
+			B[ldb * i + j] -= v * s[j];
+	}
+}
+
+// Squared norm of W[k .. m-1][j]
+static float column_norm2(const float *const W, uint16_t j, uint16_t k, uint16_t m, uint16_t n)
+{
+	float sum = 0.0f;
+
+	for (uint16_t i = k; i < m; i++)
+		sum += W[n * i + j] * W[n * i + j];
+	return sum;
+}
+
+void householder_qr(float *W, float *tau, uint16_t *perm, float *s, uint16_t m, uint16_t n)
+{
+	if (perm)
+		for (uint16_t j = 0; j < n; j++)
+			perm[j] = j;
+
+	for (uint16_t k = 0; k < n; k++) {
+		float norm2 = column_norm2(W, k, k, m, n);
+
+		if (perm) {
+			// Remaining column norms are recomputed to avoid downdating errors
+			uint16_t pivot = k;
+
+			for (uint16_t j = k + 1; j < n; j++) {
+				const float sum = column_norm2(W, j, k, m, n);
+
+				if (sum > norm2) {
+					norm2 = sum;
+					pivot = j;
+				}
+			}
+			if (pivot != k) {
+				for (uint16_t i = 0; i < m; i++) {
+					const float tmp = W[n * i + k];
+
+					W[n * i + k] = W[n * i + pivot];
+					W[n * i + pivot] = tmp;
+				}
+
+				const uint16_t tmp = perm[k];
+
+				perm[k] = perm[pivot];
+				perm[pivot] = tmp;
+			}
+		}
+
+		const float norm = sqrtf(norm2);
+		const float x0 = W[n * k + k];
+		const float alpha = x0 > 0.0f ? -norm : norm;
+		const float v0 = x0 - alpha;
+
+		if (norm == 0.0f || v0 == 0.0f) {
+			tau[k] = 0.0f;
+			continue;
+		}
+
+		for (uint16_t i = k + 1; i < m; i++)
+			W[n * i + k] /= v0;
+		tau[k] = -v0 / alpha;
+		W[n * k + k] = alpha;
+
+		// Apply H = I - tau * v * v' to the trailing columns
+		householder_apply(&W[k + 1], n, n - k - 1, W, tau[k], s, k, m, n);
+	}
+}
@@ -0,0 +1,42 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+/*
+ * Helpers shared by the files of the linalg module. Not part of the public
+ * interface.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+static inline float dot(const float *const a, const float *const b, uint16_t row)
+{
+	float sum = 0.0f;
+
+	for (uint16_t i = 0; i < row; i++)
+		sum += a[i] * b[i];
+	return sum;
+}
+
+/*
+ * Householder QR of the tall matrix W [m*n] in place, defined in
+ * householder.c. R ends up in the upper triangle and the reflectors v (with
+ * implicit v[0] = 1) below the diagonal. With perm [n] the column with the
+ * largest remaining norm is moved forward before every step so the diagonal
+ * of R is non-increasing in magnitude, pass NULL for no pivoting. s is
+ * scratch [n].
+ */
+void householder_qr(float *W, float *tau, uint16_t *perm, float *s, uint16_t m, uint16_t n);
+
+/*
+ * Apply reflector k of W [m*n] with factor tau to the rows k .. m-1 of
+ * B [m*p] with leading dimension ldb. s is scratch [p].
+ */
+void householder_apply(float *B, uint16_t ldb, uint16_t p, const float *const W, float tau,
+		       float *s, uint16_t k, uint16_t m, uint16_t n);
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+#include "linalg_internal.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+int linsolve_cg(float *x, linear_operator_t A, void *ctx, const float *const b, uint16_t row,
+		const struct linsolve_options *options, struct linsolve_stats *stats)
+{
+	if (!A || !options || row == 0)
+		return -EINVAL;
+
+	float r[row], z[row], p[row], q[row];
+	const float bnorm = sqrtf(dot(b, b, row));
+	uint16_t k = 0;
+	float residual = 0.0f;
+	int status = -ENOTSUP;
+
+	// The solution of Ax = 0 is x = 0
+	if (bnorm == 0.0f) {
+		memset(x, 0, row * sizeof(float));
+		if (stats) {
+			stats->iterations = 0;
+			stats->residual = 0.0f;
+		}
+		return 0;
+	}
+
+	// r = b - A*x
+	A(r, x, row, ctx);
+	for (uint16_t i = 0; i < row; i++)
+		r[i] = b[i] - r[i];
+
+	if (options->preconditioner)
+		options->preconditioner(z, r, row, options->preconditioner_ctx);
+	else
+		memcpy(z, r, sizeof(z));
+	memcpy(p, z, sizeof(p));
+
+	float rz = dot(r, z, row);
+
+	for (;;) {
+		residual = sqrtf(dot(r, r, row)) / bnorm;
+		if (residual <= options->tolerance) {
+			status = 0;
+			break;
+		}
+		if (k == options->max_iterations)
+			break;
+
+		A(q, p, row, ctx);
+
+		const float pq = dot(p, q, row);
+
+		// A is not positive definite along p
+		if (!(pq > 0.0f))
+			break;
+
+		const float alpha = rz / pq;
+
+		for (uint16_t i = 0; i < row; i++) {
+			x[i] += alpha * p[i];
+			r[i] -= alpha * q[i];
+		}
+
+		if (options->preconditioner)
+			options->preconditioner(z, r, row, options->preconditioner_ctx);
+		else
+			memcpy(z, r, sizeof(z));
+
+		const float rz_next = dot(r, z, row);
+		const float beta = rz_next / rz;
+
+		rz = rz_next;
+		for (uint16_t i = 0; i < row; i++)
+			p[i] = z[i] + beta * p[i];
+		k++;
+	}
+
+	if (stats) {
+		stats->iterations = k;
+		stats->residual = residual;
+	}
+	return status;
+}
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+#include "linalg_internal.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+int linsolve_gmres(float *x, linear_operator_t A, void *ctx, const float *const b, uint16_t row,
+		   const struct linsolve_options *options, struct linsolve_stats *stats, float *work)
+{
+	if (!A || !options || !work || row == 0)
+		return -EINVAL;
+
+	uint16_t m = options->restart ? options->restart : LINSOLVE_GMRES_RESTART;
+
+	if (m > row)
+		m = row;
+
+	// Krylov basis V [(m+1)*row], Hessenberg H [(m+1)*m], rotations and rhs g
+	float *V = work;
+	float *H = V + (m + 1) * row;
+	float *cs = H + (m + 1) * m;
+	float *sn = cs + m;
+	float *g = sn + m;
+	float *y = g + m + 1;
+	float *w = y + m;
+	float *z = w + row;
+	float *rhs = z + row;
+	const float bnorm = sqrtf(dot(b, b, row));
+	uint16_t k = 0;
+	float residual = 0.0f;
+
+	if (bnorm == 0.0f) {
+		memset(x, 0, row * sizeof(float));
+		if (stats) {
+			stats->iterations = 0;
+			stats->residual = 0.0f;
+		}
+		return 0;
+	}
+
+	// b is needed at every restart, keep it in case x is the same vector
+	memcpy(rhs, b, row * sizeof(float));
+
+	for (;;) {
+		// r = b - A*x starts a new cycle
+		float *v0 = &V[0];
+
+		A(v0, x, row, ctx);
+		for (uint16_t i = 0; i < row; i++)
+			v0[i] = rhs[i] - v0[i];
+
+		const float beta = sqrtf(dot(v0, v0, row));
+
+		residual = beta / bnorm;
+		if (residual <= options->tolerance || k == options->max_iterations)
+			break;
+
+		for (uint16_t i = 0; i < row; i++)
+			v0[i] /= beta;
+		memset(g, 0, (m + 1) * sizeof(float));
+		g[0] = beta;
+
+		uint16_t j = 0;
+
+		while (j < m && k < options->max_iterations) {
+			float *vj = &V[row * j];
+			float *vn = &V[row * (j + 1)];
+
+			// w = A*M*v_j
+			if (options->preconditioner) {
+				options->preconditioner(z, vj, row, options->preconditioner_ctx);
+				A(w, z, row, ctx);
+			} else {
+				A(w, vj, row, ctx);
+			}
+
+			// Modified Gram-Schmidt against the basis
+			for (uint16_t i = 0; i <= j; i++) {
+				const float h = dot(w, &V[row * i], row);
+
+				H[m * i + j] = h;
+				for (uint16_t l = 0; l < row; l++)
+					w[l] -= h * V[row * i + l];
+			}
+
+			const float hn = sqrtf(dot(w, w, row));
+
+			H[m * (j + 1) + j] = hn;
+			if (hn > 0.0f)
+				for (uint16_t l = 0; l < row; l++)
+					vn[l] = w[l] / hn;
+
+			// Previous rotations, then a new one that zeroes H(j+1, j)
+			for (uint16_t i = 0; i < j; i++) {
+				const float a = H[m * i + j];
+				const float c = H[m * (i + 1) + j];
+
+				H[m * i + j] = cs[i] * a + sn[i] * c;
+				H[m * (i + 1) + j] = -sn[i] * a + cs[i] * c;
+			}
+
+			const float a = H[m * j + j];
+			const float r = hypotf(a, hn);
+
+			cs[j] = r > 0.0f ? a / r : 1.0f;
+			sn[j] = r > 0.0f ? hn / r : 0.0f;
+			H[m * j + j] = r;
+			H[m * (j + 1) + j] = 0.0f;
+			g[j + 1] = -sn[j] * g[j];
+			g[j] = cs[j] * g[j];
+
+			j++;
+			k++;
+			residual = fabsf(g[j]) / bnorm;
+			// Converged or the Krylov space is invariant
+			if (residual <= options->tolerance || hn == 0.0f)
+				break;
+		}
+
+		// Solve H(0:j, 0:j) * y = g and update x += M * V * y
+		for (int i = j - 1; i >= 0; i--) {
+			float sum = g[i];
+
+			for (uint16_t l = i + 1; l < j; l++)
+				sum -= H[m * i + l] * y[l];
+			y[i] = H[m * i + i] != 0.0f ? sum / H[m * i + i] : 0.0f;
+		}
+		memset(w, 0, row * sizeof(float));
+		for (uint16_t i = 0; i < j; i++)
+			for (uint16_t l = 0; l < row; l++)
+				w[l] += y[i] * V[row * i + l];
+		if (options->preconditioner) {
+			options->preconditioner(z, w, row, options->preconditioner_ctx);
+			memcpy(w, z, row * sizeof(float));
+		}
+		for (uint16_t l = 0; l < row; l++)
+			x[l] += w[l];
+	}
+
+	if (stats) {
+		stats->iterations = k;
+		stats->residual = residual;
+	}
+	return residual <= options->tolerance ? 0 : -ENOTSUP;
+}
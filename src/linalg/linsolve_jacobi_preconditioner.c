@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+
+void linsolve_jacobi_preconditioner(float *y, const float *const x, uint16_t row, void *ctx)
+{
+	const float *const diagonal = ctx;
+
+	for (uint16_t i = 0; i < row; i++)
+		y[i] = diagonal[i] != 0.0f ? x[i] / diagonal[i] : x[i];
+}
@@ -9,6 +9,7 @@
 
 #include "control/linalg.h"
 
+#include <errno.h>
 #include <string.h>
 
 /*
@@ -33,3 +34,32 @@ void linsolve_lower_triangular(const float *const A, float x[], const float *con
 		x[i] = (b[i] - sum) / A[row * i + i];
 	}
 }
+
+int linsolve_lower_triangular_view(struct mat_view X, const struct mat_view A,
+				   const struct mat_view B)
+{
+	if (A.rows != A.cols || B.rows != A.rows || X.rows != B.rows || X.cols != B.cols)
+		return -EINVAL;
+
+	// Row i of X only depends on rows above it, so X may be B
+	for (uint32_t i = 0; i < A.rows; i++) {
+		float *x = &X.data[X.ld * i];
+		const float *b = &B.data[B.ld * i];
+
+		if (x != b)
+			memcpy(x, b, X.cols * sizeof(float));
+		for (uint32_t j = 0; j < i; j++) {
+			const float a = A.data[A.ld * i + j];
+			const float *xj = &X.data[X.ld * j];
+
+			for (uint32_t k = 0; k < X.cols; k++)
+				x[k] -= a * xj[k];
+		}
+
+		const float d = 1.0f / A.data[A.ld * i + i];
+
+		for (uint32_t k = 0; k < X.cols; k++)
+			x[k] *= d;
+	}
+	return 0;
+}
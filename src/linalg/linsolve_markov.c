@@ -7,23 +7,197 @@
  * Training: https://swedishembedded.com/training
  */
 
-#include "control/sysid.h"
+#include "control/linalg.h"
 
 #include <string.h>
 
+// z = x.*y for interleaved complex vectors of length n
+static void multiply(float *z, const float *const x, const float *const y, uint32_t n)
+{
+	for (uint32_t k = 0; k < n; k++) {
+		const float re = x[2 * k] * y[2 * k] - x[2 * k + 1] * y[2 * k + 1];
+		const float im = x[2 * k] * y[2 * k + 1] + x[2 * k + 1] * y[2 * k];
+
+		z[2 * k] = re;
+		z[2 * k + 1] = im;
+	}
+}
+
+// Forward substitution with the lower triangular Toeplitz matrix of u, x is the right hand side
+static void solve_direct(float *x, const float *const u, uint32_t n)
+{
+	for (uint32_t i = 0; i < n; i++) {
+		float sum = 0;
+
+		for (uint32_t j = 0; j < i; j++)
+			sum += u[i - j] * x[j];
+		x[i] = (x[i] - sum) / u[0];
+	}
+}
+
+// Floats of the transforms of u for the block lengths size, size/2, .. that use FFT
+static uint32_t spectra_size(uint32_t size)
+{
+	uint32_t total = 0;
+
+	for (uint32_t len = size; len >= LINSOLVE_MARKOV_FFT_MIN_COLUMN; len /= 2)
+		total += len + 2;
+	return total;
+}
+
+// Transforms of u[0 .. len-1] for the same block lengths, longest first
+static void transform_input(float *U, const float *const u, uint32_t n, uint32_t size)
+{
+	for (uint32_t len = size; len >= LINSOLVE_MARKOV_FFT_MIN_COLUMN; len /= 2) {
+		float storage[fft_real_plan_storage_size(len)];
+		struct fft_real_plan plan;
+
+		fft_real_plan_init(&plan, len, storage);
+		memset(U, 0, (len + 2) * sizeof(float));
+		memcpy(U, u, (len < n ? len : n) * sizeof(float));
+		fft_forward_real(&plan, U, U);
+		U += len + 2;
+	}
+}
+
+/*
+ * x[half .. n-1] -= (u*x[0 .. half-1])[half .. n-1] for a block of length len,
+ * U is the transform of u[0 .. len-1]. The wrap of the circular convolution
+ * only reaches indices below half. Kept out of solve_fft() so the buffers are
+ * released before recursing.
+ */
+static void correct(float *x, const float *const U, uint32_t half, uint32_t n, uint32_t len)
+{
+	float storage[fft_real_plan_storage_size(len)];
+	float X[len + 2];
+	struct fft_real_plan plan;
+
+	fft_real_plan_init(&plan, len, storage);
+	memcpy(X, x, half * sizeof(float));
+	memset(&X[half], 0, (len + 2 - half) * sizeof(float));
+	fft_forward_real(&plan, X, X);
+	multiply(X, X, U, len / 2 + 1);
+	fft_inverse_real(&plan, X, X);
+	for (uint32_t k = half; k < n; k++)
+		x[k] -= X[k];
+}
+
+/*
+ * Forward substitution reorganized as divide and conquer over blocks of
+ * power of two length len of which the first n are used. Once the first
+ * half of x is solved its contribution to the second half of the right hand
+ * side is a convolution, computed with FFT, and the second half is solved
+ * the same way. This computes the same sums as substitution in
+ * O(n*log(n)^2) instead of O(n^2), with FFT rounding added to the coupling
+ * in proportion to the block magnitude. All blocks of one length share the
+ * transform of u in U, the next shorter length follows it.
+ */
+static void solve_fft(float *x, const float *const u, const float *const U, uint32_t n,
+		      uint32_t len)
+{
+	if (len < LINSOLVE_MARKOV_FFT_MIN_COLUMN) {
+		solve_direct(x, u, n);
+		return;
+	}
+
+	const uint32_t half = len / 2;
+	const float *const next = &U[len + 2];
+
+	if (n <= half) {
+		solve_fft(x, u, next, n, half);
+		return;
+	}
+	solve_fft(x, u, next, half, half);
+	correct(x, U, half, n, len);
+	solve_fft(&x[half], u, next, n - half, half);
+}
+
+// Solve u*x = r in place, x holds r on entry
+static void solve(float *x, const float *const u, uint16_t n)
+{
+	const uint32_t size = fft_size(n);
+
+	if (size < LINSOLVE_MARKOV_FFT_MIN_COLUMN) {
+		solve_direct(x, u, n);
+		return;
+	}
+
+	float U[spectra_size(size)];
+
+	transform_input(U, u, n, size);
+	solve_fft(x, u, U, n, size);
+}
+
 void linsolve_markov(float *g, const float *const y, const float *const u, uint16_t row,
 		     uint16_t column)
 {
-	memset(g, 0, row * column * sizeof(float));
-
 	// If we have more than 1 rows = MIMO system
 	for (uint16_t k = 0; k < row; k++) {
-		for (uint16_t i = 0; i < column; i++) {
-			float sum = 0;
-			for (int j = 0; j < i; j++) {
-				sum += u[k * column + i - j] * g[k * column + j];
+		const float *yk = &y[k * column];
+		const float *uk = &u[k * column];
+		float *gk = &g[k * column];
+		uint16_t delay = 0;
+
+		// Leading zeros of u are a delay, y is shifted by the same amount
+		while (delay < column && uk[delay] == 0.0f)
+			delay++;
+
+		const uint16_t n = column - delay;
+
+		// g can be the same as y, the solution overwrites the right hand side
+		memmove(gk, &yk[delay], n * sizeof(float));
+		memset(&gk[n], 0, delay * sizeof(float));
+		solve(gk, &uk[delay], n);
+	}
+}
+
+void linsolve_markov_regularized(float *g, const float *const y, const float *const u,
+				 uint16_t row, uint16_t column, float lambda, float *work)
+{
+	const uint32_t size = fft_size(2 * (uint32_t)column);
+	const uint32_t bins = size / 2 + 1;
+	float *storage = work;
+	float *U = storage + fft_real_plan_storage_size(size);
+	float *Y = U + 2 * bins;
+	struct fft_real_plan plan;
+
+	fft_real_plan_init(&plan, size, storage);
+
+	for (uint16_t k = 0; k < row; k++) {
+		memset(U, 0, 2 * bins * sizeof(float));
+		memset(Y, 0, 2 * bins * sizeof(float));
+		memcpy(U, &u[k * column], column * sizeof(float));
+		memcpy(Y, &y[k * column], column * sizeof(float));
+		fft_forward_real(&plan, U, U);
+		fft_forward_real(&plan, Y, Y);
+
+		// Regularization is relative to the mean power of u, bins 1 .. size/2 - 1 appear twice
+		float power = 0.0f;
+
+		for (uint32_t i = 0; i < bins; i++) {
+			const float p = U[2 * i] * U[2 * i] + U[2 * i + 1] * U[2 * i + 1];
+
+			power += (i == 0 || i == bins - 1) ? p : 2.0f * p;
+		}
+		power /= (float)size;
+
+		// G = Y*conj(U) / (|U|^2 + lambda*power)
+		for (uint32_t i = 0; i < bins; i++) {
+			const float ur = U[2 * i];
+			const float ui = U[2 * i + 1];
+			const float yr = Y[2 * i];
+			const float yi = Y[2 * i + 1];
+			const float d = ur * ur + ui * ui + lambda * power;
+
+			if (d == 0.0f) {
+				Y[2 * i] = 0.0f;
+				Y[2 * i + 1] = 0.0f;
+				continue;
 			}
-			g[k * column + i] = (y[k * column + i] - sum) / u[k * column + 0];
+			Y[2 * i] = (yr * ur + yi * ui) / d;
+			Y[2 * i + 1] = (yi * ur - yr * ui) / d;
 		}
+		fft_inverse_real(&plan, Y, Y);
+		memcpy(&g[k * column], Y, column * sizeof(float));
 	}
 }
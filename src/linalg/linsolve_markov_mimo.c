@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+
+#include <errno.h>
+#include <string.h>
+
+/*
+ * Least squares fit of y[t] = sum_s G_s*u[t - s] over lags s < L. With
+ * R(k) = sum_t u[t + k]*u[t]' the normal equations are
+ *
+ *   T*X = Z, T(a, b) = R(b - a), Z(b) = sum_t u[t - b]*y[t]'
+ *
+ * where X(s) = G_s'. T is symmetric block Toeplitz, so it is solved with
+ * the block Levinson recursion in O(L^2 * m^2 * (m + p)) after the
+ * correlations have been computed with FFT.
+ */
+
+// z = x.*conj(y) for interleaved complex vectors of length n
+static void correlate(float *z, const float *const x, const float *const y, uint32_t n)
+{
+	for (uint32_t k = 0; k < n; k++) {
+		const float re = x[2 * k] * y[2 * k] + x[2 * k + 1] * y[2 * k + 1];
+		const float im = x[2 * k + 1] * y[2 * k] - x[2 * k] * y[2 * k + 1];
+
+		z[2 * k] = re;
+		z[2 * k + 1] = im;
+	}
+}
+
+// C [m*p] = A [m*m] * B [m*p] + C when accumulate is set, otherwise C = A*B
+static void mul_add(float *C, const float *const A, const float *const B, uint16_t m, uint16_t p,
+		    bool accumulate)
+{
+	if (!accumulate)
+		memset(C, 0, m * p * sizeof(float));
+	for (uint16_t i = 0; i < m; i++)
+		for (uint16_t k = 0; k < m; k++)
+			for (uint16_t j = 0; j < p; j++)
+				C[p * i + j] += A[m * i + k] * B[p * k + j];
+}
+
+// Block R(d) [m*m] for any sign of d, R(-d) = R(d)'
+static void block(float *out, const float *const R, int32_t d, uint16_t m)
+{
+	if (d >= 0) {
+		memcpy(out, &R[m * m * d], m * m * sizeof(float));
+		return;
+	}
+	tran(out, &R[m * m * -d], m, m);
+}
+
+int linsolve_markov_mimo(float *G, const float *const y, const float *const u, uint16_t outputs,
+			 uint16_t inputs, uint16_t column, uint16_t lags, float lambda, float *work)
+{
+	if (outputs == 0 || inputs == 0 || lags == 0 || lags > column)
+		return -EINVAL;
+
+	const uint16_t m = inputs;
+	const uint16_t p = outputs;
+	// Real transforms keep the bins 0 .. size/2 of every signal
+	const uint32_t size = fft_size((uint32_t)column + lags);
+	const uint32_t stride = 2 * (size / 2 + 1);
+	float *storage = work;
+	float *U = storage + fft_real_plan_storage_size(size);
+	float *W = U + m * stride;
+	float *Y = W + stride;
+	float R[lags * m * m];
+	float Z[lags * m * p];
+	struct fft_real_plan plan;
+
+	fft_real_plan_init(&plan, size, storage);
+	for (uint16_t i = 0; i < m; i++) {
+		float *Ui = &U[stride * i];
+
+		memset(Ui, 0, stride * sizeof(float));
+		memcpy(Ui, &u[column * i], column * sizeof(float));
+		fft_forward_real(&plan, Ui, Ui);
+	}
+
+	// R(k)[i][j] = sum_t u_i[t + k]*u_j[t]
+	for (uint16_t i = 0; i < m; i++) {
+		for (uint16_t j = 0; j < m; j++) {
+			correlate(W, &U[stride * i], &U[stride * j], stride / 2);
+			fft_inverse_real(&plan, W, W);
+			for (uint16_t k = 0; k < lags; k++)
+				R[m * m * k + m * i + j] = W[k];
+		}
+	}
+
+	// Z(b)[i][o] = sum_t u_i[t - b]*y_o[t]
+	for (uint16_t o = 0; o < p; o++) {
+		memset(Y, 0, stride * sizeof(float));
+		memcpy(Y, &y[column * o], column * sizeof(float));
+		fft_forward_real(&plan, Y, Y);
+		for (uint16_t i = 0; i < m; i++) {
+			correlate(W, Y, &U[stride * i], stride / 2);
+			fft_inverse_real(&plan, W, W);
+			for (uint16_t b = 0; b < lags; b++)
+				Z[m * p * b + p * i + o] = W[b];
+		}
+	}
+
+	// Ridge term relative to the mean input power
+	float power = 0.0f;
+
+	for (uint16_t i = 0; i < m; i++)
+		power += R[m * i + i];
+	for (uint16_t i = 0; i < m; i++)
+		R[m * i + i] += lambda * power / (float)m;
+
+	/*
+	 * Block Levinson. A (forward) and B (backward) satisfy
+	 * T_n*A = [Ef; 0; ...] and T_n*B = [...; 0; Eb] with A(0) = B(n-1) = I
+	 * and X solves T_n*X = Z(0 .. n-1).
+	 */
+	float A[lags * m * m], B[lags * m * m], X[lags * m * p];
+	float An[lags * m * m], Bn[lags * m * m];
+	float Ef[m * m], Eb[m * m], Df[m * m], Db[m * m], Kf[m * m], Kb[m * m];
+	float Ri[m * m], Inv[m * m], T1[m * m], E[m * p], Kx[m * p];
+
+	memset(A, 0, m * m * sizeof(float));
+	for (uint16_t i = 0; i < m; i++)
+		A[m * i + i] = 1.0f;
+	memcpy(B, A, m * m * sizeof(float));
+	memcpy(Ef, R, m * m * sizeof(float));
+	memcpy(Eb, R, m * m * sizeof(float));
+	if (inv(Inv, R, m) != 0)
+		return -ENOTSUP;
+	mul_add(X, Inv, Z, m, p, false);
+
+	for (uint16_t n = 1; n < lags; n++) {
+		// Df = sum_k R(k - n)*A(k), Db = sum_k R(k + 1)*B(k)
+		memset(Df, 0, sizeof(Df));
+		memset(Db, 0, sizeof(Db));
+		memset(E, 0, sizeof(E));
+		for (uint16_t k = 0; k < n; k++) {
+			block(Ri, R, (int32_t)k - n, m);
+			mul_add(Df, Ri, &A[m * m * k], m, m, true);
+			mul_add(E, Ri, &X[m * p * k], m, p, true);
+			block(Ri, R, (int32_t)k + 1, m);
+			mul_add(Db, Ri, &B[m * m * k], m, m, true);
+		}
+
+		// Kf = -inv(Eb)*Df, Kb = -inv(Ef)*Db
+		if (inv(Inv, Eb, m) != 0)
+			return -ENOTSUP;
+		mul_add(Kf, Inv, Df, m, m, false);
+		if (inv(Inv, Ef, m) != 0)
+			return -ENOTSUP;
+		mul_add(Kb, Inv, Db, m, m, false);
+		for (uint16_t i = 0; i < m * m; i++) {
+			Kf[i] = -Kf[i];
+			Kb[i] = -Kb[i];
+		}
+
+		// A' = [A; 0] + [0; B]*Kf, B' = [0; B] + [A; 0]*Kb
+		for (uint16_t k = 0; k <= n; k++) {
+			float *a = &An[m * m * k];
+			float *b = &Bn[m * m * k];
+
+			memset(a, 0, m * m * sizeof(float));
+			memset(b, 0, m * m * sizeof(float));
+			if (k < n) {
+				memcpy(a, &A[m * m * k], m * m * sizeof(float));
+				mul_add(b, &A[m * m * k], Kb, m, m, true);
+			}
+			if (k > 0) {
+				memcpy(T1, &B[m * m * (k - 1)], m * m * sizeof(float));
+				mul_add(a, T1, Kf, m, m, true);
+				for (uint16_t i = 0; i < m * m; i++)
+					b[i] += T1[i];
+			}
+		}
+		memcpy(A, An, (n + 1) * m * m * sizeof(float));
+		memcpy(B, Bn, (n + 1) * m * m * sizeof(float));
+
+		// Ef += Db*Kf, Eb += Df*Kb
+		mul_add(Ef, Db, Kf, m, m, true);
+		mul_add(Eb, Df, Kb, m, m, true);
+
+		// X' = [X; 0] + B*inv(Eb)*(Z(n) - E)
+		for (uint16_t i = 0; i < m * p; i++)
+			E[i] = Z[m * p * n + i] - E[i];
+		if (inv(Inv, Eb, m) != 0)
+			return -ENOTSUP;
+		mul_add(Kx, Inv, E, m, p, false);
+		memset(&X[m * p * n], 0, m * p * sizeof(float));
+		for (uint16_t k = 0; k <= n; k++)
+			mul_add(&X[m * p * k], &B[m * m * k], Kx, m, p, true);
+	}
+
+	// G = [G_0 ... G_L-1] with G_s = X(s)'
+	for (uint16_t s = 0; s < lags; s++)
+		for (uint16_t o = 0; o < p; o++)
+			for (uint16_t i = 0; i < m; i++)
+				G[m * lags * o + m * s + i] = X[m * p * s + p * i + o];
+
+	return 0;
+}
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+#include "linalg_internal.h"
+
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+static void precondition(float *y, const float *const x, uint16_t row,
+			 const struct linsolve_options *options)
+{
+	if (options->preconditioner)
+		options->preconditioner(y, x, row, options->preconditioner_ctx);
+	else
+		memcpy(y, x, row * sizeof(float));
+}
+
+int linsolve_minres(float *x, linear_operator_t A, void *ctx, const float *const b, uint16_t row,
+		    const struct linsolve_options *options, struct linsolve_stats *stats)
+{
+	if (!A || !options || row == 0)
+		return -EINVAL;
+
+	float r1[row], r2[row], y[row], v[row], w[row], w1[row], w2[row];
+	uint16_t k = 0;
+	float residual = 0.0f;
+	int status = -ENOTSUP;
+
+	// Residuals are measured in the norm defined by the preconditioner
+	precondition(w, b, row, options);
+
+	const float bnorm = sqrtf(fabsf(dot(b, w, row)));
+
+	if (bnorm == 0.0f) {
+		memset(x, 0, row * sizeof(float));
+		if (stats) {
+			stats->iterations = 0;
+			stats->residual = 0.0f;
+		}
+		return 0;
+	}
+
+	// r1 = b - A*x, y = M*r1
+	A(r1, x, row, ctx);
+	for (uint16_t i = 0; i < row; i++)
+		r1[i] = b[i] - r1[i];
+	precondition(y, r1, row, options);
+
+	float beta1 = dot(r1, y, row);
+
+	if (beta1 < 0.0f) {
+		// Preconditioner is not positive definite
+		beta1 = 0.0f;
+	} else if (sqrtf(beta1) <= options->tolerance * bnorm) {
+		residual = sqrtf(beta1) / bnorm;
+		status = 0;
+	} else {
+		beta1 = sqrtf(beta1);
+		memcpy(r2, r1, sizeof(r2));
+		memset(w, 0, sizeof(w));
+		memset(w2, 0, sizeof(w2));
+
+		float beta = beta1, oldb = 0.0f;
+		float dbar = 0.0f, epsln = 0.0f, phibar = beta1;
+		float cs = -1.0f, sn = 0.0f;
+
+		while (k < options->max_iterations) {
+			// Lanczos step
+			const float s = 1.0f / beta;
+
+			for (uint16_t i = 0; i < row; i++)
+				v[i] = s * y[i];
+			A(y, v, row, ctx);
+			if (k > 0)
+				for (uint16_t i = 0; i < row; i++)
+					y[i] -= (beta / oldb) * r1[i];
+
+			const float alpha = dot(v, y, row);
+
+			for (uint16_t i = 0; i < row; i++)
+				y[i] -= (alpha / beta) * r2[i];
+			memcpy(r1, r2, sizeof(r1));
+			memcpy(r2, y, sizeof(r2));
+			precondition(y, r2, row, options);
+			oldb = beta;
+			beta = dot(r2, y, row);
+			k++;
+			if (beta < 0.0f)
+				break;
+			beta = sqrtf(beta);
+
+			// Apply the previous rotation and compute the next one
+			const float oldeps = epsln;
+			const float delta = cs * dbar + sn * alpha;
+			const float gbar = sn * dbar - cs * alpha;
+
+			epsln = sn * beta;
+			dbar = -cs * beta;
+
+			float gamma = hypotf(gbar, beta);
+
+			if (gamma < FLT_MIN)
+				gamma = FLT_MIN;
+			cs = gbar / gamma;
+			sn = beta / gamma;
+
+			const float phi = cs * phibar;
+
+			phibar = sn * phibar;
+
+			// Update the search direction and the solution
+			for (uint16_t i = 0; i < row; i++) {
+				w1[i] = w2[i];
+				w2[i] = w[i];
+				w[i] = (v[i] - oldeps * w1[i] - delta * w2[i]) / gamma;
+				x[i] += phi * w[i];
+			}
+
+			residual = phibar / bnorm;
+			if (residual <= options->tolerance || beta == 0.0f) {
+				status = 0;
+				break;
+			}
+		}
+	}
+
+	if (stats) {
+		stats->iterations = k;
+		stats->residual = residual;
+	}
+	return status;
+}
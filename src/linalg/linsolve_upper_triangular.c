@@ -9,6 +9,7 @@
 
 #include "control/linalg.h"
 
+#include <errno.h>
 #include <string.h>
 
 /*
@@ -39,6 +40,35 @@ void linsolve_upper_triangular(const float *const A, float x[], const float *con
 	}
 }
 
+int linsolve_upper_triangular_view(struct mat_view X, const struct mat_view A,
+				   const struct mat_view B)
+{
+	if (A.rows != A.cols || B.rows != A.rows || X.rows != B.rows || X.cols != B.cols)
+		return -EINVAL;
+
+	// Row i of X only depends on rows below it, so X may be B
+	for (uint32_t i = A.rows; i-- > 0;) {
+		float *x = &X.data[X.ld * i];
+		const float *b = &B.data[B.ld * i];
+
+		if (x != b)
+			memcpy(x, b, X.cols * sizeof(float));
+		for (uint32_t j = i + 1; j < A.cols; j++) {
+			const float a = A.data[A.ld * i + j];
+			const float *xj = &X.data[X.ld * j];
+
+			for (uint32_t k = 0; k < X.cols; k++)
+				x[k] -= a * xj[k];
+		}
+
+		const float d = 1.0f / A.data[A.ld * i + i];
+
+		for (uint32_t k = 0; k < X.cols; k++)
+			x[k] *= d;
+	}
+	return 0;
+}
+
 /*
  * GNU Octave code:
  *  function [x] = linsolve(A, b)
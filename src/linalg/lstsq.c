@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+#include "linalg_internal.h"
+
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+// B [m*p] = Q'*B where Q is stored as reflectors in W [m*n]
+static void apply_qt(float *B, const float *const W, const float *const tau, float *s, uint16_t m,
+		     uint16_t n, uint16_t p)
+{
+	for (uint16_t k = 0; k < n; k++)
+		householder_apply(B, p, p, W, tau[k], s, k, m, n);
+}
+
+// Minimum norm solution X [n*p] = V*inv(S)*U'*B over singular values above rcond * S[0]
+static int lstsq_svd(float *X, const float *const A, const float *const B, uint16_t m, uint16_t n,
+		     uint16_t p, float rcond, uint16_t *rank)
+{
+	const uint16_t k = m < n ? m : n;
+	float U[m * k];
+	float S[k];
+	float V[n * k];
+	float C[k * p];
+
+	const int status = svd_jacobi(A, m, n, MAX_ITERATION_COUNT_SVD, U, S, V);
+	const float tolerance = rcond * S[0];
+	uint16_t r = 0;
+
+	while (r < k && S[r] > tolerance)
+		r++;
+
+	// C = inv(S)*U'*B for the kept singular values
+	memset(C, 0, r * p * sizeof(float));
+	for (uint16_t i = 0; i < m; i++) {
+		for (uint16_t l = 0; l < r; l++) {
+			const float u = U[k * i + l] / S[l];
+
+			for (uint16_t j = 0; j < p; j++)
+				C[p * l + j] += u * B[p * i + j];
+		}
+	}
+
+	// X = V*C
+	memset(X, 0, n * p * sizeof(float));
+	for (uint16_t i = 0; i < n; i++) {
+		for (uint16_t l = 0; l < r; l++) {
+			const float v = V[k * i + l];
+
+			for (uint16_t j = 0; j < p; j++)
+				X[p * i + j] += v * C[p * l + j];
+		}
+	}
+
+	if (rank)
+		*rank = r;
+	return status;
+}
+
+int lstsq(float *X, const float *const A, const float *const B, uint16_t row, uint16_t column,
+	  uint16_t column_b, float rcond, uint16_t *rank)
+{
+	if (row == 0 || column == 0 || column_b == 0)
+		return -EINVAL;
+
+	if (rcond <= 0.0f)
+		rcond = (float)(row > column ? row : column) * FLT_EPSILON;
+
+	// Underdetermined systems need the minimum norm solution
+	if (row < column)
+		return lstsq_svd(X, A, B, row, column, column_b, rcond, rank);
+
+	float W[row * column];
+	float C[row * column_b];
+	float tau[column];
+	float s[column > column_b ? column : column_b];
+	uint16_t perm[column];
+
+	memcpy(W, A, row * column * sizeof(float));
+	householder_qr(W, tau, perm, s, row, column);
+
+	// Pivoting orders |R[k][k]| so the last diagonal tells whether R is well conditioned
+	const float r0 = fabsf(W[0]);
+
+	if (r0 == 0.0f || fabsf(W[column * (column - 1) + column - 1]) <= rcond * r0)
+		return lstsq_svd(X, A, B, row, column, column_b, rcond, rank);
+
+	memcpy(C, B, row * column_b * sizeof(float));
+	apply_qt(C, W, tau, s, row, column, column_b);
+
+	// Back substitution R*Y = C[0:n] and scatter X[perm[i]] = Y[i]
+	for (int i = column - 1; i >= 0; i--) {
+		for (uint16_t j = i + 1; j < column; j++) {
+			const float r = W[column * i + j];
+
+			for (uint16_t l = 0; l < column_b; l++)
+				C[column_b * i + l] -= r * C[column_b * j + l];
+		}
+		for (uint16_t l = 0; l < column_b; l++)
+			C[column_b * i + l] /= W[column * i + i];
+	}
+	for (uint16_t i = 0; i < column; i++)
+		memcpy(&X[column_b * perm[i]], &C[column_b * i], column_b * sizeof(float));
+
+	if (rank)
+		*rank = column;
+	return 0;
+}
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+
+#include <errno.h>
+#include <string.h>
+
+struct mat_view mat_view_init(float *data, uint32_t rows, uint32_t cols)
+{
+	struct mat_view view = { .data = data, .rows = rows, .cols = cols, .ld = cols };
+
+	return view;
+}
+
+struct mat_view mat_view_block(struct mat_view parent, uint32_t row, uint32_t col, uint32_t rows,
+			       uint32_t cols)
+{
+	struct mat_view view = { .data = parent.data, .rows = 0, .cols = 0, .ld = parent.ld };
+
+	if (row >= parent.rows || col >= parent.cols)
+		return view;
+
+	view.data = parent.data + parent.ld * row + col;
+	view.rows = rows < parent.rows - row ? rows : parent.rows - row;
+	view.cols = cols < parent.cols - col ? cols : parent.cols - col;
+	return view;
+}
+
+int copy_view(struct mat_view B, const struct mat_view A)
+{
+	if (A.rows != B.rows || A.cols != B.cols)
+		return -EINVAL;
+
+	// Whole rows are contiguous so copy them at once
+	for (uint32_t i = 0; i < A.rows; i++)
+		memcpy(&B.data[B.ld * i], &A.data[A.ld * i], A.cols * sizeof(float));
+
+	return 0;
+}
@@ -14,28 +14,35 @@
 int mul(float *C, const float *const A, const float *const B, uint16_t row_a, uint16_t column_a,
 	uint16_t row_b, uint16_t column_b)
 {
-	// Data matrix
-	const float *data_a;
-	const float *data_b;
-
 	if (column_a != row_b) {
 		return -EINVAL;
 	}
 
-	for (uint16_t i = 0; i < row_a; i++) {
-		// Then we go through every column of b
-		for (uint16_t j = 0; j < column_b; j++) {
-			data_a = &A[i * column_a];
-			data_b = &B[j];
-
-			*C = 0; // Reset
-			// And we multiply rows from a with columns of b
-			for (uint16_t k = 0; k < column_a; k++) {
-				*C += *data_a * *data_b;
-				data_a++;
-				data_b += column_b;
-			}
-			C++;
+	// Views only read through A and B
+	return mul_view(mat_view_init(C, row_a, column_b),
+			mat_view_init((float *)A, row_a, column_a),
+			mat_view_init((float *)B, row_b, column_b));
+}
+
+int mul_view(struct mat_view C, const struct mat_view A, const struct mat_view B)
+{
+	if (A.cols != B.rows || C.rows != A.rows || C.cols != B.cols) {
+		return -EINVAL;
+	}
+
+	for (uint32_t i = 0; i < A.rows; i++) {
+		float *c = &C.data[C.ld * i];
+
+		for (uint32_t j = 0; j < C.cols; j++)
+			c[j] = 0.0f;
+
+		// Accumulate rows of B so that the inner loop is contiguous
+		for (uint32_t k = 0; k < A.cols; k++) {
+			const float a = A.data[A.ld * i + k];
+			const float *b = &B.data[B.ld * k];
+
+			for (uint32_t j = 0; j < C.cols; j++)
+				c[j] += a * b[j];
 		}
 	}
 	return 0;
@@ -11,16 +11,74 @@
 
 #include <float.h>
 #include <math.h>
-#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
 static float check_solution(float dx[], float x[], float *past_sqrt_sum_dx, float best_x[],
 			    uint8_t *elements);
 
-void nonlinsolve(void (*nonlinear_equation_system)(float[], float[], float[]), float b[], float x[],
-		 uint8_t elements, float alpha, float max_value, float min_value,
-		 bool random_guess_active)
+/*
+ * Counter based uniform number in [0, 1). The value only depends on the seed,
+ * the candidate and the element, so any split of the candidates over callers
+ * draws exactly the same numbers.
+ */
+static float uniform(uint32_t seed, uint32_t index, uint8_t element)
+{
+	// SplitMix64 finalizer
+	uint64_t z = (((uint64_t)index << 8) | element) + (uint64_t)seed * 0x9E3779B97F4A7C15ull;
+
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	z ^= z >> 31;
+	return (float)(z >> 40) * (1.0f / 16777216.0f);
+}
+
+float nonlinsolve_multistart(void (*nonlinear_equation_system)(float[], float[], float[]),
+			     float b[], float x[], uint8_t elements, float max_value,
+			     float min_value, uint32_t seed, uint32_t first, uint32_t count,
+			     uint32_t *index)
+{
+	const float difference_value = max_value - min_value;
+	float dx[elements];
+	float guess[elements];
+	float best_sqrt_sum_dx = FLT_MAX;
+
+	*index = first;
+	for (uint32_t i = first; i - first < count; i++) {
+		// Init guess with random values between min_value and max_value
+		for (uint8_t j = 0; j < elements; j++)
+			guess[j] = difference_value * uniform(seed, i, j) + min_value;
+
+		(*nonlinear_equation_system)(dx, b, guess);
+
+		const float sqrt_sum_dx = norm(dx, 1, elements, 2);
+
+		// Strict comparison keeps the lowest index on ties and never takes NaN
+		if (sqrt_sum_dx < best_sqrt_sum_dx) {
+			best_sqrt_sum_dx = sqrt_sum_dx;
+			*index = i;
+			memcpy(x, guess, sizeof(float) * elements);
+		}
+	}
+	return best_sqrt_sum_dx;
+}
+
+float nonlinsolve_multistart_merge(float x[], float residual, uint32_t *index,
+				   const float *const x_other, float residual_other,
+				   uint32_t index_other, uint8_t elements)
+{
+	// NaN residuals never win, equal residuals go to the lowest candidate index
+	if (residual_other < residual || (residual_other == residual && index_other < *index) ||
+	    (isnan(residual) && !isnan(residual_other))) {
+		memcpy(x, x_other, sizeof(float) * elements);
+		*index = index_other;
+		return residual_other;
+	}
+	return residual;
+}
+
+void nonlinsolve_refine(void (*nonlinear_equation_system)(float[], float[], float[]), float b[],
+			float x[], uint8_t elements, float alpha)
 {
 	// Initial parameters and arrays
 	float dx[elements];
@@ -29,37 +87,16 @@ void nonlinsolve(void (*nonlinear_equation_system)(float[], float[], float[]), f
 	float best_x[elements];
 	float sqrt_sum_dx = 1;
 	uint8_t times_until_break = 10;
-	uint16_t random_iterations = 20000;
+	uint16_t gradient_iterations = NONLINSOLVE_ITERATIONS;
 	uint8_t break_count = 0;
 	uint8_t maximum_gradients_index = 30;
 	uint8_t past_gradients[30]; // This is for stochastic gradient descent
 	uint8_t gradient_index = 0;
 
 	memset(past_gradients, 0, maximum_gradients_index);
+	memcpy(best_x, x, sizeof(float) * elements);
 
-	// Do random guesses
-	if (random_guess_active) {
-		srand(time(NULL));
-		float difference_value = max_value - min_value;
-
-		for (uint32_t i = 0; i < random_iterations; i++) {
-			// Init x with random values between min_value and max_value
-			for (uint8_t j = 0; j < elements; j++) {
-				x[j] = difference_value * ((float)rand() / (float)RAND_MAX) +
-				       min_value;
-			}
-
-			// Simulate the nonlinear system
-			(*nonlinear_equation_system)(dx, b, x);
-
-			// Check the solution if it's good or not
-			check_solution(dx, x, &best_sqrt_sum_dx, best_x, &elements);
-		}
-
-		// Use gradient to find the best solution, beginning from best_x vector
-		memcpy(x, best_x, sizeof(float) * elements);
-	}
-	for (uint32_t i = 0; i < random_iterations; i++) {
+	for (uint32_t i = 0; i < gradient_iterations; i++) {
 		// Simulate the nonlinear system
 		(*nonlinear_equation_system)(dx, b, x);
 
@@ -94,6 +131,23 @@ void nonlinsolve(void (*nonlinear_equation_system)(float[], float[], float[]), f
 	memcpy(x, best_x, sizeof(float) * elements);
 }
 
+void nonlinsolve(void (*nonlinear_equation_system)(float[], float[], float[]), float b[], float x[],
+		 uint8_t elements, float alpha, float max_value, float min_value,
+		 bool random_guess_active)
+{
+	// Do random guesses
+	if (random_guess_active) {
+		uint32_t index;
+
+		nonlinsolve_multistart(nonlinear_equation_system, b, x, elements, max_value,
+				       min_value, (uint32_t)time(NULL), 0, NONLINSOLVE_ITERATIONS,
+				       &index);
+	}
+
+	// Use gradient to find the best solution, beginning from the best guess
+	nonlinsolve_refine(nonlinear_equation_system, b, x, elements, alpha);
+}
+
 static float check_solution(float dx[], float x[], float *best_sqrt_sum_dx, float best_x[],
 			    uint8_t *elements)
 {
@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+#include "linalg_internal.h"
+
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+/*
+ * Forward differences J[:, j] = (f(x + h_j*e_j) - f(x)) / h_j. All columns
+ * are evaluated with one call to f so the model can process them together.
+ */
+static void jacobian_fd(float *J, nonlinsolve_residual_t f, void *ctx, const float *const x,
+			const float *const r, uint16_t row, uint16_t column, float step)
+{
+	float X[column * column];
+	float R[column * row];
+	float h[column];
+
+	for (uint16_t j = 0; j < column; j++) {
+		const float scale = fabsf(x[j]) > 1.0f ? fabsf(x[j]) : 1.0f;
+
+		memcpy(&X[j * column], x, column * sizeof(float));
+		X[j * column + j] += step * scale;
+		// Use the step that is representable after rounding
+		h[j] = X[j * column + j] - x[j];
+	}
+	f(R, X, column, ctx);
+	for (uint16_t i = 0; i < row; i++)
+		for (uint16_t j = 0; j < column; j++)
+			J[i * column + j] = (R[j * row + i] - r[i]) / h[j];
+}
+
+int nonlinsolve_lm(float *x, nonlinsolve_residual_t f, void *ctx, uint16_t row, uint16_t column,
+		   const struct nonlinsolve_lm_options *options, struct nonlinsolve_lm_stats *stats)
+{
+	if (!f || !options || row == 0 || column == 0)
+		return -EINVAL;
+
+	const float step = options->step > 0.0f ? options->step : sqrtf(FLT_EPSILON);
+	const uint16_t m = row + column;
+	float J[row * column];
+	float W[m * column];
+	float rhs[m];
+	float r[row], r_new[row], Jd[row];
+	float x_new[column], delta[column], D[column];
+	float lambda = options->lambda;
+	float nu = 2.0f;
+	uint16_t iterations = 0;
+	uint32_t evaluations = 1;
+	bool update = true;
+	enum nonlinsolve_status status = NONLINSOLVE_MAX_ITERATIONS;
+
+	f(r, x, 1, ctx);
+	float cost = dot(r, r, row);
+
+	memset(D, 0, sizeof(D));
+	while (iterations < options->max_iterations) {
+		if (update) {
+			if (options->jacobian) {
+				options->jacobian(J, x, ctx);
+			} else {
+				jacobian_fd(J, f, ctx, x, r, row, column, step);
+				evaluations += column;
+			}
+
+			// Gradient J'*r and Marquardt scaling D = sqrt(diag(J'*J)), never decreasing
+			float gmax = 0.0f;
+
+			for (uint16_t j = 0; j < column; j++) {
+				float sum = 0.0f, jj = 0.0f;
+
+				for (uint16_t i = 0; i < row; i++) {
+					sum += J[i * column + j] * r[i];
+					jj += J[i * column + j] * J[i * column + j];
+				}
+				if (fabsf(sum) > gmax)
+					gmax = fabsf(sum);
+				if (sqrtf(jj) > D[j])
+					D[j] = sqrtf(jj);
+			}
+			if (gmax <= options->gradient_tolerance) {
+				status = NONLINSOLVE_GRADIENT;
+				break;
+			}
+			update = false;
+		}
+
+		// min ||[J; sqrt(lambda)*D]*delta + [r; 0]|| with pivoted QR
+		memcpy(W, J, row * column * sizeof(float));
+		memset(&W[row * column], 0, column * column * sizeof(float));
+		for (uint16_t i = 0; i < row; i++)
+			rhs[i] = -r[i];
+		for (uint16_t j = 0; j < column; j++) {
+			W[(row + j) * column + j] = sqrtf(lambda) * (D[j] > 0.0f ? D[j] : 1.0f);
+			rhs[row + j] = 0.0f;
+		}
+		if (lstsq(delta, W, rhs, lambda > 0.0f ? m : row, column, 1, 0.0f, NULL) != 0) {
+			status = NONLINSOLVE_SINGULAR;
+			break;
+		}
+
+		for (uint16_t j = 0; j < column; j++)
+			x_new[j] = x[j] + delta[j];
+		f(r_new, x_new, 1, ctx);
+		evaluations++;
+		iterations++;
+
+		const float cost_new = dot(r_new, r_new, row);
+		const float step_norm = sqrtf(dot(delta, delta, column));
+		const float x_norm = sqrtf(dot(x, x, column));
+
+		// Reduction predicted by the linear model, cost - ||r + J*delta||^2
+		for (uint16_t i = 0; i < row; i++) {
+			Jd[i] = r[i];
+			for (uint16_t j = 0; j < column; j++)
+				Jd[i] += J[i * column + j] * delta[j];
+		}
+
+		const float predicted = cost - dot(Jd, Jd, row);
+
+		if (cost_new < cost && predicted > 0.0f) {
+			const float rho = (cost - cost_new) / predicted;
+			const float shrink = 1.0f - powf(2.0f * rho - 1.0f, 3);
+
+			// Nielsen's update keeps lambda from oscillating
+			lambda *= shrink > 1.0f / 3.0f ? shrink : 1.0f / 3.0f;
+			nu = 2.0f;
+			memcpy(x, x_new, sizeof(x_new));
+			memcpy(r, r_new, sizeof(r_new));
+			cost = cost_new;
+			update = true;
+		} else {
+			if (lambda == 0.0f)
+				lambda = NONLINSOLVE_LM_LAMBDA;
+			else
+				lambda *= nu;
+			nu *= 2.0f;
+		}
+
+		// Steps at rounding level can not improve x any further
+		if (step_norm <= options->tolerance * (x_norm + options->tolerance)) {
+			status = NONLINSOLVE_STEP;
+			break;
+		}
+		if (cost == 0.0f) {
+			status = NONLINSOLVE_GRADIENT;
+			break;
+		}
+	}
+
+	if (stats) {
+		stats->iterations = iterations;
+		stats->evaluations = evaluations;
+		stats->residual = sqrtf(cost);
+		stats->status = status;
+	}
+	return status == NONLINSOLVE_STEP || status == NONLINSOLVE_GRADIENT ? 0 : -ENOTSUP;
+}
@@ -12,36 +12,93 @@
 #include <math.h>
 #include <string.h>
 
-float norm(const float *const Ain, uint16_t row, uint16_t column, uint8_t l)
+float norm2_estimate(const float *const A, uint16_t row, uint16_t column, float tolerance,
+		     uint8_t max_iterations)
 {
-	float A[row * column];
+	if (row == 0 || column == 0)
+		return 0.0f;
 
-	memcpy(A, Ain, sizeof(A));
+	float u[row], v[column], w[column];
+	float estimate = 0.0f;
 
+	// Start along the column norms which rarely is orthogonal to the top singular vector
+	uint16_t largest = 0;
+
+	for (uint16_t j = 0; j < column; j++) {
+		float sum = 0.0f;
+
+		for (uint16_t i = 0; i < row; i++)
+			sum += A[column * i + j] * A[column * i + j];
+		v[j] = sqrtf(sum);
+		if (v[j] > v[largest])
+			largest = j;
+	}
+	if (v[largest] == 0.0f)
+		return 0.0f;
+
+	for (uint8_t k = 0; k < max_iterations; k++) {
+		// u = A*v
+		mul(u, A, v, row, column, column, 1);
+
+		float sigma = 0.0f;
+
+		for (uint16_t i = 0; i < row; i++)
+			sigma += u[i] * u[i];
+		sigma = sqrtf(sigma);
+
+		// Start vector was in the null space, use the largest column instead
+		if (sigma == 0.0f) {
+			memset(v, 0, sizeof(v));
+			v[largest] = 1.0f;
+			continue;
+		}
+
+		// w = A'*u = A'*A*v and ||A'*A*v|| / ||A*v|| approaches the largest singular value
+		memset(w, 0, sizeof(w));
+		for (uint16_t i = 0; i < row; i++)
+			for (uint16_t j = 0; j < column; j++)
+				w[j] += A[column * i + j] * u[i];
+
+		float wnorm = 0.0f;
+
+		for (uint16_t j = 0; j < column; j++)
+			wnorm += w[j] * w[j];
+		wnorm = sqrtf(wnorm);
+
+		const float previous = estimate;
+
+		estimate = wnorm / sigma;
+		for (uint16_t j = 0; j < column; j++)
+			v[j] = w[j] / wnorm;
+
+		if (fabsf(estimate - previous) <= tolerance * estimate)
+			break;
+	}
+	return estimate;
+}
+
+float norm(const float *const A, uint16_t row, uint16_t column, uint8_t l)
+{
 	if (l == 1) {
 		// Vector
 		if (row == 1) {
-			float sum_sqrt = 0;
+			float sum_abs = 0;
 
 			for (uint16_t i = 0; i < column; i++)
-				sum_sqrt += sqrtf(A[i] * A[i]);
-			return sum_sqrt;
+				sum_abs += fabsf(A[i]);
+			return sum_abs;
 		}
 		// Matrix
-		// MATLAB: sum(A, 1)
-		for (uint16_t i = 1; i < row; i++) {
-			for (uint16_t j = 0; j < column; j++) {
-				A[j] += fabsf(A[i * column + j]);
-			}
-		}
+		// MATLAB: max(sum(abs(A), 1))
+		float maxValue = 0;
 
-		// Find the largest value on row 0
-		float maxValue = A[0];
+		for (uint16_t j = 0; j < column; j++) {
+			float sum = 0;
 
-		for (uint16_t j = 1; j < column; j++) {
-			if (A[j] > maxValue) {
-				maxValue = A[j];
-			}
+			for (uint16_t i = 0; i < row; i++)
+				sum += fabsf(A[i * column + j]);
+			if (sum > maxValue)
+				maxValue = sum;
 		}
 		return maxValue;
 	}
@@ -54,21 +111,8 @@ float norm(const float *const Ain, uint16_t row, uint16_t column, uint8_t l)
 				sqrt_sum += A[i] * A[i];
 			return sqrtf(sqrt_sum);
 		}
-		// Matrix
-		float U[row * column];
-		float S[column];
-		float V[column * column];
-
-		if (row == column)
-			svd_jacobi_one_sided(A, row, MAX_ITERATION_COUNT_SVD, U, S, V);
-		else
-			svd_golub_reinsch(A, row, column, U, S, V);
-		float max_singular_value = 0;
-
-		for (uint16_t i = 0; i < column; i++)
-			if (S[i] > max_singular_value)
-				max_singular_value = S[i];
-		return max_singular_value;
+		// Matrix: largest singular value without a full SVD
+		return norm2_estimate(A, row, column, NORM2_TOLERANCE, NORM2_MAX_ITERATIONS);
 	}
 	return 0;
 	/* add more norms here */
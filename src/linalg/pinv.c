@@ -9,35 +9,53 @@
 
 #include "control/linalg.h"
 
-void pinv(float *Ai, const float *const A, uint16_t row, uint16_t column)
-{
-	// Use Golub and Reinch if row != column
-	float U[row * column];
-	float S[column];
-	float V[column * column];
+#include <float.h>
+#include <string.h>
 
-	if (row == column)
-		svd_jacobi_one_sided(A, row, MAX_ITERATION_COUNT_SVD, U, S, V);
-	else
-		svd_golub_reinsch(A, row, column, U, S, V);
+uint16_t pinv_truncated(float *Ai, const float *const A, uint16_t row, uint16_t column,
+			float rcond, uint16_t max_rank)
+{
+	const uint16_t k = row < column ? row : column;
+	float U[row * k];
+	float S[k];
+	float V[column * k];
 
-	// Do inv(S)
-	for (uint16_t i = 0; i < column; i++) {
-		// Create inverse diagonal matrix
-		// TODO: can this ever result in div by zero?
-		S[i] = 1.0f / S[i];
+	if (svd_jacobi(A, row, column, MAX_ITERATION_COUNT_SVD, U, S, V) != 0) {
+		memset(Ai, 0, column * row * sizeof(float));
+		return 0;
 	}
 
-	// Transpose U'
-	tran(U, U, row, column);
+	// Drop singular values that are zero to working precision or below rcond * S[0]
+	if (rcond <= 0.0f)
+		rcond = (float)(row > column ? row : column) * FLT_EPSILON;
+
+	const float tolerance = rcond * S[0];
+	uint16_t rank = 0;
+
+	while (rank < k && rank < max_rank && S[rank] > tolerance)
+		rank++;
+
+	// Ut = inv(S)*U' over the kept singular values only
+	float Ut[k * row];
 
-	// U = S*U'
-	for (uint16_t i = 0; i < row; i++) {
-		for (uint16_t j = 0; j < column; j++) {
-			U[row * j + i] = S[j] * U[row * j + i];
+	for (uint16_t l = 0; l < rank; l++)
+		for (uint16_t j = 0; j < row; j++)
+			Ut[row * l + j] = U[k * j + l] / S[l];
+
+	// Ai = V*Ut with V restricted to the first rank columns
+	memset(Ai, 0, column * row * sizeof(float));
+	for (uint16_t i = 0; i < column; i++) {
+		for (uint16_t l = 0; l < rank; l++) {
+			const float v = V[k * i + l];
+
+			for (uint16_t j = 0; j < row; j++)
+				Ai[row * i + j] += v * Ut[row * l + j];
 		}
 	}
+	return rank;
+}
 
-	// Do pinv now: A = V*U
-	mul(Ai, V, U, column, column, column, row);
+void pinv(float *Ai, const float *const A, uint16_t row, uint16_t column)
+{
+	pinv_truncated(Ai, A, row, column, 0.0f, row < column ? row : column);
 }
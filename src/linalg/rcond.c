@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+
+#include <math.h>
+#include <string.h>
+
+#define RCOND_MAX_ITERATIONS 5
+
+struct lup_factor {
+	const float *LU;
+	const uint8_t *P;
+};
+
+// x = inv(A)*x or x = inv(A')*x with the factor of A
+typedef void (*factor_solve_t)(float *x, const void *factor, uint16_t row, bool transposed);
+
+static void lup_solve(float *x, const void *factor, uint16_t row, bool transposed)
+{
+	const struct lup_factor *f = factor;
+	const float *LU = f->LU;
+	const uint8_t *P = f->P;
+	float y[row];
+
+	if (!transposed) {
+		// L*y = P*x with unit L, then U*x = y
+		for (uint16_t i = 0; i < row; i++) {
+			float sum = x[P[i]];
+
+			for (uint16_t j = 0; j < i; j++)
+				sum -= LU[row * P[i] + j] * y[j];
+			y[i] = sum;
+		}
+		for (int i = row - 1; i >= 0; i--) {
+			float sum = y[i];
+
+			for (uint16_t j = i + 1; j < row; j++)
+				sum -= LU[row * P[i] + j] * x[j];
+			x[i] = sum / LU[row * P[i] + i];
+		}
+		return;
+	}
+
+	// A' = U'*L'*P so solve U'*w = x, then L'*v = w and scatter x = P'*v
+	for (uint16_t i = 0; i < row; i++) {
+		float sum = x[i];
+
+		for (uint16_t j = 0; j < i; j++)
+			sum -= LU[row * P[j] + i] * y[j];
+		y[i] = sum / LU[row * P[i] + i];
+	}
+	for (int i = row - 1; i >= 0; i--) {
+		float sum = y[i];
+
+		for (uint16_t j = i + 1; j < row; j++)
+			sum -= LU[row * P[j] + i] * y[j];
+		y[i] = sum;
+	}
+	for (uint16_t i = 0; i < row; i++)
+		x[P[i]] = y[i];
+}
+
+static void chol_solve(float *x, const void *factor, uint16_t row, bool transposed)
+{
+	const float *L = factor;
+
+	// A = L*L' is symmetric so both directions are the same solve
+	(void)transposed;
+	for (uint16_t i = 0; i < row; i++) {
+		float sum = x[i];
+
+		for (uint16_t j = 0; j < i; j++)
+			sum -= L[row * i + j] * x[j];
+		x[i] = sum / L[row * i + i];
+	}
+	for (int i = row - 1; i >= 0; i--) {
+		float sum = x[i];
+
+		for (uint16_t j = i + 1; j < row; j++)
+			sum -= L[row * j + i] * x[j];
+		x[i] = sum / L[row * i + i];
+	}
+}
+
+static float norm1(const float *const x, uint16_t row)
+{
+	float sum = 0.0f;
+
+	for (uint16_t i = 0; i < row; i++)
+		sum += fabsf(x[i]);
+	return sum;
+}
+
+static uint16_t argmax_abs(const float *const x, uint16_t row)
+{
+	uint16_t k = 0;
+
+	for (uint16_t i = 1; i < row; i++)
+		if (fabsf(x[i]) > fabsf(x[k]))
+			k = i;
+	return k;
+}
+
+/*
+ * Hager's method with Higham's refinements, as in LAPACK xLACON. Estimates
+ * norm(inv(A), 1) from a few solves with A and A'.
+ */
+static float inverse_norm1(factor_solve_t solve, const void *factor, uint16_t row)
+{
+	float x[row], xi[row];
+	float estimate;
+
+	for (uint16_t i = 0; i < row; i++)
+		x[i] = 1.0f / (float)row;
+	solve(x, factor, row, false);
+	estimate = norm1(x, row);
+	if (row == 1)
+		return estimate;
+
+	for (uint16_t i = 0; i < row; i++)
+		xi[i] = x[i] >= 0.0f ? 1.0f : -1.0f;
+	memcpy(x, xi, sizeof(x));
+	solve(x, factor, row, true);
+	uint16_t j = argmax_abs(x, row);
+
+	for (uint8_t k = 1; k < RCOND_MAX_ITERATIONS; k++) {
+		memset(x, 0, sizeof(x));
+		x[j] = 1.0f;
+		solve(x, factor, row, false);
+
+		const float previous = estimate;
+		bool repeated = true;
+
+		estimate = norm1(x, row);
+		for (uint16_t i = 0; i < row; i++) {
+			const float sign = x[i] >= 0.0f ? 1.0f : -1.0f;
+
+			if (sign != xi[i])
+				repeated = false;
+			xi[i] = sign;
+		}
+		// Same sign pattern or no growth means the estimate has converged
+		if (repeated || estimate <= previous) {
+			if (estimate < previous)
+				estimate = previous;
+			break;
+		}
+
+		memcpy(x, xi, sizeof(x));
+		solve(x, factor, row, true);
+
+		const uint16_t last = j;
+
+		j = argmax_abs(x, row);
+		if (fabsf(x[last]) == fabsf(x[j]))
+			break;
+	}
+
+	// Alternating vector guards against matrices that fool the gradient steps
+	for (uint16_t i = 0; i < row; i++)
+		x[i] = (i & 1 ? -1.0f : 1.0f) * (1.0f + (float)i / (float)(row - 1));
+	solve(x, factor, row, false);
+
+	const float alternative = 2.0f * norm1(x, row) / (3.0f * (float)row);
+
+	return alternative > estimate ? alternative : estimate;
+}
+
+float rcond_lup(const float *const LU, const uint8_t *const P, uint16_t row, float anorm)
+{
+	const struct lup_factor factor = { .LU = LU, .P = P };
+
+	if (row == 0 || anorm == 0.0f)
+		return 0.0f;
+	for (uint16_t i = 0; i < row; i++)
+		if (LU[row * P[i] + i] == 0.0f)
+			return 0.0f;
+
+	const float ainvnorm = inverse_norm1(lup_solve, &factor, row);
+
+	if (ainvnorm == 0.0f || !isfinite(ainvnorm))
+		return 0.0f;
+	return 1.0f / (anorm * ainvnorm);
+}
+
+float rcond_chol(const float *const L, uint16_t row, float anorm)
+{
+	if (row == 0 || anorm == 0.0f)
+		return 0.0f;
+	for (uint16_t i = 0; i < row; i++)
+		if (L[row * i + i] == 0.0f)
+			return 0.0f;
+
+	const float ainvnorm = inverse_norm1(chol_solve, L, row);
+
+	if (ainvnorm == 0.0f || !isfinite(ainvnorm))
+		return 0.0f;
+	return 1.0f / (anorm * ainvnorm);
+}
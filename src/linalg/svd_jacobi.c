@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+#include "linalg_internal.h"
+
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+// U [m*n] = Q * U where Q is stored as reflectors in W [m*n]
+static void apply_q(float *U, const float *const W, const float *const tau, float *s, uint16_t m,
+		    uint16_t n)
+{
+	for (int k = n - 1; k >= 0; k--)
+		householder_apply(U, n, n, W, tau[k], s, k, m, n);
+}
+
+/*
+ * Orthogonalize pair (p, q) of the columns stored as rows of Wt [n*n] and
+ * accumulate the rotation in Vt. Returns true if a rotation was applied.
+ */
+static bool rotate(float *Wt, float *Vt, uint16_t n, uint16_t p, uint16_t q)
+{
+	float *wp = &Wt[n * p];
+	float *wq = &Wt[n * q];
+	float a = 0.0f, b = 0.0f, c = 0.0f;
+
+	for (uint16_t k = 0; k < n; k++) {
+		a += wp[k] * wp[k];
+		b += wq[k] * wq[k];
+		c += wp[k] * wq[k];
+	}
+
+	// Columns are already orthogonal to working precision
+	if (c == 0.0f || fabsf(c) <= (float)n * FLT_EPSILON * sqrtf(a) * sqrtf(b))
+		return false;
+
+	const float zeta = (b - a) / (2.0f * c);
+	const float t = (zeta < 0.0f ? -1.0f : 1.0f) / (fabsf(zeta) + sqrtf(1.0f + zeta * zeta));
+	const float cs = 1.0f / sqrtf(1.0f + t * t);
+	const float sn = cs * t;
+	float *vp = &Vt[n * p];
+	float *vq = &Vt[n * q];
+
+	for (uint16_t k = 0; k < n; k++) {
+		const float x = wp[k];
+		const float y = wq[k];
+
+		wp[k] = cs * x - sn * y;
+		wq[k] = sn * x + cs * y;
+	}
+	for (uint16_t k = 0; k < n; k++) {
+		const float x = vp[k];
+		const float y = vq[k];
+
+		vp[k] = cs * x - sn * y;
+		vq[k] = sn * x + cs * y;
+	}
+	return true;
+}
+
+/*
+ * One-sided Jacobi on the n columns stored as rows of Wt. Pairs are visited
+ * in round-robin order so the n/2 rotations of every round touch disjoint
+ * columns and are independent of each other.
+ */
+static int jacobi(float *Wt, float *Vt, uint16_t n, uint8_t max_sweeps)
+{
+	// Round-robin schedule with a dummy player when n is odd
+	const uint16_t players = n + (n & 1);
+	uint16_t order[players];
+
+	for (uint16_t i = 0; i < players; i++)
+		order[i] = i;
+
+	for (uint8_t sweep = 0; sweep < max_sweeps; sweep++) {
+		bool rotated = false;
+
+		for (uint16_t round = 0; round + 1 < players; round++) {
+			for (uint16_t k = 0; k < players / 2; k++) {
+				uint16_t p = order[k];
+				uint16_t q = order[players - 1 - k];
+
+				if (p >= n || q >= n)
+					continue;
+				if (p > q) {
+					uint16_t tmp = p;
+
+					p = q;
+					q = tmp;
+				}
+				rotated |= rotate(Wt, Vt, n, p, q);
+			}
+
+			// Keep the first player fixed and rotate the others one step
+			const uint16_t last = order[players - 1];
+
+			for (uint16_t i = players - 1; i > 1; i--)
+				order[i] = order[i - 1];
+			order[1] = last;
+		}
+
+		if (!rotated)
+			return 0;
+	}
+
+	return -ENOTSUP;
+}
+
+int svd_jacobi(const float *const A, uint16_t row, uint16_t column, uint8_t max_sweeps, float *U,
+	       float *S, float *V)
+{
+	if (row == 0 || column == 0)
+		return -EINVAL;
+
+	// Work on A' when A is wide so that m >= n
+	const bool wide = row < column;
+	const uint16_t m = wide ? column : row;
+	const uint16_t n = wide ? row : column;
+
+	float W[m * n];
+	float Wt[n * n];
+	float Vt[n * n];
+	float tau[n];
+	float s[n];
+
+	if (wide)
+		tran(W, A, row, column);
+	else
+		memcpy(W, A, m * n * sizeof(float));
+
+	// Precondition tall matrices with QR so that Jacobi only works on R [n*n]
+	if (m > n) {
+		householder_qr(W, tau, NULL, s, m, n);
+		for (uint16_t i = 0; i < n; i++)
+			for (uint16_t j = 0; j < n; j++)
+				Wt[n * j + i] = j >= i ? W[n * i + j] : 0.0f;
+	} else {
+		tran(Wt, W, n, n);
+	}
+
+	memset(Vt, 0, n * n * sizeof(float));
+	for (uint16_t i = 0; i < n; i++)
+		Vt[n * i + i] = 1.0f;
+
+	const int status = jacobi(Wt, Vt, n, max_sweeps);
+
+	for (uint16_t j = 0; j < n; j++) {
+		float sum = 0.0f;
+
+		for (uint16_t k = 0; k < n; k++)
+			sum += Wt[n * j + k] * Wt[n * j + k];
+		S[j] = sqrtf(sum);
+	}
+
+	// Sort the singular values largest to smallest
+	for (uint16_t j = 0; j + 1 < n; j++) {
+		uint16_t max = j;
+
+		for (uint16_t i = j + 1; i < n; i++)
+			if (S[i] > S[max])
+				max = i;
+		if (max == j)
+			continue;
+
+		float tmp = S[j];
+
+		S[j] = S[max];
+		S[max] = tmp;
+		for (uint16_t k = 0; k < n; k++) {
+			tmp = Wt[n * j + k];
+			Wt[n * j + k] = Wt[n * max + k];
+			Wt[n * max + k] = tmp;
+			tmp = Vt[n * j + k];
+			Vt[n * j + k] = Vt[n * max + k];
+			Vt[n * max + k] = tmp;
+		}
+	}
+
+	// Left singular vectors are the normalized columns, U [m*n]
+	float *Uo = wide ? V : U;
+	float *Vo = wide ? U : V;
+
+	memset(Uo, 0, m * n * sizeof(float));
+	for (uint16_t j = 0; j < n; j++) {
+		if (S[j] == 0.0f)
+			continue;
+		for (uint16_t i = 0; i < n; i++)
+			Uo[n * i + j] = Wt[n * j + i] / S[j];
+	}
+	if (m > n)
+		apply_q(Uo, W, tau, s, m, n);
+
+	tran(Vo, Vt, n, n);
+
+	return status;
+}
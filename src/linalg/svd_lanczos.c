@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+#include "control/misc.h"
+
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#define SVD_LANCZOS_SEED 0x9e3779b9u // Fixed seed so that results are reproducible
+
+/*
+ * Remove the components of x [n] along the k orthonormal rows of Q [k*n]
+ * and return the remaining norm. Two passes keep the basis orthogonal in
+ * single precision.
+ */
+static float reorthogonalize(float *x, const float *const Q, uint16_t k, uint16_t n)
+{
+	for (uint8_t pass = 0; pass < 2; pass++) {
+		for (uint16_t l = 0; l < k; l++) {
+			float dot = 0.0f;
+
+			for (uint16_t i = 0; i < n; i++)
+				dot += Q[n * l + i] * x[i];
+			for (uint16_t i = 0; i < n; i++)
+				x[i] -= dot * Q[n * l + i];
+		}
+	}
+
+	float sum = 0.0f;
+
+	for (uint16_t i = 0; i < n; i++)
+		sum += x[i] * x[i];
+	return sqrtf(sum);
+}
+
+int svd_lanczos(matrix_operator_t A, void *ctx, uint16_t row, uint16_t column, uint16_t rank,
+		uint16_t steps, float *U, float *S, float *V)
+{
+	const uint16_t k_max = row < column ? row : column;
+
+	if (row == 0 || column == 0 || rank == 0 || rank > k_max)
+		return -EINVAL;
+	if (steps < rank)
+		steps = rank;
+	if (steps > k_max)
+		steps = k_max;
+
+	// Rows of Pt and Qt are the left and right Lanczos vectors
+	float Pt[steps * row];
+	float Qt[(steps + 1) * column];
+	float alpha[steps];
+	float beta[steps];
+	struct rng rng;
+	float norm = 0.0f;
+
+	rng_init(&rng, SVD_LANCZOS_SEED, 0);
+	rng_fill_uniform(&rng, Qt, column, -1.0f, 1.0f);
+	for (uint16_t i = 0; i < column; i++)
+		norm += Qt[i] * Qt[i];
+	norm = sqrtf(norm);
+	for (uint16_t i = 0; i < column; i++)
+		Qt[i] /= norm;
+
+	// Golub-Kahan bidiagonalization A*Q = P*B with full reorthogonalization
+	uint16_t p = 0;
+	float scale = 0.0f;
+
+	for (uint16_t k = 0; k < steps; k++) {
+		float *pk = &Pt[row * k];
+		float *qk = &Qt[column * k];
+		float *qn = &Qt[column * (k + 1)];
+
+		A(pk, qk, false, ctx);
+		alpha[k] = reorthogonalize(pk, Pt, k, row);
+		if (alpha[k] > scale)
+			scale = alpha[k];
+		// Q spans an invariant subspace, the remaining singular values are zero
+		if (alpha[k] <= (float)k_max * FLT_EPSILON * scale)
+			break;
+		for (uint16_t i = 0; i < row; i++)
+			pk[i] /= alpha[k];
+		p = k + 1;
+
+		A(qn, pk, true, ctx);
+		beta[k] = reorthogonalize(qn, Qt, k + 1, column);
+		if (beta[k] <= (float)k_max * FLT_EPSILON * scale) {
+			beta[k] = 0.0f;
+			break;
+		}
+		for (uint16_t i = 0; i < column; i++)
+			qn[i] /= beta[k];
+	}
+
+	memset(U, 0, row * rank * sizeof(float));
+	memset(S, 0, rank * sizeof(float));
+	memset(V, 0, column * rank * sizeof(float));
+	if (p == 0)
+		return 0;
+
+	/*
+	 * P'*A = B*[Q q] where B [p*(p+1)] is upper bidiagonal with alpha on the
+	 * diagonal and beta above it. Keeping the last column uses the residual
+	 * of the last step and is exact once the Krylov space is invariant.
+	 */
+	const uint16_t c = p + 1;
+	float B[p * c];
+	float Ub[p * p];
+	float Sb[p];
+	float Vb[c * p];
+
+	memset(B, 0, sizeof(B));
+	for (uint16_t k = 0; k < p; k++) {
+		B[c * k + k] = alpha[k];
+		B[c * k + k + 1] = beta[k];
+	}
+	const int status = svd_jacobi(B, p, c, MAX_ITERATION_COUNT_SVD, Ub, Sb, Vb);
+
+	// U = P*Ub and V = [Q q]*Vb for the leading singular triplets
+	const uint16_t r = rank < p ? rank : p;
+
+	for (uint16_t l = 0; l < r; l++) {
+		S[l] = Sb[l];
+		for (uint16_t k = 0; k < p; k++) {
+			const float u = Ub[p * k + l];
+
+			for (uint16_t i = 0; i < row; i++)
+				U[rank * i + l] += Pt[row * k + i] * u;
+		}
+		for (uint16_t k = 0; k < c; k++) {
+			const float v = Vb[p * k + l];
+
+			// A zero beta leaves q unnormalized but its weight is zero as well
+			if (v == 0.0f)
+				continue;
+			for (uint16_t i = 0; i < column; i++)
+				V[rank * i + l] += Qt[column * k + i] * v;
+		}
+	}
+
+	return status;
+}
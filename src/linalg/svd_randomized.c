@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/linalg.h"
+#include "control/misc.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+#define SVD_RANDOMIZED_SEED 0x9e3779b9u // Fixed seed so that results are reproducible
+
+/*
+ * Orthonormalize the columns of Q [row*column] in place with modified
+ * Gram-Schmidt. Every column is orthogonalized twice which is enough to keep
+ * the basis orthogonal in single precision. Columns that vanish are zeroed.
+ */
+static void orthonormalize(float *Q, uint16_t row, uint16_t column)
+{
+	for (uint16_t j = 0; j < column; j++) {
+		float before = 0.0f;
+
+		for (uint16_t i = 0; i < row; i++)
+			before += Q[column * i + j] * Q[column * i + j];
+
+		for (uint8_t pass = 0; pass < 2; pass++) {
+			for (uint16_t k = 0; k < j; k++) {
+				float dot = 0.0f;
+
+				for (uint16_t i = 0; i < row; i++)
+					dot += Q[column * i + k] * Q[column * i + j];
+				for (uint16_t i = 0; i < row; i++)
+					Q[column * i + j] -= dot * Q[column * i + k];
+			}
+		}
+
+		float s = 0.0f;
+
+		for (uint16_t i = 0; i < row; i++)
+			s += Q[column * i + j] * Q[column * i + j];
+
+		// Column was (numerically) in the span of the previous ones
+		if (s <= 1e-10f * before || s == 0.0f) {
+			for (uint16_t i = 0; i < row; i++)
+				Q[column * i + j] = 0.0f;
+			continue;
+		}
+
+		s = 1.0f / sqrtf(s);
+		for (uint16_t i = 0; i < row; i++)
+			Q[column * i + j] *= s;
+	}
+}
+
+// C [row_a*column_b] = A' * B where A is [row*row_a] and B is [row*column_b]
+static void mul_transposed(float *C, const float *const A, const float *const B, uint16_t row,
+			   uint16_t row_a, uint16_t column_b)
+{
+	memset(C, 0, row_a * column_b * sizeof(float));
+	for (uint16_t k = 0; k < row; k++) {
+		for (uint16_t i = 0; i < row_a; i++) {
+			float a = A[row_a * k + i];
+
+			for (uint16_t j = 0; j < column_b; j++)
+				C[column_b * i + j] += a * B[column_b * k + j];
+		}
+	}
+}
+
+int svd_randomized(const float *const A, uint16_t row, uint16_t column, uint16_t rank,
+		   uint16_t oversampling, uint8_t power_iterations, float *U, float *S, float *V)
+{
+	const uint16_t min_dim = row < column ? row : column;
+
+	if (rank == 0 || rank > min_dim)
+		return -EINVAL;
+
+	// Number of samples of the range of A
+	const uint16_t l = (rank + oversampling < min_dim) ? rank + oversampling : min_dim;
+	struct rng rng;
+
+	float Omega[column * l];
+	float Y[row * l];
+	float Bt[column * l];
+
+	// Y = A * Omega where Omega is a random test matrix
+	rng_init(&rng, SVD_RANDOMIZED_SEED, 0);
+	rng_fill_uniform(&rng, Omega, (uint32_t)column * l, -1.0f, 1.0f);
+	mul(Y, A, Omega, row, column, column, l);
+	orthonormalize(Y, row, l);
+
+	// Power iterations sharpen the decay of the singular values: Y = (A * A')^q * Y
+	for (uint8_t q = 0; q < power_iterations; q++) {
+		mul_transposed(Bt, A, Y, row, column, l);
+		orthonormalize(Bt, column, l);
+		mul(Y, A, Bt, row, column, column, l);
+		orthonormalize(Y, row, l);
+	}
+
+	// B = Q' * A is small. Decompose B' = Ub * S * Vb' instead since B is wide.
+	mul_transposed(Bt, A, Y, row, column, l);
+
+	float Ub[column * l];
+	float Sb[l];
+	float Vb[l * l];
+
+	if (svd_golub_reinsch(Bt, column, l, Ub, Sb, Vb) != 0)
+		return -ENOTSUP;
+
+	/*
+	 * When the samples are rank deficient the signs of Ub and Vb may disagree.
+	 * Recompute the leading columns of Vb as Bt' * Ub / S so that every
+	 * triplet satisfies Bt * vb = s * ub.
+	 */
+	for (uint16_t j = 0; j < rank; j++) {
+		if (Sb[j] <= 0.0f)
+			continue;
+		for (uint16_t k = 0; k < l; k++) {
+			float sum = 0.0f;
+
+			for (uint16_t i = 0; i < column; i++)
+				sum += Bt[l * i + k] * Ub[l * i + j];
+			Vb[l * k + j] = sum / Sb[j];
+		}
+	}
+
+	// A = Q * B = (Q * Vb) * S * Ub'
+	for (uint16_t i = 0; i < row; i++) {
+		for (uint16_t j = 0; j < rank; j++) {
+			float sum = 0.0f;
+
+			for (uint16_t k = 0; k < l; k++)
+				sum += Y[l * i + k] * Vb[l * k + j];
+			U[rank * i + j] = sum;
+		}
+	}
+	for (uint16_t i = 0; i < column; i++)
+		memcpy(&V[rank * i], &Ub[l * i], rank * sizeof(float));
+	memcpy(S, Sb, rank * sizeof(float));
+
+	return 0;
+}
@@ -9,6 +9,7 @@
 
 #include "control/linalg.h"
 
+#include <errno.h>
 #include <string.h>
 
 void tran(float *At, const float *const A, uint16_t row, uint16_t column)
@@ -29,3 +30,17 @@ void tran(float *At, const float *const A, uint16_t row, uint16_t column)
 	// Copy!
 	memcpy(At, B, row * column * sizeof(float));
 }
+
+int tran_view(struct mat_view At, const struct mat_view A)
+{
+	if (At.rows != A.cols || At.cols != A.rows)
+		return -EINVAL;
+
+	for (uint32_t i = 0; i < A.rows; i++) {
+		const float *a = &A.data[A.ld * i];
+
+		for (uint32_t j = 0; j < A.cols; j++)
+			At.data[At.ld * j + i] = a[j];
+	}
+	return 0;
+}
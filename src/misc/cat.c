@@ -7,27 +7,29 @@
  * Training: https://swedishembedded.com/training
  */
 
+#include "control/linalg.h"
 #include "control/misc.h"
 
 #include <assert.h>
-#include <string.h>
 
 void cat(float *C, const float *const A, const float *const B, int vertical, uint16_t row_a,
 	 uint16_t column_a, uint16_t row_b, uint16_t column_b, uint16_t row_c, uint16_t column_c)
 {
+	const struct mat_view c = mat_view_init(C, row_c, column_c);
+
 	if (vertical == 1) {
 		/* C = [A;B] */
 		assert(column_a == column_b);
 		assert(row_a + row_b == row_c);
-		memcpy(C, A, row_a * column_a * sizeof(float));
-		memcpy(C + row_a * column_a, B, row_b * column_b * sizeof(float));
 	} else {
 		/* C = [A, B] */
 		assert(row_a == row_b);
 		assert(column_a + column_b == column_c);
-		memcpy(C, A, column_a * sizeof(float));
-		memcpy(C + column_a, B, column_b * sizeof(float));
-		memcpy(C + column_a + column_b, A + column_a, column_a * sizeof(float));
-		memcpy(C + column_a + column_b + column_a, B + column_b, column_b * sizeof(float));
 	}
+
+	copy_view(mat_view_block(c, 0, 0, row_a, column_a),
+		  mat_view_init((float *)A, row_a, column_a));
+	copy_view(mat_view_block(c, vertical == 1 ? row_a : 0, vertical == 1 ? 0 : column_a, row_b,
+				 column_b),
+		  mat_view_init((float *)B, row_b, column_b));
 }
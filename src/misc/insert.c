@@ -7,22 +7,15 @@
  * Training: https://swedishembedded.com/training
  */
 
+#include "control/linalg.h"
 #include "control/misc.h"
 
-#include <string.h>
-
 void insert(float *B, const float *const A, uint16_t row_a, uint16_t column_a, uint16_t column_b,
 	    uint16_t startRow_b, uint16_t startColumn_b)
 {
-	const float *Apos = A;
-
-	// Now we are standing on position startRow_b x startColumn_b of row_b x column_b
-	B += startRow_b * column_b + startColumn_b;
+	// Rows of B are not known here, only that A fits below startRow_b
+	const struct mat_view b = mat_view_init(B, startRow_b + row_a, column_b);
 
-	// We start at startRow_b and end at row_a, then we have inserted all rows from A into B
-	for (uint16_t i = 0; i < row_a; i++) {
-		memcpy(B, Apos, column_a * sizeof(float)); // Insert the complete row from A into B
-		Apos += column_a;
-		B += column_b;
-	}
+	copy_view(mat_view_block(b, startRow_b, startColumn_b, row_a, column_a),
+		  mat_view_init((float *)A, row_a, column_a));
 }
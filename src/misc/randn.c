@@ -9,41 +9,13 @@
 
 #include "control/misc.h"
 
-#include <math.h>
-#include <stdbool.h>
 #include <stdlib.h>
-#include <time.h>
-
-static float generate_gauss(float mu, float sigma)
-{
-	float U1, U2, W, scalar;
-	static float X1, X2;
-	static int call;
-
-	if (call == 1) {
-		call = !call;
-		return (mu + sigma * X2);
-	}
-
-	// Compute the uniform norm
-	do {
-		U1 = -1.0f + ((float)rand() / (float)RAND_MAX) * 2.0f;
-		U2 = -1.0f + ((float)rand() / (float)RAND_MAX) * 2.0f;
-		W = powf(U1, 2) + powf(U2, 2);
-	} while (W >= 1.0f || W == 0.0f);
-
-	// TODO: potential division by zero
-	scalar = sqrtf((-2.0f * logf(W)) / W);
-	X1 = U1 * scalar;
-	X2 = U2 * scalar;
-
-	call = !call;
-
-	return (mu + sigma * X1);
-}
 
 void randn(float *x, uint16_t length, float mu, float sigma)
 {
-	for (uint16_t i = 0; i < length; i++)
-		x[i] = generate_gauss(mu, sigma);
+	struct rng stream;
+
+	// Keyed from rand() on every call so srand() selects the sequence
+	rng_init(&stream, ((uint64_t)(uint32_t)rand() << 32) ^ (uint32_t)rand(), 0);
+	rng_fill_normal(&stream, x, length, mu, sigma);
 }
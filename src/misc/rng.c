@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/misc.h"
+
+#include <math.h>
+#include <string.h>
+
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+#define PHILOX_ROUNDS 10
+
+#define RNG_CHUNK 64 // Words generated per pass of the bulk transforms
+
+static void philox(uint32_t *out, const uint32_t *const counter, const uint32_t *const key)
+{
+	uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+	uint32_t k0 = key[0], k1 = key[1];
+
+	for (uint8_t r = 0; r < PHILOX_ROUNDS; r++) {
+		const uint64_t p0 = (uint64_t)PHILOX_M0 * c0;
+		const uint64_t p1 = (uint64_t)PHILOX_M1 * c2;
+
+		c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+		c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+		c1 = (uint32_t)p1;
+		c3 = (uint32_t)p0;
+		k0 += PHILOX_W0;
+		k1 += PHILOX_W1;
+	}
+	out[0] = c0;
+	out[1] = c1;
+	out[2] = c2;
+	out[3] = c3;
+}
+
+static void increment(struct rng *self)
+{
+	if (++self->counter[0] == 0)
+		self->counter[1]++;
+}
+
+void rng_init(struct rng *self, uint64_t seed, uint32_t stream)
+{
+	self->key[0] = (uint32_t)seed;
+	self->key[1] = (uint32_t)(seed >> 32);
+	self->counter[0] = 0;
+	self->counter[1] = 0;
+	self->counter[2] = stream;
+	self->counter[3] = 0;
+	self->index = 4;
+}
+
+void rng_seek(struct rng *self, uint64_t position)
+{
+	const uint64_t block = position / 4;
+
+	self->counter[0] = (uint32_t)block;
+	self->counter[1] = (uint32_t)(block >> 32);
+	self->index = 4;
+	if (position % 4) {
+		philox(self->buffer, self->counter, self->key);
+		increment(self);
+		self->index = (uint8_t)(position % 4);
+	}
+}
+
+uint32_t rng_next(struct rng *self)
+{
+	if (self->index == 4) {
+		philox(self->buffer, self->counter, self->key);
+		increment(self);
+		self->index = 0;
+	}
+	return self->buffer[self->index++];
+}
+
+void rng_fill(struct rng *self, uint32_t *w, uint32_t length)
+{
+	// Words left over from the last block come first
+	while (length > 0 && self->index < 4) {
+		*w++ = self->buffer[self->index++];
+		length--;
+	}
+	while (length >= 4) {
+		philox(w, self->counter, self->key);
+		increment(self);
+		w += 4;
+		length -= 4;
+	}
+	while (length > 0) {
+		*w++ = rng_next(self);
+		length--;
+	}
+}
+
+float rng_uniform(struct rng *self)
+{
+	return (float)(rng_next(self) >> 8) * (1.0f / 16777216.0f);
+}
+
+void rng_fill_uniform(struct rng *self, float *x, uint32_t length, float low, float high)
+{
+	const float scale = (high - low) * (1.0f / 16777216.0f);
+	uint32_t w[RNG_CHUNK];
+
+	while (length > 0) {
+		const uint32_t n = length < RNG_CHUNK ? length : RNG_CHUNK;
+
+		rng_fill(self, w, n);
+		for (uint32_t i = 0; i < n; i++)
+			x[i] = low + (float)(w[i] >> 8) * scale;
+		x += n;
+		length -= n;
+	}
+}
+
+void rng_fill_normal(struct rng *self, float *x, uint32_t length, float mu, float sigma)
+{
+	uint32_t w[RNG_CHUNK];
+	float out[RNG_CHUNK];
+
+	while (length > 0) {
+		const uint32_t n = length < RNG_CHUNK ? length : RNG_CHUNK;
+		// One word per output, rounded up to whole pairs
+		const uint32_t words = (n + 1) & ~1u;
+
+		rng_fill(self, w, words);
+		for (uint32_t i = 0; i < words; i += 2) {
+			// u1 in (0, 1] keeps the logarithm finite
+			const float u1 = (float)((w[i] >> 8) + 1) * (1.0f / 16777216.0f);
+			const float u2 = (float)(w[i + 1] >> 8) * (1.0f / 16777216.0f);
+			const float radius = sigma * sqrtf(-2.0f * logf(u1));
+			const float angle = 2.0f * (float)M_PI * u2;
+
+			out[i] = mu + radius * cosf(angle);
+			out[i + 1] = mu + radius * sinf(angle);
+		}
+		memcpy(x, out, n * sizeof(float));
+		x += n;
+		length -= n;
+	}
+}
@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/misc.h"
+
+#include <math.h>
+
+#define STATS_CHUNK 256 // Samples per chunk of stats_update_block()
+
+void stats_init(struct stats *self)
+{
+	self->count = 0;
+	self->mean = 0.0f;
+	self->m2 = 0.0f;
+	self->min = INFINITY;
+	self->max = -INFINITY;
+}
+
+void stats_update(struct stats *self, float x)
+{
+	self->count++;
+
+	const float delta = x - self->mean;
+
+	self->mean += delta / (float)self->count;
+	self->m2 += delta * (x - self->mean);
+	if (x < self->min)
+		self->min = x;
+	if (x > self->max)
+		self->max = x;
+}
+
+void stats_merge(struct stats *self, const struct stats *other)
+{
+	if (other->count == 0)
+		return;
+	if (self->count == 0) {
+		*self = *other;
+		return;
+	}
+
+	const uint64_t count = self->count + other->count;
+	const float delta = other->mean - self->mean;
+	const float weight = (float)other->count / (float)count;
+
+	self->mean += delta * weight;
+	self->m2 += other->m2 + delta * delta * (float)self->count * weight;
+	self->count = count;
+	if (other->min < self->min)
+		self->min = other->min;
+	if (other->max > self->max)
+		self->max = other->max;
+}
+
+void stats_update_block(struct stats *self, const float *const x, uint64_t length)
+{
+	for (uint64_t start = 0; start < length; start += STATS_CHUNK) {
+		const uint32_t n =
+			length - start < STATS_CHUNK ? (uint32_t)(length - start) : STATS_CHUNK;
+		const float *const c = &x[start];
+		struct stats chunk;
+		float sum = 0.0f, m2 = 0.0f;
+		float lo = c[0], hi = c[0];
+
+		// Two passes over a chunk that is still in cache
+		for (uint32_t i = 0; i < n; i++) {
+			sum += c[i];
+			lo = c[i] < lo ? c[i] : lo;
+			hi = c[i] > hi ? c[i] : hi;
+		}
+
+		const float mu = sum / (float)n;
+
+		for (uint32_t i = 0; i < n; i++)
+			m2 += (c[i] - mu) * (c[i] - mu);
+
+		chunk.count = n;
+		chunk.mean = mu;
+		chunk.m2 = m2;
+		chunk.min = lo;
+		chunk.max = hi;
+		stats_merge(self, &chunk);
+	}
+}
+
+float stats_variance(const struct stats *self)
+{
+	if (self->count < 2)
+		return 0.0f;
+	return self->m2 / (float)(self->count - 1);
+}
+
+float stats_stddev(const struct stats *self)
+{
+	return sqrtf(stats_variance(self));
+}
+
+void p2_quantile_init(struct p2_quantile *self, float p)
+{
+	self->p = p;
+	self->count = 0;
+	for (uint8_t i = 0; i < 5; i++) {
+		self->q[i] = 0.0f;
+		self->n[i] = i;
+		self->offset[i] = 0.0f;
+	}
+}
+
+// Piecewise parabolic prediction of marker i moved by d
+static float parabolic(const struct p2_quantile *self, uint8_t i, float d)
+{
+	const float *q = self->q;
+	const float n0 = (float)(self->n[i] - self->n[i - 1]);
+	const float n1 = (float)(self->n[i + 1] - self->n[i]);
+
+	return q[i] + d / (n0 + n1) *
+			      ((n0 + d) * (q[i + 1] - q[i]) / n1 + (n1 - d) * (q[i] - q[i - 1]) / n0);
+}
+
+void p2_quantile_update(struct p2_quantile *self, float x)
+{
+	const float p = self->p;
+	// Increments of the desired positions (count - 1) * {0, p/2, p, (1 + p)/2, 1}
+	const float rate[5] = { 0.0f, p / 2.0f, p, (1.0f + p) / 2.0f, 1.0f };
+	float *q = self->q;
+
+	if (self->count < 5) {
+		// Insertion sort of the first samples
+		int i = (int)self->count - 1;
+
+		while (i >= 0 && q[i] > x) {
+			q[i + 1] = q[i];
+			i--;
+		}
+		q[i + 1] = x;
+		self->count++;
+		if (self->count == 5) {
+			// Desired positions of sample five minus the actual ones
+			for (uint8_t j = 0; j < 5; j++)
+				self->offset[j] = 4.0f * rate[j] - (float)j;
+		}
+		return;
+	}
+
+	uint8_t k;
+
+	if (x < q[0]) {
+		q[0] = x;
+		k = 0;
+	} else if (x >= q[4]) {
+		q[4] = x;
+		k = 3;
+	} else {
+		k = 0;
+		while (k < 3 && x >= q[k + 1])
+			k++;
+	}
+	self->count++;
+
+	// Offsets stay small so they keep full precision for any count
+	for (uint8_t i = 0; i < 5; i++) {
+		if (i > k) {
+			self->n[i]++;
+			self->offset[i] -= 1.0f;
+		}
+		self->offset[i] += rate[i];
+	}
+
+	for (uint8_t i = 1; i < 4; i++) {
+		const float e = self->offset[i];
+
+		if ((e >= 1.0f && self->n[i + 1] - self->n[i] > 1) ||
+		    (e <= -1.0f && self->n[i - 1] - self->n[i] < -1)) {
+			const int d = e >= 0.0f ? 1 : -1;
+			float h = parabolic(self, i, (float)d);
+
+			if (!(q[i - 1] < h && h < q[i + 1]))
+				h = q[i] + (float)d * (q[i + d] - q[i]) /
+						   (float)(self->n[i + d] - self->n[i]);
+			q[i] = h;
+			self->n[i] += d;
+			self->offset[i] -= (float)d;
+		}
+	}
+}
+
+void p2_quantile_update_block(struct p2_quantile *self, const float *const x, uint64_t length)
+{
+	for (uint64_t i = 0; i < length; i++)
+		p2_quantile_update(self, x[i]);
+}
+
+float p2_quantile_value(const struct p2_quantile *self)
+{
+	if (self->count == 0)
+		return NAN;
+	if (self->count < 5) {
+		// Nearest rank of the sorted samples
+		const uint8_t i = (uint8_t)(self->p * (float)(self->count - 1) + 0.5f);
+
+		return self->q[i];
+	}
+	return self->q[2];
+}
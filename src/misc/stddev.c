@@ -9,8 +9,6 @@
 
 #include "control/misc.h"
 
-#include <math.h>
-
 /*
  * Compute Standard deviation
  * x[L] Vector with values
@@ -18,12 +16,10 @@
  */
 float stddev(const float *const x, uint16_t length)
 {
-	float mu = mean(x, length);
-	float sigma = 0;
-
-	for (uint16_t i = 0; i < length; i++) {
-		sigma += (x[i] - mu) * (x[i] - mu);
-	}
+	struct stats s;
 
-	return sqrtf(sigma / ((float)length - 1));
+	// One pass over memory, each chunk is revisited while it is in cache
+	stats_init(&s);
+	stats_update_block(&s, x, length);
+	return stats_stddev(&s);
 }
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/sparse.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+int csc_init(struct sparse_csc *self, uint16_t rows, uint16_t cols, uint32_t *col_ptr,
+	     uint16_t *row_idx, float *values, uint32_t capacity)
+{
+	if (!self || !col_ptr || (capacity > 0 && (!row_idx || !values)))
+		return -EINVAL;
+
+	self->rows = rows;
+	self->cols = cols;
+	self->nnz = 0;
+	self->capacity = capacity;
+	self->col_ptr = col_ptr;
+	self->row_idx = row_idx;
+	self->values = values;
+	memset(col_ptr, 0, (cols + 1) * sizeof(uint32_t));
+	return 0;
+}
+
+int csc_from_dense(struct sparse_csc *self, const float *const A, float tolerance)
+{
+	uint32_t nnz = 0;
+
+	for (uint16_t j = 0; j < self->cols; j++) {
+		self->col_ptr[j] = nnz;
+		for (uint16_t i = 0; i < self->rows; i++) {
+			const float a = A[self->cols * i + j];
+
+			if (a == 0.0f || fabsf(a) <= tolerance)
+				continue;
+			if (nnz == self->capacity) {
+				// Leave a valid empty matrix behind
+				memset(self->col_ptr, 0, (self->cols + 1) * sizeof(uint32_t));
+				self->nnz = 0;
+				return -ENOMEM;
+			}
+			self->row_idx[nnz] = i;
+			self->values[nnz] = a;
+			nnz++;
+		}
+	}
+	self->col_ptr[self->cols] = nnz;
+	self->nnz = nnz;
+	return 0;
+}
+
+int csc_from_csr(struct sparse_csc *self, const struct sparse_csr *A)
+{
+	if (self->rows != A->rows || self->cols != A->cols)
+		return -EINVAL;
+	if (A->nnz > self->capacity)
+		return -ENOMEM;
+
+	// Count entries per column, then turn the counts into start offsets
+	memset(self->col_ptr, 0, (self->cols + 1) * sizeof(uint32_t));
+	for (uint32_t k = 0; k < A->nnz; k++)
+		self->col_ptr[A->col_idx[k] + 1]++;
+	for (uint16_t j = 0; j < self->cols; j++)
+		self->col_ptr[j + 1] += self->col_ptr[j];
+
+	// Rows are visited in order so row indices within a column stay sorted
+	uint32_t next[self->cols + 1];
+
+	memcpy(next, self->col_ptr, (self->cols + 1) * sizeof(uint32_t));
+	for (uint16_t i = 0; i < A->rows; i++) {
+		for (uint32_t k = A->row_ptr[i]; k < A->row_ptr[i + 1]; k++) {
+			const uint32_t dst = next[A->col_idx[k]]++;
+
+			self->row_idx[dst] = i;
+			self->values[dst] = A->values[k];
+		}
+	}
+	self->nnz = A->nnz;
+	return 0;
+}
+
+void csc_to_dense(float *A, const struct sparse_csc *self)
+{
+	memset(A, 0, self->rows * self->cols * sizeof(float));
+	for (uint16_t j = 0; j < self->cols; j++)
+		for (uint32_t k = self->col_ptr[j]; k < self->col_ptr[j + 1]; k++)
+			A[self->cols * self->row_idx[k] + j] = self->values[k];
+}
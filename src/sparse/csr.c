@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/sparse.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+int csr_init(struct sparse_csr *self, uint16_t rows, uint16_t cols, uint32_t *row_ptr,
+	     uint16_t *col_idx, float *values, uint32_t capacity)
+{
+	if (!self || !row_ptr || (capacity > 0 && (!col_idx || !values)))
+		return -EINVAL;
+
+	self->rows = rows;
+	self->cols = cols;
+	self->nnz = 0;
+	self->capacity = capacity;
+	self->row_ptr = row_ptr;
+	self->col_idx = col_idx;
+	self->values = values;
+	memset(row_ptr, 0, (rows + 1) * sizeof(uint32_t));
+	return 0;
+}
+
+int csr_from_dense(struct sparse_csr *self, const float *const A, float tolerance)
+{
+	uint32_t nnz = 0;
+
+	for (uint16_t i = 0; i < self->rows; i++) {
+		self->row_ptr[i] = nnz;
+		for (uint16_t j = 0; j < self->cols; j++) {
+			const float a = A[self->cols * i + j];
+
+			if (a == 0.0f || fabsf(a) <= tolerance)
+				continue;
+			if (nnz == self->capacity) {
+				// Leave a valid empty matrix behind
+				memset(self->row_ptr, 0, (self->rows + 1) * sizeof(uint32_t));
+				self->nnz = 0;
+				return -ENOMEM;
+			}
+			self->col_idx[nnz] = j;
+			self->values[nnz] = a;
+			nnz++;
+		}
+	}
+	self->row_ptr[self->rows] = nnz;
+	self->nnz = nnz;
+	return 0;
+}
+
+void csr_to_dense(float *A, const struct sparse_csr *self)
+{
+	memset(A, 0, self->rows * self->cols * sizeof(float));
+	for (uint16_t i = 0; i < self->rows; i++)
+		for (uint32_t k = self->row_ptr[i]; k < self->row_ptr[i + 1]; k++)
+			A[self->cols * i + self->col_idx[k]] = self->values[k];
+}
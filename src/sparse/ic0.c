@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/sparse.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+int csr_ic0(struct sparse_csr *L, const struct sparse_csr *A)
+{
+	if (A->rows != A->cols || L->rows != A->rows || L->cols != A->cols || L == A)
+		return -EINVAL;
+
+	const uint16_t n = A->rows;
+	uint32_t nnz = 0;
+
+	// Copy the lower triangle of A
+	for (uint16_t i = 0; i < n; i++) {
+		L->row_ptr[i] = nnz;
+		for (uint32_t k = A->row_ptr[i]; k < A->row_ptr[i + 1] && A->col_idx[k] <= i; k++) {
+			if (nnz == L->capacity) {
+				// Leave L a valid empty matrix like csr_from_dense()
+				memset(L->row_ptr, 0, (n + 1) * sizeof(uint32_t));
+				L->nnz = 0;
+				return -ENOMEM;
+			}
+			L->col_idx[nnz] = A->col_idx[k];
+			L->values[nnz] = A->values[k];
+			nnz++;
+		}
+	}
+	L->row_ptr[n] = nnz;
+	L->nnz = nnz;
+
+	for (uint16_t i = 0; i < n; i++) {
+		for (uint32_t ij = L->row_ptr[i]; ij < L->row_ptr[i + 1]; ij++) {
+			const uint16_t j = L->col_idx[ij];
+
+			// s = A(i, j) - L(i, 0:j-1) * L(j, 0:j-1)' by merging the sorted rows
+			float s = L->values[ij];
+			uint32_t a = L->row_ptr[i];
+			uint32_t b = L->row_ptr[j];
+
+			while (a < ij && b < L->row_ptr[j + 1] && L->col_idx[b] < j) {
+				if (L->col_idx[a] < L->col_idx[b]) {
+					a++;
+				} else if (L->col_idx[a] > L->col_idx[b]) {
+					b++;
+				} else {
+					s -= L->values[a] * L->values[b];
+					a++;
+					b++;
+				}
+			}
+
+			if (j < i) {
+				// Diagonal of row j is its last entry
+				const float d = L->values[L->row_ptr[j + 1] - 1];
+
+				L->values[ij] = s / d;
+			} else {
+				if (!(s > 0.0f))
+					return -ENOTSUP;
+				L->values[ij] = sqrtf(s);
+			}
+		}
+		// Every row needs its diagonal as the last entry
+		if (L->row_ptr[i + 1] == L->row_ptr[i] || L->col_idx[L->row_ptr[i + 1] - 1] != i)
+			return -ENOTSUP;
+	}
+	return 0;
+}
+
+void csr_ic0_preconditioner(float *y, const float *const x, uint16_t row, void *ctx)
+{
+	const struct sparse_csr *L = ctx;
+
+	(void)row;
+	csr_linsolve_lower_triangular(y, L, x);
+	csr_linsolve_lower_triangular_transposed(y, L, y);
+}
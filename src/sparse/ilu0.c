@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/sparse.h"
+
+#include <errno.h>
+#include <string.h>
+
+int csr_ilu0(struct sparse_csr *LU, const struct sparse_csr *A)
+{
+	if (A->rows != A->cols || LU->rows != A->rows || LU->cols != A->cols)
+		return -EINVAL;
+	if (A->nnz > LU->capacity)
+		return -ENOMEM;
+
+	const uint16_t n = A->rows;
+
+	if (LU != A) {
+		memcpy(LU->row_ptr, A->row_ptr, (n + 1) * sizeof(uint32_t));
+		memcpy(LU->col_idx, A->col_idx, A->nnz * sizeof(uint16_t));
+		memcpy(LU->values, A->values, A->nnz * sizeof(float));
+		LU->nnz = A->nnz;
+	}
+
+	// Position of the diagonal of every row
+	uint32_t diagonal[n];
+
+	for (uint16_t i = 0; i < n; i++) {
+		diagonal[i] = UINT32_MAX;
+		for (uint32_t k = LU->row_ptr[i]; k < LU->row_ptr[i + 1]; k++)
+			if (LU->col_idx[k] == i)
+				diagonal[i] = k;
+		if (diagonal[i] == UINT32_MAX)
+			return -ENOTSUP;
+	}
+
+	// Where column j sits in the current row, UINT32_MAX if outside the pattern
+	uint32_t position[n];
+
+	for (uint16_t j = 0; j < n; j++)
+		position[j] = UINT32_MAX;
+
+	for (uint16_t i = 0; i < n; i++) {
+		const uint32_t start = LU->row_ptr[i];
+		const uint32_t end = LU->row_ptr[i + 1];
+
+		for (uint32_t k = start; k < end; k++)
+			position[LU->col_idx[k]] = k;
+
+		// Eliminate with every earlier row k, updates outside the pattern are dropped
+		for (uint32_t kk = start; kk < end && LU->col_idx[kk] < i; kk++) {
+			const uint16_t k = LU->col_idx[kk];
+			const float pivot = LU->values[diagonal[k]];
+
+			if (pivot == 0.0f)
+				return -ENOTSUP;
+
+			const float l = LU->values[kk] / pivot;
+
+			LU->values[kk] = l;
+			for (uint32_t kj = diagonal[k] + 1; kj < LU->row_ptr[k + 1]; kj++) {
+				const uint32_t p = position[LU->col_idx[kj]];
+
+				if (p != UINT32_MAX)
+					LU->values[p] -= l * LU->values[kj];
+			}
+		}
+
+		for (uint32_t k = start; k < end; k++)
+			position[LU->col_idx[k]] = UINT32_MAX;
+	}
+
+	return LU->values[diagonal[n - 1]] == 0.0f ? -ENOTSUP : 0;
+}
+
+void csr_ilu0_preconditioner(float *y, const float *const x, uint16_t row, void *ctx)
+{
+	const struct sparse_csr *LU = ctx;
+
+	// Forward substitution with the unit lower triangle
+	for (uint16_t i = 0; i < row; i++) {
+		float sum = x[i];
+
+		for (uint32_t k = LU->row_ptr[i]; k < LU->row_ptr[i + 1] && LU->col_idx[k] < i; k++)
+			sum -= LU->values[k] * y[LU->col_idx[k]];
+		y[i] = sum;
+	}
+
+	// Backward substitution with the upper triangle
+	csr_linsolve_upper_triangular(y, LU, y);
+}
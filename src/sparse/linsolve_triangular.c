@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/sparse.h"
+
+#include <errno.h>
+#include <string.h>
+
+int csr_linsolve_lower_triangular(float *x, const struct sparse_csr *L, const float *const b)
+{
+	if (L->rows != L->cols)
+		return -EINVAL;
+
+	// x[i] only depends on x[j < i] so b may be overwritten in place
+	for (uint16_t i = 0; i < L->rows; i++) {
+		float sum = b[i];
+		float diagonal = 0.0f;
+
+		for (uint32_t k = L->row_ptr[i]; k < L->row_ptr[i + 1]; k++) {
+			const uint16_t j = L->col_idx[k];
+
+			if (j < i)
+				sum -= L->values[k] * x[j];
+			else if (j == i)
+				diagonal = L->values[k];
+		}
+		if (diagonal == 0.0f)
+			return -ENOTSUP;
+		x[i] = sum / diagonal;
+	}
+	return 0;
+}
+
+int csr_linsolve_upper_triangular(float *x, const struct sparse_csr *U, const float *const b)
+{
+	if (U->rows != U->cols)
+		return -EINVAL;
+
+	for (int i = U->rows - 1; i >= 0; i--) {
+		float sum = b[i];
+		float diagonal = 0.0f;
+
+		for (uint32_t k = U->row_ptr[i]; k < U->row_ptr[i + 1]; k++) {
+			const uint16_t j = U->col_idx[k];
+
+			if (j > i)
+				sum -= U->values[k] * x[j];
+			else if (j == i)
+				diagonal = U->values[k];
+		}
+		if (diagonal == 0.0f)
+			return -ENOTSUP;
+		x[i] = sum / diagonal;
+	}
+	return 0;
+}
+
+int csr_linsolve_lower_triangular_transposed(float *x, const struct sparse_csr *L,
+					     const float *const b)
+{
+	if (L->rows != L->cols)
+		return -EINVAL;
+
+	if (x != b)
+		memcpy(x, b, L->rows * sizeof(float));
+
+	// Row i of L is column i of L'. Solve for x[i] then remove it from the rows above.
+	for (int i = L->rows - 1; i >= 0; i--) {
+		float diagonal = 0.0f;
+
+		for (uint32_t k = L->row_ptr[i]; k < L->row_ptr[i + 1]; k++)
+			if (L->col_idx[k] == i)
+				diagonal = L->values[k];
+		if (diagonal == 0.0f)
+			return -ENOTSUP;
+
+		x[i] /= diagonal;
+		for (uint32_t k = L->row_ptr[i]; k < L->row_ptr[i + 1]; k++)
+			if (L->col_idx[k] < i)
+				x[L->col_idx[k]] -= L->values[k] * x[i];
+	}
+	return 0;
+}
@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/sparse.h"
+
+#include <string.h>
+
+void csr_spmm(float *C, const struct sparse_csr *A, const float *const B, uint16_t column_b)
+{
+	memset(C, 0, (uint32_t)A->rows * column_b * sizeof(float));
+	for (uint16_t i = 0; i < A->rows; i++) {
+		float *c = &C[column_b * i];
+
+		// Every nonzero A(i, j) adds a scaled row j of B to row i of C
+		for (uint32_t k = A->row_ptr[i]; k < A->row_ptr[i + 1]; k++) {
+			const float a = A->values[k];
+			const float *b = &B[column_b * A->col_idx[k]];
+
+			for (uint16_t j = 0; j < column_b; j++)
+				c[j] += a * b[j];
+		}
+	}
+}
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: MIT
+/**
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/consulting
+ * Simulation: https://swedishembedded.com/simulation
+ * Training: https://swedishembedded.com/training
+ */
+
+#include "control/sparse.h"
+
+#include <string.h>
+
+void csr_spmv(float *y, const struct sparse_csr *A, const float *const x)
+{
+	for (uint16_t i = 0; i < A->rows; i++) {
+		float sum = 0.0f;
+
+		for (uint32_t k = A->row_ptr[i]; k < A->row_ptr[i + 1]; k++)
+			sum += A->values[k] * x[A->col_idx[k]];
+		y[i] = sum;
+	}
+}
+
+void csr_spmv_transposed(float *y, const struct sparse_csr *A, const float *const x)
+{
+	// Scatter every row of A scaled by x[i]
+	memset(y, 0, A->cols * sizeof(float));
+	for (uint16_t i = 0; i < A->rows; i++) {
+		const float xi = x[i];
+
+		for (uint32_t k = A->row_ptr[i]; k < A->row_ptr[i + 1]; k++)
+			y[A->col_idx[k]] += A->values[k] * xi;
+	}
+}
+
+void csc_spmv(float *y, const struct sparse_csc *A, const float *const x)
+{
+	memset(y, 0, A->rows * sizeof(float));
+	for (uint16_t j = 0; j < A->cols; j++) {
+		const float xj = x[j];
+
+		for (uint32_t k = A->col_ptr[j]; k < A->col_ptr[j + 1]; k++)
+			y[A->row_idx[k]] += A->values[k] * xj;
+	}
+}
+
+void csr_operator(float *y, const float *const x, uint16_t row, void *ctx)
+{
+	(void)row;
+	csr_spmv(y, ctx, x);
+}
@@ -13,6 +13,10 @@
 
 #include <errno.h>
 #include <math.h>
+#include <string.h>
+
+#define OKID_ERA_LANCZOS_RATIO 8 // Use truncated SVD when column_h >= ratio * row_a
+#define OKID_ERA_LANCZOS_STEPS 4 // Lanczos steps per computed singular triplet
 
 int okid_era(float *A, float *B, float *C, uint8_t row_a, const float *const y,
 	     const float *const u, uint16_t io_row, uint16_t io_column)
@@ -20,7 +24,7 @@ int okid_era(float *A, float *B, float *C, uint8_t row_a, const float *const y,
 	if ((io_row == 0) || (io_column == 0)) {
 		return -EINVAL;
 	}
-	if (row_a == 0) {
+	if (row_a == 0 || row_a > io_column / 2) {
 		return -EINVAL;
 	}
 
@@ -34,63 +38,86 @@ int okid_era(float *A, float *B, float *C, uint8_t row_a, const float *const y,
 	const uint16_t row_h = io_row * (io_column / 2);
 	const uint16_t column_h = io_column / 2;
 
-	float Temp[row_h * column_h]; // Temporary
-
-	// Create Half Hankel matrix
-	float H[row_h * column_h];
-
-	// Need to have 1 shift for this algorithm
-	hankel(g, H, io_row, io_column, row_h, column_h, 1);
-
-	// Do SVD on the half hankel matrix H
-	float U[row_h * column_h];
-	float S[column_h];
-	float V[column_h * column_h];
-
-	svd_golub_reinsch(H, row_h, column_h, U, S, V);
+	// Hankel matrices are applied through FFT so they are never formed
+	struct hankel_operator H;
+	float storage[hankel_operator_storage_size(io_row, row_h, column_h)];
+
+	// Only the first row_a singular triplets of H are used
+	float U[row_h * row_a];
+	float S[row_a];
+	float V[column_h * row_a];
+
+	if ((uint16_t)row_a * OKID_ERA_LANCZOS_RATIO <= column_h) {
+		// Need to have 1 shift for this algorithm
+		hankel_operator_init(&H, g, io_row, io_column, row_h, column_h, 1, storage);
+
+		// Truncated SVD is much cheaper when the model order is small
+		if (svd_lanczos(hankel_operator, &H, row_h, column_h, row_a,
+				OKID_ERA_LANCZOS_STEPS * row_a, U, S, V) != 0)
+			return -ENOTSUP;
+	} else {
+		float Hd[row_h * column_h];
+		float Uf[row_h * column_h];
+		float Sf[column_h];
+		float Vf[column_h * column_h];
+
+		hankel(g, Hd, io_row, io_column, row_h, column_h, 1);
+		if (svd_golub_reinsch(Hd, row_h, column_h, Uf, Sf, Vf) != 0)
+			return -ENOTSUP;
+		cut(U, Uf, row_h, column_h, 0, 0, row_h, row_a);
+		cut(V, Vf, column_h, column_h, 0, 0, column_h, row_a);
+		memcpy(S, Sf, row_a * sizeof(float));
+	}
 
 	// Re-create another hankel with shift = 2
-	hankel(g, H, io_row, io_column, row_h, column_h,
-	       2); // Need to have 2 shift for this algorithm
+	hankel_operator_init(&H, g, io_row, io_column, row_h, column_h, 2,
+			     storage); // Need to have 2 shift for this algorithm
 
 	// Create C and B matrix
 	for (int i = 0; i < row_a; i++) {
 		for (int j = 0; j < io_row; j++) {
 			// C = U*S^(1/2)
-			C[j * row_a + i] = U[j * column_h + i] * sqrtf(S[i]);
+			C[j * row_a + i] = U[j * row_a + i] * sqrtf(S[i]);
 		}
 
 		for (int j = 0; j < io_row; j++) {
 			// B = S^(1/2)*V^T
-			B[i * io_row + j] = sqrtf(S[i]) * V[j * column_h + i];
+			B[i * io_row + j] = sqrtf(S[i]) * V[j * row_a + i];
 		}
 	}
 
 	// A = S^(-1/2)*U^T*H*V*S^(-1/2)
 
 	// V = V*S^(-1/2)
-	for (int i = 0; i < column_h; i++) {
+	for (int i = 0; i < row_a; i++) {
 		for (int j = 0; j < column_h; j++) {
-			V[j * column_h + i] *= sqrtf(1.0f / S[i]);
+			V[j * row_a + i] *= sqrtf(1.0f / S[i]);
 		}
 	}
 
 	// U = S^(-1/2)*U^T
-	tran(U, U, row_h, column_h);
+	tran(U, U, row_h, row_a);
 	for (int i = 0; i < row_h; i++) {
-		for (int j = 0; j < column_h; j++) {
+		for (int j = 0; j < row_a; j++) {
 			U[j * row_h + i] *= sqrtf(1.0f / S[j]);
 		}
 	}
 
-	// Create A matrix: T = H*V
-	mul(Temp, H, V, row_h, column_h, column_h, column_h);
-
-	// Now, multiply V = U(column_h, row_h)*Temp(row_h, column_h). U is transpose!
-	mul(V, U, Temp, column_h, row_h, row_h, column_h);
+	// Create A matrix: T = H*V, one column of V at a time
+	float Temp[row_h * row_a];
+	float v[column_h];
+	float t[row_h];
+
+	for (uint16_t i = 0; i < row_a; i++) {
+		for (uint16_t j = 0; j < column_h; j++)
+			v[j] = V[j * row_a + i];
+		hankel_operator(t, v, false, &H);
+		for (uint16_t j = 0; j < row_h; j++)
+			Temp[j * row_a + i] = t[j];
+	}
 
-	// Get the elements of V -> A
-	cut(A, V, column_h, column_h, 0, 0, row_a, row_a);
+	// Now, multiply A = U(row_a, row_h)*Temp(row_h, row_a). U is transpose!
+	mul(A, U, Temp, row_a, row_h, row_h, row_a);
 
 	return 0;
 }
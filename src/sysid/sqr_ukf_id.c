@@ -34,48 +34,43 @@ static void create_sigma_point_matrix(float W[], float what[], float Sw[], float
 	float lambda = alpha * alpha * ((float)L + kappa) - (float)L;
 	float gamma = sqrtf((float)L + lambda);
 
-	/* Insert first column in W */
+	/* Sigma points are stored one after the other, insert the first point in W */
 	for (uint8_t i = 0; i < L; i++) {
-		W[i * N] = what[i];
+		W[i] = what[i];
 	}
 
-	/* Insert in to the middle of the columns - Positive */
+	/* Insert the middle points - Positive */
 	for (uint8_t j = 1; j < K; j++) {
 		for (uint8_t i = 0; i < L; i++) {
-			W[i * N + j] = what[i] + gamma * Sw[i * L + j - 1];
+			W[j * L + i] = what[i] + gamma * Sw[i * L + j - 1];
 		}
 	}
 
-	/* Insert in the rest of the columns - Negative */
+	/* Insert the rest of the points - Negative */
 	for (uint8_t j = K; j < N; j++) {
 		for (uint8_t i = 0; i < L; i++) {
-			W[i * N + j] = what[i] - gamma * Sw[i * L + j - K];
+			W[j * L + i] = what[i] - gamma * Sw[i * L + j - K];
 		}
 	}
 }
 
-static void compute_transistion_function(float D[], float W[], float x[],
-					 void (*G)(float[], float[], float[]), uint8_t L)
-{
-	/* Create the size N */
-	uint8_t N = 2 * L + 1;
+struct point_model {
+	void (*G)(float dw[], float x[], float w[]);
+	float *x;
+};
 
-	/* Create the derivative state and state vector */
-	float dw[L];
+// Calls a model of one sigma point for each point of the batch
+static void model_each(float *D, const float *const x, const float *const W, uint16_t count,
+		       uint8_t L, void *ctx)
+{
+	(void)x;
+	struct point_model *pm = (struct point_model *)ctx;
 	float w[L];
 
-	/* Call the F transition function with W matrix */
-	for (uint8_t j = 0; j < N; j++) {
-		/* Fill the state vector w with every row from W */
-		for (uint8_t i = 0; i < L; i++)
-			w[i] = W[i * N + j];
-
-		/* Call the transition function */
-		G(dw, x, w);
-
-		/* Get dw into D */
-		for (uint8_t i = 0; i < L; i++)
-			D[i * N + j] = dw[i];
+	// W is read again after G, so every point is passed as a private copy
+	for (uint16_t j = 0; j < count; j++) {
+		memcpy(w, &W[j * L], L * sizeof(float));
+		pm->G(&D[j * L], pm->x, w);
 	}
 }
 
@@ -90,14 +85,13 @@ static void multiply_sigma_point_matrix_to_weights(float dhat[], float D[], floa
 	/* Multiply dhat = Wm*D */
 	for (uint8_t j = 0; j < N; j++)
 		for (uint8_t i = 0; i < L; i++)
-			dhat[i] += Wm[j] * D[i * N + j];
+			dhat[i] += Wm[j] * D[j * L + i];
 }
 
 static void create_state_estimation_error_covariance_matrix(float Sd[], float Wc[], float D[],
 							    float dhat[], float Re[], uint8_t L)
 {
-	/* Create the size N, M and K */
-	uint8_t N = 2 * L + 1;
+	/* Create the size M and K */
 	uint8_t M = 2 * L + L;
 	uint8_t K = 2 * L;
 
@@ -105,24 +99,22 @@ static void create_state_estimation_error_covariance_matrix(float Sd[], float Wc
 	float weight1 = sqrtf(fabsf(Wc[1]));
 
 	/* Create [Q, R_] = qr(A') */
-	float AT[L * M];
+	float AT[M * L];
 	float Q[M * M];
 	float R[M * L];
 
+	/* A' has one sigma point per row like D, so it is filled without a transpose */
 	for (uint8_t j = 0; j < K; j++) {
 		for (uint8_t i = 0; i < L; i++) {
-			AT[i * M + j] = weight1 * (D[i * N + j + 1] - dhat[i]);
+			AT[j * L + i] = weight1 * (D[(j + 1) * L + i] - dhat[i]);
 		}
 	}
 	for (uint8_t j = K; j < M; j++) {
 		for (uint8_t i = 0; i < L; i++) {
-			AT[i * M + j] = sqrtf(Re[i * L + j - K]);
+			AT[j * L + i] = sqrtf(Re[i * L + j - K]);
 		}
 	}
 
-	/* We need to do transpose on A according to the SR-UKF paper */
-	tran(AT, AT, L, M);
-
 	/* Solve [Q, R] = qr(A') but we only need R matrix */
 	qr(AT, Q, R, M, L, true);
 
@@ -133,7 +125,7 @@ static void create_state_estimation_error_covariance_matrix(float Sd[], float Wc
 	float b[L];
 
 	for (uint8_t i = 0; i < L; i++)
-		b[i] = D[i * N] - dhat[i];
+		b[i] = D[i] - dhat[i];
 
 	bool rank_one_update = Wc[0] < 0.0f ? false : true;
 
@@ -143,34 +135,29 @@ static void create_state_estimation_error_covariance_matrix(float Sd[], float Wc
 static void create_state_cross_covariance_matrix(float Pwd[], float Wc[], float W[], float D[],
 						 float what[], float dhat[], uint8_t L)
 {
-	/* Create the size N and K */
+	/* Create the size N */
 	uint8_t N = 2 * L + 1;
-	uint8_t K = 2 * L;
 
 	/* clear P */
-	memset(Pwd, 0, K * sizeof(float));
+	memset(Pwd, 0, L * L * sizeof(float));
 
-	/* Subtract the matrices */
+	/* Subtract the means */
 	for (uint8_t j = 0; j < N; j++) {
 		for (uint8_t i = 0; i < L; i++) {
-			W[i * N + j] -= what[i];
-			D[i * N + j] -= dhat[i];
+			W[j * L + i] -= what[i];
+			D[j * L + i] -= dhat[i];
 		}
 	}
 
-	/* Create diagonal matrix */
-	float diagonal_W[N * N];
-
-	memset(diagonal_W, 0, N * N * sizeof(float));
-	for (uint8_t i = 0; i < N; i++)
-		diagonal_W[i * N + i] = Wc[i];
-
-	/* Do Pwd = W*diagonal_W*D' */
-	tran(D, D, L, N);
-	float diagonal_WD[N * L];
+	/* Do Pwd = W'*diag(Wc)*D with one sigma point per row of W and D */
+	for (uint8_t j = 0; j < N; j++) {
+		for (uint8_t i = 0; i < L; i++) {
+			const float ww = Wc[j] * W[j * L + i];
 
-	mul(diagonal_WD, diagonal_W, D, N, N, N, L);
-	mul(Pwd, W, diagonal_WD, L, N, N, L);
+			for (uint8_t k = 0; k < L; k++)
+				Pwd[i * L + k] += ww * D[j * L + k];
+		}
+	}
 }
 
 // Sw, what, dhat, d, Sd, Pwd, L
@@ -244,6 +231,15 @@ static void create_weights(float Wc[], float Wm[], float alpha, float beta, floa
 
 int sqr_ukf_id(float d[], float what[], float Re[], float x[], void (*G)(float[], float[], float[]),
 	       float lambda_rls, float Sw[], float alpha, float beta, uint8_t L)
+{
+	struct point_model pm = { .G = G, .x = x };
+
+	return sqr_ukf_id_batch(d, what, Re, x, model_each, &pm, lambda_rls, Sw, alpha, beta, L);
+}
+
+int sqr_ukf_id_batch(float d[], float what[], float Re[], const float *const x,
+		     sqr_ukf_id_model_t G, void *ctx, float lambda_rls, float Sw[], float alpha,
+		     float beta, uint8_t L)
 {
 	if (L == 0) {
 		return -EINVAL;
@@ -265,16 +261,16 @@ int sqr_ukf_id(float d[], float what[], float Re[], float x[], void (*G)(float[]
 	scale_Sw_with_lambda_rls_factor(Sw, lambda_rls, L);
 
 	/* Predict: Create sigma point matrix for G function  */
-	float W[L * N];
+	float W[N * L];
 
 	create_sigma_point_matrix(W, what, Sw, alpha, kappa, L);
 
 	/* Predict: Compute the model G */
-	float D[L * N];
+	float D[N * L];
 
 	memset(D, 0, sizeof(D));
 
-	compute_transistion_function(D, W, x, G, L);
+	G(D, x, W, N, L, ctx);
 
 	/* Predict: Multiply sigma points to weights for dhat */
 	float dhat[L];
@@ -0,0 +1,178 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <complex>
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/dynamics.h"
+};
+
+typedef std::complex<double> cplx;
+
+// G = C*(s*I - A)^-1*B by Gaussian elimination on the full matrix
+static void freqresp_direct(cplx *G, const float *A, const float *B, const float *C, int n,
+			    int m, int p, cplx s)
+{
+	cplx M[n * n], X[n * m];
+
+	for (int i = 0; i < n; i++) {
+		for (int j = 0; j < n; j++)
+			M[i * n + j] = (i == j ? s : 0.0) - (double)A[i * n + j];
+		for (int j = 0; j < m; j++)
+			X[i * m + j] = B[i * m + j];
+	}
+	for (int k = 0; k < n; k++) {
+		int q = k;
+
+		for (int i = k + 1; i < n; i++)
+			if (std::abs(M[i * n + k]) > std::abs(M[q * n + k]))
+				q = i;
+		for (int j = 0; j < n; j++)
+			std::swap(M[k * n + j], M[q * n + j]);
+		for (int j = 0; j < m; j++)
+			std::swap(X[k * m + j], X[q * m + j]);
+		for (int i = k + 1; i < n; i++) {
+			const cplx f = M[i * n + k] / M[k * n + k];
+
+			for (int j = k; j < n; j++)
+				M[i * n + j] -= f * M[k * n + j];
+			for (int j = 0; j < m; j++)
+				X[i * m + j] -= f * X[k * m + j];
+		}
+	}
+	for (int i = n - 1; i >= 0; i--)
+		for (int j = 0; j < m; j++) {
+			for (int k = i + 1; k < n; k++)
+				X[i * m + j] -= M[i * n + k] * X[k * m + j];
+			X[i * m + j] /= M[i * n + i];
+		}
+	for (int i = 0; i < p; i++)
+		for (int j = 0; j < m; j++) {
+			G[i * m + j] = 0.0;
+			for (int k = 0; k < n; k++)
+				G[i * m + j] += (double)C[i * n + k] * X[k * m + j];
+		}
+}
+
+TEST(Main, FreqrespSiso)
+{
+	// G(s) = 1 / (s^2 + 3s + 2)
+	const float A[2 * 2] = { 0, 1, -2, -3 };
+	const float B[2 * 1] = { 0, 1 };
+	const float C[1 * 2] = { 1, 0 };
+	const float w[4] = { 0.0f, 0.5f, 1.0f, 10.0f };
+	float storage[FREQRESP_STORAGE_SIZE(2, 1, 1)];
+	struct freqresp plan;
+	float mag[4], phase[4];
+
+	ASSERT_EQ(freqresp_init(&plan, A, B, C, 2, 1, 1, storage), 0);
+	freqresp(&plan, mag, phase, w, 4, 0.0f);
+	for (int k = 0; k < 4; k++) {
+		const cplx G = 1.0 / cplx(2.0 - (double)w[k] * w[k], 3.0 * w[k]);
+
+		EXPECT_NEAR(std::abs(G), mag[k], 1e-5);
+		EXPECT_NEAR(std::arg(G), phase[k], 1e-5);
+	}
+}
+
+TEST(Main, FreqrespMimo)
+{
+	// clang-format off
+	const float A[4 * 4] = {
+		-1.0f,  0.5f,  0.2f, -0.3f,
+		 0.4f, -2.0f,  0.1f,  0.6f,
+		-0.7f,  0.3f, -0.5f,  1.2f,
+		 0.2f, -0.9f, -1.1f, -0.8f
+	};
+	const float B[4 * 2] = {
+		1.0f,  0.0f,
+		0.5f, -1.0f,
+		0.0f,  2.0f,
+		-0.3f, 0.4f
+	};
+	const float C[3 * 4] = {
+		1.0f, 0.0f, 0.0f,  0.5f,
+		0.0f, 1.0f, -1.0f, 0.0f,
+		0.2f, 0.3f, 0.4f,  0.5f
+	};
+	// clang-format on
+	const uint16_t count = 50;
+	float storage[FREQRESP_STORAGE_SIZE(4, 2, 3)];
+	struct freqresp plan;
+	float w[count], mag[count * 3 * 2], phase[count * 3 * 2];
+
+	for (uint16_t k = 0; k < count; k++)
+		w[k] = powf(10.0f, -2.0f + 4.0f * k / (count - 1));
+
+	ASSERT_EQ(freqresp_init(&plan, A, B, C, 4, 2, 3, storage), 0);
+	freqresp(&plan, mag, phase, w, count, 0.0f);
+	for (uint16_t k = 0; k < count; k++) {
+		cplx G[3 * 2];
+
+		freqresp_direct(G, A, B, C, 4, 2, 3, cplx(0.0, w[k]));
+		for (int i = 0; i < 3 * 2; i++) {
+			EXPECT_NEAR(std::abs(G[i]), mag[k * 6 + i], 1e-4 * (1.0 + std::abs(G[i])));
+			if (std::abs(G[i]) > 1e-3)
+				EXPECT_NEAR(std::arg(G[i]), phase[k * 6 + i], 1e-3);
+		}
+	}
+
+	// Evaluating two halves separately gives the same result
+	float mag2[count * 3 * 2], phase2[count * 3 * 2];
+
+	freqresp(&plan, mag2, phase2, w, count / 2, 0.0f);
+	freqresp(&plan, mag2 + (count / 2) * 6, phase2 + (count / 2) * 6, w + count / 2,
+		 count - count / 2, 0.0f);
+	for (uint16_t i = 0; i < count * 6; i++) {
+		EXPECT_EQ(mag[i], mag2[i]);
+		EXPECT_EQ(phase[i], phase2[i]);
+	}
+}
+
+TEST(Main, FreqrespDiscrete)
+{
+	// G(z) = 1 / (z - 0.5)
+	const float A[1] = { 0.5f };
+	const float B[1] = { 1.0f };
+	const float C[1] = { 1.0f };
+	const float w[3] = { 0.0f, 1.0f, 3.0f };
+	const float h = 0.5f;
+	float storage[FREQRESP_STORAGE_SIZE(1, 1, 1)];
+	struct freqresp plan;
+	float mag[3], phase[3];
+
+	ASSERT_EQ(freqresp_init(&plan, A, B, C, 1, 1, 1, storage), 0);
+	freqresp(&plan, mag, phase, w, 3, h);
+	for (int k = 0; k < 3; k++) {
+		const cplx G = 1.0 / (std::exp(cplx(0.0, (double)w[k] * h)) - 0.5);
+
+		EXPECT_NEAR(std::abs(G), mag[k], 1e-5);
+		EXPECT_NEAR(std::arg(G), phase[k], 1e-5);
+	}
+}
+
+TEST(Main, FreqrespPole)
+{
+	// Integrator has a pole at s = 0
+	const float A[1] = { 0.0f };
+	const float B[1] = { 1.0f };
+	const float C[1] = { 1.0f };
+	const float w[2] = { 0.0f, 2.0f };
+	float storage[FREQRESP_STORAGE_SIZE(1, 1, 1)];
+	struct freqresp plan;
+	float mag[2], phase[2];
+
+	EXPECT_EQ(freqresp_init(&plan, A, B, C, 0, 1, 1, storage), -EINVAL);
+	ASSERT_EQ(freqresp_init(&plan, A, B, C, 1, 1, 1, storage), 0);
+	freqresp(&plan, mag, phase, w, 2, 0.0f);
+	EXPECT_TRUE(isinf(mag[0]));
+	EXPECT_NEAR(0.5f, mag[1], 1e-6);
+	EXPECT_NEAR(-M_PI / 2, phase[1], 1e-6);
+}
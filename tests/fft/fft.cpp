@@ -0,0 +1,210 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/fft.h"
+};
+
+// Direct evaluation of the DFT for comparison
+static void dft(float *X, const float *const x, uint32_t n)
+{
+	for (uint32_t k = 0; k < n; k++) {
+		float re = 0.0f, im = 0.0f;
+
+		for (uint32_t j = 0; j < n; j++) {
+			const float angle = -2.0f * (float)M_PI * (float)((j * k) % n) / (float)n;
+
+			re += x[2 * j] * cosf(angle) - x[2 * j + 1] * sinf(angle);
+			im += x[2 * j] * sinf(angle) + x[2 * j + 1] * cosf(angle);
+		}
+		X[2 * k] = re;
+		X[2 * k + 1] = im;
+	}
+}
+
+TEST(Main, FftForwardInverse)
+{
+	const uint32_t n = 16;
+	float storage[FFT_PLAN_STORAGE_SIZE(16)];
+	struct fft_plan plan;
+	float x[2 * 16], X[2 * 16], X_exp[2 * 16];
+
+	ASSERT_EQ(fft_plan_init(&plan, n, storage), 0);
+	for (uint32_t k = 0; k < n; k++) {
+		x[2 * k] = sinf(0.3f * k) + 0.1f * k;
+		x[2 * k + 1] = cosf(1.7f * k);
+	}
+	memcpy(X, x, sizeof(x));
+	fft_forward(&plan, X);
+	dft(X_exp, x, n);
+	for (uint32_t k = 0; k < 2 * n; k++)
+		EXPECT_NEAR(X_exp[k], X[k], 1e-4);
+
+	fft_inverse(&plan, X);
+	for (uint32_t k = 0; k < 2 * n; k++)
+		EXPECT_NEAR(x[k], X[k], 1e-5);
+}
+
+// Compare against the DFT and back for one length
+static void check_length(uint32_t n)
+{
+	float storage[FFT_PLAN_STORAGE_SIZE(n)];
+	struct fft_plan plan;
+	float x[2 * n], X[2 * n], X_exp[2 * n];
+
+	ASSERT_LE(fft_plan_storage_size(n), FFT_PLAN_STORAGE_SIZE(n));
+	ASSERT_EQ(fft_plan_init(&plan, n, storage), 0);
+	for (uint32_t k = 0; k < n; k++) {
+		x[2 * k] = sinf(0.3f * k) + 0.1f * k;
+		x[2 * k + 1] = cosf(1.7f * k);
+	}
+	memcpy(X, x, sizeof(x));
+	fft_forward(&plan, X);
+	dft(X_exp, x, n);
+	for (uint32_t k = 0; k < 2 * n; k++)
+		EXPECT_NEAR(X_exp[k], X[k], 1e-3) << "n = " << n << ", k = " << k;
+
+	fft_inverse(&plan, X);
+	for (uint32_t k = 0; k < 2 * n; k++)
+		EXPECT_NEAR(x[k], X[k], 1e-4) << "n = " << n << ", k = " << k;
+}
+
+TEST(Main, FftMixedRadix)
+{
+	const uint32_t lengths[] = { 1, 2, 3, 5, 6, 12, 15, 45, 60, 64, 77, 169 };
+
+	for (uint32_t n : lengths)
+		check_length(n);
+}
+
+TEST(Main, FftBluestein)
+{
+	// Prime factors above FFT_MAX_RADIX
+	const uint32_t lengths[] = { 17, 34, 97, 101 };
+
+	for (uint32_t n : lengths)
+		check_length(n);
+}
+
+TEST(Main, FftReal)
+{
+	const uint32_t lengths[] = { 2, 8, 12, 15, 17, 30, 34 };
+
+	for (uint32_t n : lengths) {
+		float storage[FFT_REAL_PLAN_STORAGE_SIZE(n)];
+		struct fft_real_plan plan;
+		float x[n], z[2 * n], Z[2 * n];
+		float X[2 * (n / 2 + 1)], y[2 * (n / 2 + 1)];
+
+		ASSERT_LE(fft_real_plan_storage_size(n), FFT_REAL_PLAN_STORAGE_SIZE(n));
+		ASSERT_EQ(fft_real_plan_init(&plan, n, storage), 0);
+		for (uint32_t k = 0; k < n; k++) {
+			x[k] = sinf(0.7f * k) - 0.05f * k * k;
+			z[2 * k] = x[k];
+			z[2 * k + 1] = 0.0f;
+		}
+		dft(Z, z, n);
+		fft_forward_real(&plan, X, x);
+		for (uint32_t k = 0; k <= n / 2; k++) {
+			EXPECT_NEAR(Z[2 * k], X[2 * k], 1e-3) << "n = " << n << ", k = " << k;
+			EXPECT_NEAR(Z[2 * k + 1], X[2 * k + 1], 1e-3) << "n = " << n << ", k = " << k;
+		}
+
+		// In place round trip
+		memcpy(y, x, n * sizeof(float));
+		fft_forward_real(&plan, y, y);
+		fft_inverse_real(&plan, y, y);
+		for (uint32_t k = 0; k < n; k++)
+			EXPECT_NEAR(x[k], y[k], 1e-4) << "n = " << n << ", k = " << k;
+	}
+}
+
+TEST(Main, FftBatch)
+{
+	const uint32_t n = 12;
+	const uint32_t stride = 2 * n + 2;
+	float storage[FFT_PLAN_STORAGE_SIZE(12)];
+	float real_storage[FFT_REAL_PLAN_STORAGE_SIZE(12)];
+	struct fft_plan plan;
+	struct fft_real_plan real;
+	float x[3 * stride], X[3 * stride];
+	float r[3 * n], R[3 * (n + 2)];
+
+	ASSERT_EQ(fft_plan_init(&plan, n, storage), 0);
+	ASSERT_EQ(fft_real_plan_init(&real, n, real_storage), 0);
+	for (uint32_t k = 0; k < 3 * stride; k++)
+		x[k] = cosf(0.37f * k);
+	for (uint32_t k = 0; k < 3 * n; k++)
+		r[k] = sinf(0.21f * k);
+
+	memcpy(X, x, sizeof(x));
+	fft_forward_batch(&plan, X, 3, stride);
+	for (uint32_t c = 0; c < 3; c++) {
+		float Y[2 * n];
+
+		dft(Y, &x[c * stride], n);
+		for (uint32_t k = 0; k < 2 * n; k++)
+			EXPECT_NEAR(Y[k], X[c * stride + k], 1e-4);
+		// Padding between signals is untouched
+		EXPECT_EQ(x[c * stride + 2 * n], X[c * stride + 2 * n]);
+	}
+	fft_inverse_batch(&plan, X, 3, stride);
+	for (uint32_t k = 0; k < 3 * stride; k++)
+		EXPECT_NEAR(x[k], X[k], 1e-5);
+
+	fft_forward_real_batch(&real, R, r, 3, n + 2, n);
+	for (uint32_t c = 0; c < 3; c++) {
+		float Y[n + 2];
+
+		fft_forward_real(&real, Y, &r[c * n]);
+		for (uint32_t k = 0; k < n + 2; k++)
+			EXPECT_EQ(Y[k], R[c * (n + 2) + k]);
+	}
+}
+
+TEST(Main, FftConvolution)
+{
+	// [1 2 3] * [1 -1] = [1 1 1 -3]
+	float storage[FFT_PLAN_STORAGE_SIZE(4)];
+	struct fft_plan plan;
+	float a[2 * 4] = { 1, 0, 2, 0, 3, 0, 0, 0 };
+	float b[2 * 4] = { 1, 0, -1, 0, 0, 0, 0, 0 };
+	const float c_exp[4] = { 1, 1, 1, -3 };
+
+	EXPECT_EQ(fft_size(3 + 2 - 1), 4u);
+	ASSERT_EQ(fft_plan_init(&plan, 4, storage), 0);
+	fft_forward(&plan, a);
+	fft_forward(&plan, b);
+	for (uint32_t k = 0; k < 4; k++) {
+		const float re = a[2 * k] * b[2 * k] - a[2 * k + 1] * b[2 * k + 1];
+		const float im = a[2 * k] * b[2 * k + 1] + a[2 * k + 1] * b[2 * k];
+
+		a[2 * k] = re;
+		a[2 * k + 1] = im;
+	}
+	fft_inverse(&plan, a);
+	for (uint32_t k = 0; k < 4; k++) {
+		EXPECT_NEAR(c_exp[k], a[2 * k], 1e-5);
+		EXPECT_NEAR(0.0f, a[2 * k + 1], 1e-5);
+	}
+}
+
+TEST(Main, FftInvalid)
+{
+	float storage[FFT_PLAN_STORAGE_SIZE(8)];
+	struct fft_plan plan;
+	struct fft_real_plan real;
+
+	EXPECT_EQ(fft_plan_init(&plan, 0, storage), -EINVAL);
+	EXPECT_EQ(fft_real_plan_init(&real, 0, storage), -EINVAL);
+	EXPECT_EQ(fft_size(1), 1u);
+	EXPECT_EQ(fft_size(9), 16u);
+}
@@ -0,0 +1,203 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/filter.h"
+};
+
+// Position and velocity with sample time 0.1 and a force input
+static void linear(float *dX, const float *const X, const float *const u, uint16_t count,
+		   uint8_t L, void *ctx)
+{
+	int *calls = (int *)ctx;
+
+	if (calls)
+		(*calls)++;
+	for (uint16_t j = 0; j < count; j++) {
+		dX[j * L] = X[j * L] + 0.1f * X[j * L + 1];
+		dX[j * L + 1] = 0.95f * X[j * L + 1] + 0.1f * u[0];
+	}
+}
+
+// Both states are measured
+static void identity(float *Y, const float *const X, uint16_t count, uint8_t L, uint8_t M,
+		     void *ctx)
+{
+	(void)ctx;
+	for (uint16_t j = 0; j < count; j++)
+		for (uint8_t i = 0; i < M; i++)
+			Y[j * M + i] = X[j * L + i];
+}
+
+TEST(Main, EkfLinear)
+{
+	const float Q[4] = { 0.01f, 0.0f, 0.0f, 0.02f };
+	const float R[2] = { 0.25f, 0.5f };
+	float storage[EKF_STORAGE_SIZE(2, 2)];
+	struct ekf f;
+	int calls = 0;
+
+	ASSERT_EQ(ekf_init(&f, linear, &calls, identity, NULL, 2, 2, 1, Q, R, storage), 0);
+
+	const float x0[2] = { 1.0f, -1.0f };
+	const float P0[4] = { 4.0f, 1.0f, 1.0f, 1.25f };
+
+	ekf_reset(&f, x0, P0);
+
+	// Reference Kalman filter in double with a batch update
+	double x[2] = { 1.0, -1.0 };
+	double P[2][2] = { { 4.0, 1.0 }, { 1.0, 1.25 } };
+	const double A[2][2] = { { 1.0, 0.1 }, { 0.0, 0.95 } };
+
+	for (int t = 0; t < 100; t++) {
+		const float u[1] = { sinf(0.05f * (float)t) };
+		const float y[2] = { 2.0f * cosf(0.07f * (float)t), 0.3f * sinf(0.02f * (float)t) };
+
+		ekf_predict(&f, u);
+		ASSERT_EQ(ekf_update(&f, y), 0);
+
+		const double xp[2] = { x[0] + 0.1 * x[1], 0.95 * x[1] + 0.1 * u[0] };
+		double AP[2][2], Pp[2][2];
+
+		for (int i = 0; i < 2; i++)
+			for (int j = 0; j < 2; j++)
+				AP[i][j] = A[i][0] * P[0][j] + A[i][1] * P[1][j];
+		for (int i = 0; i < 2; i++)
+			for (int j = 0; j < 2; j++)
+				Pp[i][j] = AP[i][0] * A[j][0] + AP[i][1] * A[j][1] + Q[i * 2 + j];
+
+		// K = Pp * inv(Pp + R)
+		const double S[2][2] = { { Pp[0][0] + R[0], Pp[0][1] }, { Pp[1][0], Pp[1][1] + R[1] } };
+		const double det = S[0][0] * S[1][1] - S[0][1] * S[1][0];
+		const double Si[2][2] = { { S[1][1] / det, -S[0][1] / det },
+					  { -S[1][0] / det, S[0][0] / det } };
+		double K[2][2];
+
+		for (int i = 0; i < 2; i++)
+			for (int j = 0; j < 2; j++)
+				K[i][j] = Pp[i][0] * Si[0][j] + Pp[i][1] * Si[1][j];
+
+		const double e[2] = { y[0] - xp[0], y[1] - xp[1] };
+
+		for (int i = 0; i < 2; i++)
+			x[i] = xp[i] + K[i][0] * e[0] + K[i][1] * e[1];
+		for (int i = 0; i < 2; i++)
+			for (int j = 0; j < 2; j++)
+				P[i][j] = Pp[i][j] - K[i][0] * Pp[0][j] - K[i][1] * Pp[1][j];
+
+		for (int i = 0; i < 2; i++) {
+			ASSERT_NEAR(f.x[i], x[i], 1e-3) << "step " << t;
+			for (int j = 0; j < 2; j++)
+				ASSERT_NEAR(f.P[i * 2 + j], P[i][j], 1e-3) << "step " << t;
+		}
+	}
+
+	// Model and finite differences come from one call per prediction
+	EXPECT_EQ(calls, 100);
+}
+
+// Range measurement y = x^2 of a constant
+static void constant(float *dX, const float *const X, const float *const u, uint16_t count,
+		     uint8_t L, void *ctx)
+{
+	(void)u;
+	(void)ctx;
+	memcpy(dX, X, count * L * sizeof(float));
+}
+
+static void square(float *Y, const float *const X, uint16_t count, uint8_t L, uint8_t M,
+		   void *ctx)
+{
+	(void)ctx;
+	for (uint16_t j = 0; j < count; j++)
+		Y[j * M] = X[j * L] * X[j * L];
+}
+
+static void constant_jacobian(float *J, const float *const x, const float *const u, void *ctx)
+{
+	(void)x;
+	(void)u;
+	(void)ctx;
+	J[0] = 1.0f;
+}
+
+static void square_jacobian(float *J, const float *const x, const float *const u, void *ctx)
+{
+	(void)u;
+	(void)ctx;
+	J[0] = 2.0f * x[0];
+}
+
+static float estimate(uint8_t iterations, bool analytic)
+{
+	const float Q[1] = { 0.0f };
+	const float R[1] = { 1e-4f };
+	float storage[EKF_STORAGE_SIZE(1, 1)];
+	struct ekf f;
+	const float x0[1] = { 1.0f };
+	const float P0[1] = { 1.0f };
+	const float u[1] = { 0.0f };
+	const float y[1] = { 4.0f };
+
+	EXPECT_EQ(ekf_init(&f, constant, NULL, square, NULL, 1, 1, iterations, Q, R, storage), 0);
+	if (analytic)
+		ekf_set_jacobians(&f, constant_jacobian, square_jacobian);
+	ekf_reset(&f, x0, P0);
+	ekf_predict(&f, u);
+	EXPECT_EQ(ekf_update(&f, y), 0);
+	return f.x[0];
+}
+
+TEST(Main, EkfIterated)
+{
+	// One linearization at x = 1 overshoots the true value 2
+	EXPECT_NEAR(estimate(1, true), 2.5f, 1e-3f);
+	EXPECT_NEAR(estimate(1, false), 2.5f, 1e-2f);
+
+	// Relinearizing converges to the maximum a posteriori estimate
+	EXPECT_NEAR(estimate(10, true), 2.0f, 1e-3f);
+	EXPECT_NEAR(estimate(10, false), 2.0f, 1e-2f);
+}
+
+TEST(Main, EkfInvalid)
+{
+	const float Q[1] = { 0.0f };
+	const float R[1] = { 1.0f };
+	float storage[EKF_STORAGE_SIZE(1, 1)];
+	struct ekf f;
+
+	EXPECT_EQ(ekf_init(&f, constant, NULL, square, NULL, 0, 1, 1, Q, R, storage), -EINVAL);
+	EXPECT_EQ(ekf_init(&f, constant, NULL, square, NULL, 1, 1, 0, Q, R, storage), -EINVAL);
+	EXPECT_EQ(ekf_init(&f, constant, NULL, NULL, NULL, 1, 1, 1, Q, R, storage), -EINVAL);
+}
+
+TEST(Main, EkfUpdateFailure)
+{
+	const float Q[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	// Second measurement has a negative variance and no state uncertainty to cover it
+	const float R[2] = { 0.25f, -1.0f };
+	float storage[EKF_STORAGE_SIZE(2, 2)];
+	struct ekf f;
+
+	ASSERT_EQ(ekf_init(&f, linear, NULL, identity, NULL, 2, 2, 1, Q, R, storage), 0);
+
+	const float x0[2] = { 1.0f, 0.0f };
+	const float P0[4] = { 1.0f, 0.0f, 0.0f, 0.1f };
+	const float y[2] = { 3.0f, 0.0f };
+
+	ekf_reset(&f, x0, P0);
+	EXPECT_EQ(ekf_update(&f, y), -ENOTSUP);
+	for (int i = 0; i < 2; i++)
+		EXPECT_EQ(f.x[i], x0[i]);
+	for (int i = 0; i < 4; i++)
+		EXPECT_EQ(f.P[i], P0[i]);
+}
@@ -0,0 +1,107 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <vector>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/filter.h"
+};
+
+// Direct convolution of channel c of interleaved x
+static float reference(const std::vector<float> &h, const std::vector<float> &x, int channels,
+		       int c, int t)
+{
+	double sum = 0.0;
+
+	for (int k = 0; k < (int)h.size() && k <= t; k++)
+		sum += (double)h[k] * x[(t - k) * channels + c];
+	return (float)sum;
+}
+
+// Filter in chunks of varying size and compare with direct convolution
+static void check(uint32_t taps, uint16_t channels, uint32_t block, int frames)
+{
+	std::vector<float> h(taps), x(frames * channels), y(frames * channels);
+
+	for (uint32_t k = 0; k < taps; k++)
+		h[k] = expf(-3.0f * (float)k / (float)taps) * cosf(0.37f * (float)k);
+	for (int i = 0; i < frames * channels; i++)
+		x[i] = sinf(0.11f * (float)i) + (float)((i * 37) % 11) / 11.0f - 0.5f;
+
+	std::vector<float> storage(fir_storage_size(taps, channels, block));
+	struct fir f;
+
+	ASSERT_EQ(fir_init(&f, h.data(), taps, channels, block, storage.data()), 0);
+
+	int t = 0, chunk = 1;
+
+	while (t < frames) {
+		const int n = std::min(chunk, frames - t);
+
+		fir_process(&f, &y[t * channels], &x[t * channels], n);
+		t += n;
+		chunk = chunk * 3 % 97 + 1;
+	}
+
+	for (int i = 0; i < frames; i++)
+		for (int c = 0; c < channels; c++)
+			ASSERT_NEAR(y[i * channels + c], reference(h, x, channels, c, i), 1e-4f)
+				<< "taps " << taps << " block " << block << " frame " << i;
+}
+
+TEST(Main, FirDirect)
+{
+	check(1, 1, 0, 50);
+	check(17, 2, 0, 300);
+	check(40, 3, 64, 300);
+}
+
+TEST(Main, FirPartitioned)
+{
+	check(17, 1, 16, 200);
+	check(100, 1, 16, 700);
+	check(1000, 2, fir_block_size(1000), 3000);
+	check(300, 3, 24, 1000);
+}
+
+TEST(Main, FirInPlace)
+{
+	const float h[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+	float storage[64];
+	struct fir f;
+
+	ASSERT_LE(fir_storage_size(4, 1, 0), 64u);
+	ASSERT_EQ(fir_init(&f, h, 4, 1, 0, storage), 0);
+
+	float x[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+	const float expected[6] = { 1.0f, 2.0f, 3.0f, 4.0f, 0.0f, 1.0f };
+
+	fir_process(&f, x, x, 6);
+	for (int i = 0; i < 6; i++)
+		EXPECT_FLOAT_EQ(x[i], expected[i]);
+
+	fir_reset(&f);
+	float one = 5.0f;
+
+	fir_process(&f, &one, &one, 1);
+	EXPECT_FLOAT_EQ(one, 5.0f);
+}
+
+TEST(Main, FirInvalid)
+{
+	float h[1] = { 1.0f };
+	float storage[8];
+	struct fir f;
+
+	EXPECT_EQ(fir_init(&f, h, 0, 1, 0, storage), -EINVAL);
+	EXPECT_EQ(fir_init(&f, h, 1, 0, 0, storage), -EINVAL);
+	EXPECT_EQ(fir_block_size(FIR_DIRECT_TAPS), 0u);
+	EXPECT_EQ(fir_block_size(1000), 64u);
+}
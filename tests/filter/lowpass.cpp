@@ -0,0 +1,91 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/filter.h"
+};
+
+TEST(Main, Lowpass)
+{
+	struct lowpass lp;
+
+	ASSERT_EQ(lowpass_init(&lp, 0.0f, 1000.0f), -EINVAL);
+	ASSERT_EQ(lowpass_init(&lp, 10.0f, 1000.0f), 0);
+
+	// Step response of the discretized pole is 1 - exp(-2*pi*fc*t)
+	float x[100], y[100];
+
+	for (int i = 0; i < 100; i++)
+		x[i] = 1.0f;
+	lowpass_process_block(&lp, y, x, 100);
+	for (int i = 0; i < 100; i++)
+		EXPECT_NEAR(y[i], 1.0f - expf(-2.0f * (float)M_PI * 10.0f * (float)(i + 1) / 1000.0f),
+			    1e-5f);
+
+	lowpass_reset(&lp, 2.0f);
+	EXPECT_FLOAT_EQ(lowpass_step(&lp, 2.0f), 2.0f);
+}
+
+// Amplitude of a sine after the filter has settled, from the power over whole periods
+static float gain(struct biquad *bq, float f, float fs)
+{
+	float power = 0.0f;
+
+	biquad_reset(bq, 0.0f);
+	for (int i = 0; i < 4000; i++) {
+		const float y = biquad_step(bq, sinf(2.0f * (float)M_PI * f * (float)i / fs));
+
+		if (i >= 3000)
+			power += y * y;
+	}
+	return sqrtf(2.0f * power / 1000.0f);
+}
+
+TEST(Main, BiquadLowpass)
+{
+	struct biquad bq;
+
+	ASSERT_EQ(biquad_lowpass_init(&bq, 600.0f, 0.7071f, 1000.0f), -EINVAL);
+	ASSERT_EQ(biquad_lowpass_init(&bq, 100.0f, 0.7071f, 1000.0f), 0);
+
+	EXPECT_NEAR(gain(&bq, 5.0f, 1000.0f), 1.0f, 1e-2f);
+	EXPECT_NEAR(gain(&bq, 100.0f, 1000.0f), 0.7071f, 1e-2f);
+	EXPECT_LT(gain(&bq, 400.0f, 1000.0f), 0.05f);
+
+	// Reset to a constant input starts without transient
+	biquad_reset(&bq, 3.0f);
+	for (int i = 0; i < 10; i++)
+		EXPECT_NEAR(biquad_step(&bq, 3.0f), 3.0f, 1e-5f);
+}
+
+TEST(Main, BiquadNotch)
+{
+	struct biquad bq;
+
+	ASSERT_EQ(biquad_notch_init(&bq, 50.0f, 0.0f, 1000.0f), -EINVAL);
+	ASSERT_EQ(biquad_notch_init(&bq, 50.0f, 5.0f, 1000.0f), 0);
+
+	EXPECT_LT(gain(&bq, 50.0f, 1000.0f), 1e-2f);
+	EXPECT_NEAR(gain(&bq, 200.0f, 1000.0f), 1.0f, 1e-2f);
+
+	// Block processing in place matches single steps
+	float x[64], y[64];
+
+	biquad_reset(&bq, 0.0f);
+	for (int i = 0; i < 64; i++) {
+		x[i] = cosf(0.3f * (float)i);
+		y[i] = biquad_step(&bq, x[i]);
+	}
+	biquad_reset(&bq, 0.0f);
+	biquad_process_block(&bq, x, x, 64);
+	for (int i = 0; i < 64; i++)
+		EXPECT_FLOAT_EQ(x[i], y[i]);
+}
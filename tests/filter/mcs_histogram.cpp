@@ -0,0 +1,125 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/filter.h"
+};
+
+// Gain of a plant with a normally distributed parameter and a uniform offset
+static void plant(float *x, uint64_t sample, struct rng *rng, void *ctx)
+{
+	float k;
+
+	(void)sample;
+	(void)ctx;
+	rng_fill_normal(rng, &k, 1, 20.0f, 1.0f);
+	x[0] = k;
+	x[1] = rng_uniform(rng) * 4.0f - 6.0f;
+}
+
+TEST(Main, McsHistogramRun)
+{
+	const float low[2] = { 10.0f, -10.0f };
+	const float high[2] = { 30.0f, 0.0f };
+	uint32_t storage[MCS_HISTOGRAM_STORAGE_SIZE(2, 400)];
+	struct mcs_histogram h;
+
+	ASSERT_EQ(mcs_histogram_init(&h, 2, 400, low, high, storage), 0);
+	mcs_run(&h, plant, NULL, 99, 0, 20000);
+	EXPECT_EQ(mcs_histogram_total(&h, 0), 20000u);
+
+	// Normal distribution N(20, 1)
+	EXPECT_NEAR(20.0f, mcs_histogram_mode(&h, 0), 0.3f);
+	EXPECT_NEAR(20.0f, mcs_histogram_quantile(&h, 0, 0.5f), 0.05f);
+	EXPECT_NEAR(20.0f - 1.6449f, mcs_histogram_quantile(&h, 0, 0.05f), 0.1f);
+	EXPECT_NEAR(20.0f + 1.6449f, mcs_histogram_quantile(&h, 0, 0.95f), 0.1f);
+
+	float lower, upper;
+
+	mcs_histogram_quantile_bounds(&h, 0, 0.5f, 1.96f, &lower, &upper);
+	EXPECT_LT(lower, mcs_histogram_quantile(&h, 0, 0.5f));
+	EXPECT_GT(upper, mcs_histogram_quantile(&h, 0, 0.5f));
+	EXPECT_LT(upper - lower, 0.1f);
+
+	// Uniform distribution on [-6, -2)
+	EXPECT_NEAR(-4.0f, mcs_histogram_quantile(&h, 1, 0.5f), 0.1f);
+	EXPECT_NEAR(-5.0f, mcs_histogram_quantile(&h, 1, 0.25f), 0.1f);
+}
+
+TEST(Main, McsHistogramMerge)
+{
+	const float low[2] = { 10.0f, -10.0f };
+	const float high[2] = { 30.0f, 0.0f };
+	uint32_t s_all[MCS_HISTOGRAM_STORAGE_SIZE(2, 100)];
+	uint32_t s_a[MCS_HISTOGRAM_STORAGE_SIZE(2, 100)];
+	uint32_t s_b[MCS_HISTOGRAM_STORAGE_SIZE(2, 100)];
+	struct mcs_histogram all, a, b;
+
+	ASSERT_EQ(mcs_histogram_init(&all, 2, 100, low, high, s_all), 0);
+	ASSERT_EQ(mcs_histogram_init(&a, 2, 100, low, high, s_a), 0);
+	ASSERT_EQ(mcs_histogram_init(&b, 2, 100, low, high, s_b), 0);
+
+	// Two shards give exactly the counts of one run
+	mcs_run(&all, plant, NULL, 5, 0, 3000);
+	mcs_run(&b, plant, NULL, 5, 1234, 3000 - 1234);
+	mcs_run(&a, plant, NULL, 5, 0, 1234);
+	ASSERT_EQ(mcs_histogram_merge(&b, &a), 0);
+	for (uint32_t k = 0; k < MCS_HISTOGRAM_STORAGE_SIZE(2, 100); k++)
+		EXPECT_EQ(s_all[k], s_b[k]);
+
+	struct mcs_histogram other;
+	uint32_t s_other[MCS_HISTOGRAM_STORAGE_SIZE(2, 50)];
+
+	ASSERT_EQ(mcs_histogram_init(&other, 2, 50, low, high, s_other), 0);
+	EXPECT_EQ(mcs_histogram_merge(&all, &other), -EINVAL);
+}
+
+TEST(Main, McsHistogramRange)
+{
+	const float low[1] = { 0.0f };
+	const float high[1] = { 1.0f };
+	const float bad[1] = { 0.0f };
+	uint32_t storage[MCS_HISTOGRAM_STORAGE_SIZE(1, 10)];
+	struct mcs_histogram h;
+	const float x[5] = { -1.0f, 0.05f, 0.55f, 2.0f, NAN };
+
+	EXPECT_EQ(mcs_histogram_init(&h, 1, 10, low, bad, storage), -EINVAL);
+	ASSERT_EQ(mcs_histogram_init(&h, 1, 10, low, high, storage), 0);
+	EXPECT_TRUE(isnan(mcs_histogram_mode(&h, 0)));
+	EXPECT_TRUE(isnan(mcs_histogram_quantile(&h, 0, 0.5f)));
+
+	for (int i = 0; i < 5; i++)
+		mcs_histogram_collect(&h, &x[i]);
+	// NaN is not counted, out of range values are
+	EXPECT_EQ(mcs_histogram_total(&h, 0), 4u);
+	EXPECT_EQ(storage[0], 1u);
+	EXPECT_EQ(storage[11], 1u);
+	EXPECT_FLOAT_EQ(0.05f, mcs_histogram_mode(&h, 0));
+	EXPECT_FLOAT_EQ(0.0f, mcs_histogram_quantile(&h, 0, 0.1f));
+	EXPECT_FLOAT_EQ(1.0f, mcs_histogram_quantile(&h, 0, 0.9f));
+	EXPECT_FLOAT_EQ(0.6f, mcs_histogram_quantile(&h, 0, 0.75f));
+}
+
+TEST(Main, McsHistogramLargeCounts)
+{
+	const float low[1] = { 0.0f };
+	const float high[1] = { 2.0f };
+	uint32_t storage[MCS_HISTOGRAM_STORAGE_SIZE(1, 2)];
+	struct mcs_histogram h;
+
+	ASSERT_EQ(mcs_histogram_init(&h, 1, 2, low, high, storage), 0);
+
+	// Counts past 2^24 are not exact in float
+	storage[1] = 16777217;
+	storage[2] = 3;
+	EXPECT_FLOAT_EQ(2.0f, mcs_histogram_quantile(&h, 0, 1.0f));
+	EXPECT_FLOAT_EQ(1.0f, mcs_histogram_quantile(&h, 0, 16777217.0f / 16777220.0f));
+}
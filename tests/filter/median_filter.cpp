@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <algorithm>
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/filter.h"
+};
+
+TEST(Main, MedianFilter)
+{
+	float storage[MEDIAN_FILTER_STORAGE_SIZE(3)];
+	struct median_filter mf;
+
+	ASSERT_EQ(median_filter_init(&mf, storage, 0), -EINVAL);
+	ASSERT_EQ(median_filter_init(&mf, storage, 3), 0);
+
+	// Single outliers are removed completely
+	const float x[7] = { 1.0f, 100.0f, 2.0f, 3.0f, -50.0f, 4.0f, 5.0f };
+	const float expected[7] = { 1.0f, 50.5f, 2.0f, 3.0f, 2.0f, 3.0f, 4.0f };
+	float y[7];
+
+	median_filter_process_block(&mf, y, x, 7);
+	for (int i = 0; i < 7; i++)
+		EXPECT_FLOAT_EQ(y[i], expected[i]);
+}
+
+TEST(Main, MedianFilterReference)
+{
+	enum { N = 7, LEN = 500 };
+	float storage[MEDIAN_FILTER_STORAGE_SIZE(N)];
+	struct median_filter mf;
+	float x[LEN];
+
+	median_filter_init(&mf, storage, N);
+	for (int i = 0; i < LEN; i++)
+		x[i] = (float)((i * 7919) % 101) - 50.0f;
+
+	for (int i = 0; i < LEN; i++) {
+		const float y = median_filter_step(&mf, x[i]);
+
+		if (i >= N - 1) {
+			float window[N];
+
+			std::copy(x + i - N + 1, x + i + 1, window);
+			std::sort(window, window + N);
+			ASSERT_FLOAT_EQ(y, window[N / 2]);
+		}
+	}
+}
+
+TEST(Main, MedianFilterNaN)
+{
+	float storage[MEDIAN_FILTER_STORAGE_SIZE(3)];
+	struct median_filter mf;
+
+	median_filter_init(&mf, storage, 3);
+	EXPECT_TRUE(isnan(median_filter_step(&mf, NAN)));
+
+	// Dropped samples do not take a place in the window
+	const float x[8] = { 1.0f, NAN, 5.0f, 3.0f, NAN, 7.0f, 9.0f, 8.0f };
+	const float expected[8] = { 1.0f, 1.0f, 3.0f, 3.0f, 3.0f, 5.0f, 7.0f, 8.0f };
+
+	for (int i = 0; i < 8; i++)
+		EXPECT_FLOAT_EQ(median_filter_step(&mf, x[i]), expected[i]);
+}
@@ -0,0 +1,50 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/filter.h"
+};
+
+TEST(Main, MovingAverage)
+{
+	float buffer[3];
+	struct moving_average ma;
+
+	ASSERT_EQ(moving_average_init(&ma, buffer, 0), -EINVAL);
+	ASSERT_EQ(moving_average_init(&ma, buffer, 3), 0);
+
+	const float x[6] = { 3.0f, 6.0f, 9.0f, 0.0f, 3.0f, -3.0f };
+	const float expected[6] = { 3.0f, 4.5f, 6.0f, 5.0f, 4.0f, 0.0f };
+	float y[6];
+
+	moving_average_process_block(&ma, y, x, 6);
+	for (int i = 0; i < 6; i++)
+		EXPECT_FLOAT_EQ(y[i], expected[i]);
+
+	moving_average_reset(&ma);
+	EXPECT_FLOAT_EQ(moving_average_step(&ma, 7.0f), 7.0f);
+}
+
+TEST(Main, MovingAverageDrift)
+{
+	float buffer[16];
+	struct moving_average ma;
+	float y = 0.0f;
+
+	moving_average_init(&ma, buffer, 16);
+
+	// Large values followed by small ones would leave rounding residue in a plain running sum
+	for (int i = 0; i < 1000; i++)
+		moving_average_step(&ma, 1e6f + 0.1f * (float)i);
+	for (int i = 0; i < 1000; i++)
+		y = moving_average_step(&ma, 0.001f);
+	EXPECT_NEAR(y, 0.001f, 1e-7f);
+}
@@ -0,0 +1,159 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <complex>
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/filter.h"
+};
+
+// |H(exp(j*2*pi*f/fs))| of a cascade of sections
+static double gain(const float *coeff, int sections, double f, double fs)
+{
+	const std::complex<double> z = std::polar(1.0, 2.0 * M_PI * f / fs);
+	std::complex<double> h = 1.0;
+
+	for (int k = 0; k < sections; k++) {
+		const float *c = &coeff[5 * k];
+
+		h *= ((double)c[0] * z * z + (double)c[1] * z + (double)c[2]) /
+		     (z * z + (double)c[3] * z + (double)c[4]);
+	}
+	return std::abs(h);
+}
+
+TEST(Main, SosButterworth)
+{
+	float coeff[SOS_COEFF_SIZE(5)];
+
+	// Same as MATLAB [b, a] = butter(2, 0.2)
+	ASSERT_EQ(sos_butterworth(coeff, 2, SOS_LOWPASS, 100.0f, 1000.0f), 1);
+	EXPECT_NEAR(0.0674553f, coeff[0], 1e-6);
+	EXPECT_NEAR(0.1349105f, coeff[1], 1e-6);
+	EXPECT_NEAR(0.0674553f, coeff[2], 1e-6);
+	EXPECT_NEAR(-1.1429805f, coeff[3], 1e-6);
+	EXPECT_NEAR(0.4128016f, coeff[4], 1e-6);
+
+	ASSERT_EQ(sos_butterworth(coeff, 5, SOS_LOWPASS, 100.0f, 1000.0f), 3);
+	EXPECT_NEAR(1.0, gain(coeff, 3, 0.0, 1000.0), 1e-5);
+	EXPECT_NEAR(M_SQRT1_2, gain(coeff, 3, 100.0, 1000.0), 1e-4);
+	EXPECT_NEAR(0.0, gain(coeff, 3, 500.0, 1000.0), 1e-5);
+
+	ASSERT_EQ(sos_butterworth(coeff, 4, SOS_HIGHPASS, 50.0f, 1000.0f), 2);
+	EXPECT_NEAR(0.0, gain(coeff, 2, 0.0, 1000.0), 1e-5);
+	EXPECT_NEAR(M_SQRT1_2, gain(coeff, 2, 50.0, 1000.0), 1e-4);
+	EXPECT_NEAR(1.0, gain(coeff, 2, 500.0, 1000.0), 1e-5);
+
+	EXPECT_EQ(sos_butterworth(coeff, 0, SOS_LOWPASS, 100.0f, 1000.0f), -EINVAL);
+	EXPECT_EQ(sos_butterworth(coeff, 2, SOS_LOWPASS, 500.0f, 1000.0f), -EINVAL);
+}
+
+TEST(Main, SosChebyshev)
+{
+	float coeff[SOS_COEFF_SIZE(4)];
+	const double ripple = 1.0;
+	const double edge = pow(10.0, -ripple / 20.0);
+
+	// Even order starts at the bottom of the ripple, odd order at 0 dB
+	ASSERT_EQ(sos_chebyshev1(coeff, 4, SOS_LOWPASS, ripple, 100.0f, 1000.0f), 2);
+	EXPECT_NEAR(edge, gain(coeff, 2, 0.0, 1000.0), 1e-4);
+	EXPECT_NEAR(edge, gain(coeff, 2, 100.0, 1000.0), 1e-3);
+	for (double f = 0.0; f < 100.0; f += 5.0) {
+		EXPECT_LE(gain(coeff, 2, f, 1000.0), 1.0 + 1e-4);
+		EXPECT_GE(gain(coeff, 2, f, 1000.0), edge - 1e-4);
+	}
+	// Steeper than Butterworth of the same order
+	float butter[SOS_COEFF_SIZE(4)];
+
+	sos_butterworth(butter, 4, SOS_LOWPASS, 100.0f, 1000.0f);
+	EXPECT_LT(gain(coeff, 2, 200.0, 1000.0), gain(butter, 2, 200.0, 1000.0));
+
+	ASSERT_EQ(sos_chebyshev1(coeff, 3, SOS_HIGHPASS, ripple, 100.0f, 1000.0f), 2);
+	EXPECT_NEAR(1.0, gain(coeff, 2, 500.0, 1000.0), 1e-4);
+	EXPECT_NEAR(edge, gain(coeff, 2, 100.0, 1000.0), 1e-3);
+	EXPECT_LT(gain(coeff, 2, 20.0, 1000.0), 0.01);
+
+	EXPECT_EQ(sos_chebyshev1(coeff, 3, SOS_LOWPASS, 0.0f, 100.0f, 1000.0f), -EINVAL);
+}
+
+TEST(Main, SosFilterChannels)
+{
+	const uint16_t channels = 3;
+	const uint32_t frames = 200;
+	float coeff[SOS_COEFF_SIZE(3)];
+	float state[SOS_STATE_SIZE(2, 3)], state1[SOS_STATE_SIZE(2, 1)];
+	float x[frames * channels], y[frames * channels];
+	struct sos_filter bank, single;
+
+	ASSERT_EQ(sos_butterworth(coeff, 3, SOS_LOWPASS, 30.0f, 1000.0f), 2);
+	ASSERT_EQ(sos_filter_init(&bank, coeff, 2, channels, state), 0);
+	EXPECT_EQ(sos_filter_init(&bank, coeff, 0, channels, state), -EINVAL);
+	ASSERT_EQ(sos_filter_init(&bank, coeff, 2, channels, state), 0);
+	for (uint32_t t = 0; t < frames * channels; t++)
+		x[t] = sinf(0.05f * t) + (t % 7 == 0 ? 1.0f : 0.0f);
+
+	// Blocks of uneven size give the same result as one call
+	sos_filter_process(&bank, y, x, 77);
+	sos_filter_process(&bank, &y[77 * channels], &x[77 * channels], frames - 77);
+
+	for (uint16_t c = 0; c < channels; c++) {
+		ASSERT_EQ(sos_filter_init(&single, coeff, 2, 1, state1), 0);
+		for (uint32_t t = 0; t < frames; t++) {
+			float v = x[t * channels + c];
+
+			sos_filter_process(&single, &v, &v, 1);
+			EXPECT_FLOAT_EQ(v, y[t * channels + c]);
+		}
+	}
+}
+
+TEST(Main, SosFiltfilt)
+{
+	const uint16_t channels = 2;
+	// Noise is zero at both ends, odd reflection would otherwise mirror it into the pass band
+	const uint32_t frames = 1001;
+	float coeff[SOS_COEFF_SIZE(4)];
+	float state[SOS_STATE_SIZE(2, 2)];
+	static float x[frames * channels], y[frames * channels];
+	struct sos_filter bank;
+
+	ASSERT_EQ(sos_butterworth(coeff, 4, SOS_LOWPASS, 50.0f, 1000.0f), 2);
+	ASSERT_EQ(sos_filter_init(&bank, coeff, 2, channels, state), 0);
+
+	// Pass band sine plus stop band noise on channel 0, a constant on channel 1
+	for (uint32_t t = 0; t < frames; t++) {
+		x[t * channels] = sinf(2.0f * (float)M_PI * 5.0f * t / 1000.0f) +
+				  0.3f * sinf(2.0f * (float)M_PI * 300.0f * t / 1000.0f);
+		x[t * channels + 1] = 3.0f;
+	}
+	sos_filtfilt(&bank, y, x, frames);
+	for (uint32_t t = 0; t < frames; t++) {
+		// Zero phase, so the sine comes out without delay
+		EXPECT_NEAR(sinf(2.0f * (float)M_PI * 5.0f * t / 1000.0f), y[t * channels], 0.02f);
+		// Steady state initial conditions leave no edge transient
+		EXPECT_NEAR(3.0f, y[t * channels + 1], 1e-4);
+	}
+
+	// In place gives the same result and the state is cleared afterwards
+	sos_filtfilt(&bank, x, x, frames);
+	for (uint32_t t = 0; t < frames * channels; t++)
+		EXPECT_EQ(y[t], x[t]);
+	for (uint32_t k = 0; k < SOS_STATE_SIZE(2, 2); k++)
+		EXPECT_EQ(0.0f, state[k]);
+
+	// Very short signals shrink the reflection
+	float s[2 * 3] = { 1, 2, 3, 4, 5, 6 };
+
+	sos_filtfilt(&bank, s, s, 3);
+	for (int i = 0; i < 6; i++)
+		EXPECT_TRUE(isfinite(s[i]));
+	sos_filtfilt(&bank, s, s, 1);
+	EXPECT_TRUE(isfinite(s[0]));
+}
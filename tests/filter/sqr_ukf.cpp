@@ -113,3 +113,49 @@ TEST(Main, SRUKF)
 	printf("Measurement:\n");
 	print(Y, 200, 3);
 }
+
+// Same model as F applied to all sigma points at once
+static void F_batch(float *dX, const float *const X, const float *const u, uint16_t count,
+		    uint8_t L, void *ctx)
+{
+	int *calls = (int *)ctx;
+
+	(*calls)++;
+	for (uint16_t j = 0; j < count; j++) {
+		const float *x = &X[j * L];
+		float *dx = &dX[j * L];
+
+		dx[0] = x[1];
+		dx[1] = x[2];
+		dx[2] = 0.05 * x[0] * (x[1] + x[2]);
+	}
+}
+
+TEST(Main, SRUKFBatch)
+{
+	const uint8_t L = 3;
+	float Rv[3 * 3] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+	float Rn[3 * 3] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+	float S[3 * 3] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+	float S_batch[3 * 3] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+	float xhat[3] = { 0, 0, 1 };
+	float xhat_batch[3] = { 0, 0, 1 };
+	float u[3] = { 0, 0, 0 };
+	int calls = 0;
+
+	for (int i = 0; i < 50; i++) {
+		float y[3] = { 0.1f * sinf(0.1f * i), 0.2f * cosf(0.1f * i), 1.0f };
+
+		ASSERT_EQ(sqr_ukf(y, xhat, Rn, Rv, u, F, S, 0.1f, 2.0f, L), 0);
+		ASSERT_EQ(sqr_ukf_batch(y, xhat_batch, Rn, Rv, u, F_batch, &calls, S_batch, 0.1f,
+					2.0f, L),
+			  0);
+	}
+
+	// One call per step instead of one per sigma point
+	EXPECT_EQ(calls, 50);
+	for (int i = 0; i < 3; i++)
+		EXPECT_FLOAT_EQ(xhat_batch[i], xhat[i]);
+	for (int i = 0; i < 9; i++)
+		EXPECT_FLOAT_EQ(S_batch[i], S[i]);
+}
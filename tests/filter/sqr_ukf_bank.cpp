@@ -0,0 +1,182 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/filter.h"
+};
+
+#define FILTERS 5
+
+// Pendulum angle and rate with sample time 0.1 and a torque input
+static void pendulum(float *dx, const float *const x, float u)
+{
+	dx[0] = x[0] + 0.1f * x[1];
+	dx[1] = x[1] - 0.1f * sinf(x[0]) + 0.1f * u;
+}
+
+static void transition(float *dX, const float *const X, const float *const u, uint16_t count,
+		       uint8_t L, void *ctx)
+{
+	(void)ctx;
+	for (uint16_t j = 0; j < count; j++)
+		pendulum(&dX[j * L], &X[j * L], u[0]);
+}
+
+static void measurement(float *Y, const float *const X, uint16_t count, uint8_t L, uint8_t M,
+			void *ctx)
+{
+	(void)ctx;
+	for (uint16_t j = 0; j < count; j++)
+		Y[j * M] = sinf(X[j * L]);
+}
+
+// Same models for a bank, u holds one input per filter
+static void bank_transition(float *dX, const float *const X, const float *const u,
+			    uint16_t points, uint8_t L, uint16_t count, void *ctx)
+{
+	int *calls = (int *)ctx;
+
+	(*calls)++;
+	for (uint16_t j = 0; j < points; j++) {
+		const float *x0 = &X[(j * L) * count];
+		const float *x1 = &X[(j * L + 1) * count];
+
+		for (uint16_t b = 0; b < count; b++) {
+			dX[(j * L) * count + b] = x0[b] + 0.1f * x1[b];
+			dX[(j * L + 1) * count + b] = x1[b] - 0.1f * sinf(x0[b]) + 0.1f * u[b];
+		}
+	}
+}
+
+static void bank_measurement(float *Y, const float *const X, uint16_t points, uint8_t L,
+			     uint8_t M, uint16_t count, void *ctx)
+{
+	(void)ctx;
+	for (uint16_t j = 0; j < points; j++)
+		for (uint16_t b = 0; b < count; b++)
+			Y[(j * M) * count + b] = sinf(X[(j * L) * count + b]);
+}
+
+TEST(Main, SRUKFBank)
+{
+	const float Sv[4] = { 0.01f, 0.0f, 0.0f, 0.05f };
+	const float Sn[1] = { 0.1f };
+	float bank_storage[SQR_UKF_BANK_STORAGE_SIZE(2, 1, FILTERS)];
+	float storage[FILTERS][SQR_UKF_FILTER_STORAGE_SIZE(2, 1)];
+	struct sqr_ukf_filter single[FILTERS];
+	struct sqr_ukf_bank bank;
+	float state[FILTERS][2];
+	int calls = 0;
+
+	ASSERT_EQ(sqr_ukf_bank_init(&bank, bank_transition, &calls, bank_measurement, NULL, 2, 1,
+				    FILTERS, 0.5f, 2.0f, 0.0f, Sv, Sn, bank_storage),
+		  0);
+
+	for (int b = 0; b < FILTERS; b++) {
+		const float x0[2] = { 0.1f * b, 0.0f };
+		const float S0[4] = { 0.5f, 0.1f * b, 0.0f, 0.5f };
+
+		ASSERT_EQ(sqr_ukf_filter_init(&single[b], transition, NULL, measurement, NULL, 2, 1,
+					      0.5f, 2.0f, 0.0f, Sv, Sn, storage[b]),
+			  0);
+		sqr_ukf_filter_reset(&single[b], x0, S0);
+		sqr_ukf_bank_reset(&bank, b, x0, S0);
+		state[b][0] = 0.3f * b - 0.5f;
+		state[b][1] = 0.2f;
+	}
+
+	for (int t = 0; t < 100; t++) {
+		float u[FILTERS], y[FILTERS];
+
+		for (int b = 0; b < FILTERS; b++) {
+			u[b] = 0.5f * sinf(0.1f * (float)(t + b));
+			y[b] = sinf(state[b][0]);
+			pendulum(state[b], state[b], u[b]);
+			ASSERT_EQ(sqr_ukf_filter_step(&single[b], &y[b], &u[b]), 0);
+		}
+		ASSERT_EQ(sqr_ukf_bank_step(&bank, y, u), 0);
+
+		for (int b = 0; b < FILTERS; b++) {
+			for (int i = 0; i < 2; i++)
+				ASSERT_NEAR(bank.x[i * FILTERS + b], single[b].x[i], 1e-4f);
+			for (int i = 0; i < 4; i++)
+				ASSERT_NEAR(bank.S[i * FILTERS + b], single[b].S[i], 1e-4f);
+		}
+	}
+
+	// One model call per bank step
+	EXPECT_EQ(calls, 100);
+}
+
+TEST(Main, SRUKFBankInvalid)
+{
+	const float Sv[4] = { 1.0f, 0.0f, 0.0f, 1.0f };
+	float storage[SQR_UKF_BANK_STORAGE_SIZE(2, 2, 3)];
+	struct sqr_ukf_bank bank;
+
+	EXPECT_EQ(sqr_ukf_bank_init(&bank, bank_transition, NULL, NULL, NULL, 2, 2, 0, 1.0f, 2.0f,
+				    0.0f, Sv, Sv, storage),
+		  -EINVAL);
+	EXPECT_EQ(sqr_ukf_bank_init(&bank, bank_transition, NULL, NULL, NULL, 2, 1, 3, 1.0f, 2.0f,
+				    0.0f, Sv, Sv, storage),
+		  -EINVAL);
+	EXPECT_EQ(sqr_ukf_bank_init(&bank, bank_transition, NULL, NULL, NULL, 2, 2, 3, 1.0f, 2.0f,
+				    0.0f, Sv, Sv, storage),
+		  0);
+}
+
+static void square(float *dX, const float *const X, const float *const u, uint16_t count,
+		   uint8_t L, void *ctx)
+{
+	(void)u;
+	(void)ctx;
+	for (uint16_t j = 0; j < count * L; j++)
+		dX[j] = X[j] * X[j];
+}
+
+static void bank_square(float *dX, const float *const X, const float *const u, uint16_t points,
+			uint8_t L, uint16_t count, void *ctx)
+{
+	(void)u;
+	(void)ctx;
+	for (uint32_t j = 0; j < (uint32_t)points * L * count; j++)
+		dX[j] = X[j] * X[j];
+}
+
+TEST(Main, SRUKFBankZeroDiagonal)
+{
+	// Without process noise the tall part of the square root is zero before the update
+	const float Sv[1] = { 0.0f };
+	const float Sn[1] = { 0.1f };
+	float storage[SQR_UKF_FILTER_STORAGE_SIZE(1, 1)];
+	float bank_storage[SQR_UKF_BANK_STORAGE_SIZE(1, 1, 1)];
+	struct sqr_ukf_filter f;
+	struct sqr_ukf_bank bank;
+	const float x0[1] = { 0.5f };
+	const float S0[1] = { 0.3f };
+	const float u[1] = { 0.0f };
+	const float y[1] = { 0.3f };
+
+	ASSERT_EQ(sqr_ukf_filter_init(&f, square, NULL, NULL, NULL, 1, 1, 1.0f, 2.0f, 0.0f, Sv, Sn,
+				      storage),
+		  0);
+	ASSERT_EQ(sqr_ukf_bank_init(&bank, bank_square, NULL, NULL, NULL, 1, 1, 1, 1.0f, 2.0f,
+				    0.0f, Sv, Sn, bank_storage),
+		  0);
+	sqr_ukf_filter_reset(&f, x0, S0);
+	sqr_ukf_bank_reset(&bank, 0, x0, S0);
+
+	EXPECT_EQ(sqr_ukf_filter_step(&f, y, u), 0);
+	EXPECT_EQ(sqr_ukf_bank_step(&bank, y, u), 0);
+	EXPECT_TRUE(isfinite(f.S[0]));
+	EXPECT_NEAR(bank.x[0], f.x[0], 1e-6f);
+	EXPECT_NEAR(bank.S[0], f.S[0], 1e-6f);
+}
@@ -0,0 +1,127 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/filter.h"
+};
+
+// Position and velocity with sample time 0.1 and a force input
+static void transition(float *dX, const float *const X, const float *const u, uint16_t count,
+		       uint8_t L, void *ctx)
+{
+	(void)ctx;
+	for (uint16_t j = 0; j < count; j++) {
+		dX[j * L] = X[j * L] + 0.1f * X[j * L + 1];
+		dX[j * L + 1] = 0.95f * X[j * L + 1] + 0.1f * u[0];
+	}
+}
+
+// Only the position is measured
+static void measurement(float *Y, const float *const X, uint16_t count, uint8_t L, uint8_t M,
+			void *ctx)
+{
+	(void)ctx;
+	for (uint16_t j = 0; j < count; j++)
+		Y[j * M] = X[j * L];
+}
+
+// Unscented transform is exact for linear models so the filter must match a Kalman filter
+static void compare_with_kalman(float alpha)
+{
+	const float Sv[4] = { 0.05f, 0.0f, 0.0f, 0.1f };
+	const float Sn[1] = { 0.5f };
+	float storage[SQR_UKF_FILTER_STORAGE_SIZE(2, 1)];
+	struct sqr_ukf_filter f;
+
+	ASSERT_EQ(sqr_ukf_filter_init(&f, transition, NULL, measurement, NULL, 2, 1, alpha, 2.0f,
+				      0.0f, Sv, Sn, storage),
+		  0);
+
+	const float x0[2] = { 1.0f, -1.0f };
+	const float S0[4] = { 2.0f, 0.5f, 0.0f, 1.0f };
+
+	sqr_ukf_filter_reset(&f, x0, S0);
+
+	// Reference Kalman filter in double, P = S0'*S0
+	double x[2] = { 1.0, -1.0 };
+	double P[2][2] = { { 4.0, 1.0 }, { 1.0, 1.25 } };
+	const double A[2][2] = { { 1.0, 0.1 }, { 0.0, 0.95 } };
+	const double Q[2] = { 0.05 * 0.05, 0.1 * 0.1 };
+	const double R = 0.25;
+
+	for (int t = 0; t < 100; t++) {
+		const float u[1] = { sinf(0.05f * (float)t) };
+		const float y[1] = { 2.0f * cosf(0.07f * (float)t) };
+
+		ASSERT_EQ(sqr_ukf_filter_step(&f, y, u), 0);
+
+		const double xp[2] = { x[0] + 0.1 * x[1], 0.95 * x[1] + 0.1 * u[0] };
+		double AP[2][2], Pp[2][2];
+
+		for (int i = 0; i < 2; i++)
+			for (int j = 0; j < 2; j++)
+				AP[i][j] = A[i][0] * P[0][j] + A[i][1] * P[1][j];
+		for (int i = 0; i < 2; i++)
+			for (int j = 0; j < 2; j++)
+				Pp[i][j] = AP[i][0] * A[j][0] + AP[i][1] * A[j][1] +
+					   (i == j ? Q[i] : 0.0);
+
+		const double s = Pp[0][0] + R;
+		const double K[2] = { Pp[0][0] / s, Pp[1][0] / s };
+		const double e = y[0] - xp[0];
+
+		x[0] = xp[0] + K[0] * e;
+		x[1] = xp[1] + K[1] * e;
+		for (int i = 0; i < 2; i++)
+			for (int j = 0; j < 2; j++)
+				P[i][j] = Pp[i][j] - K[i] * s * K[j];
+
+		ASSERT_NEAR(f.x[0], x[0], 1e-3) << "step " << t;
+		ASSERT_NEAR(f.x[1], x[1], 1e-3) << "step " << t;
+
+		// P = S'*S with S upper triangular
+		const float *S = f.S;
+
+		ASSERT_NEAR(S[0] * S[0], P[0][0], 1e-3);
+		ASSERT_NEAR(S[0] * S[1], P[0][1], 1e-3);
+		ASSERT_NEAR(S[1] * S[1] + S[3] * S[3], P[1][1], 1e-3);
+		ASSERT_EQ(S[2], 0.0f);
+	}
+}
+
+TEST(Main, SRUKFFilterLinear)
+{
+	// Positive center weight
+	compare_with_kalman(1.0f);
+	// Negative center weight needs downdates
+	compare_with_kalman(0.5f);
+}
+
+TEST(Main, SRUKFFilterInvalid)
+{
+	const float Sv[4] = { 1.0f, 0.0f, 0.0f, 1.0f };
+	const float Sn[1] = { 1.0f };
+	float storage[SQR_UKF_FILTER_STORAGE_SIZE(2, 1)];
+	struct sqr_ukf_filter f;
+
+	EXPECT_EQ(sqr_ukf_filter_init(&f, transition, NULL, NULL, NULL, 2, 1, 1.0f, 2.0f, 0.0f,
+				      Sv, Sn, storage),
+		  -EINVAL);
+	EXPECT_EQ(sqr_ukf_filter_init(&f, NULL, NULL, measurement, NULL, 2, 1, 1.0f, 2.0f, 0.0f,
+				      Sv, Sn, storage),
+		  -EINVAL);
+	EXPECT_EQ(sqr_ukf_filter_init(&f, transition, NULL, measurement, NULL, 0, 1, 1.0f, 2.0f,
+				      0.0f, Sv, Sn, storage),
+		  -EINVAL);
+	EXPECT_EQ(sqr_ukf_filter_init(&f, transition, NULL, measurement, NULL, 2, 1, 1.0f, 2.0f,
+				      -2.0f, Sv, Sn, storage),
+		  -EINVAL);
+}
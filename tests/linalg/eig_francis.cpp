@@ -0,0 +1,116 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+// Check A * v = lambda * v for every (complex) eigenpair
+static void check_eigenvectors(const float *A, const float *wr, const float *wi, const float *V,
+			       uint16_t n, float tol)
+{
+	for (uint16_t j = 0; j < n; j++) {
+		bool pair = wi[j] != 0.0f;
+
+		for (uint16_t i = 0; i < n; i++) {
+			float avr = 0, avi = 0;
+
+			for (uint16_t k = 0; k < n; k++) {
+				avr += A[n * i + k] * V[n * k + j];
+				if (pair)
+					avi += A[n * i + k] * V[n * k + j + 1];
+			}
+			float vr = V[n * i + j];
+			float vi = pair ? V[n * i + j + 1] : 0.0f;
+
+			EXPECT_NEAR(avr, wr[j] * vr - wi[j] * vi, tol);
+			EXPECT_NEAR(avi, wr[j] * vi + wi[j] * vr, tol);
+		}
+		if (pair) {
+			EXPECT_NEAR(wi[j], -wi[j + 1], 1e-5);
+			j++;
+		}
+	}
+}
+
+TEST(Main, EigFrancisSmall)
+{
+	float A[] = {
+		0.018142, 0.968856, 0.151740, 0.757174, 0.017829, 0.474323, 0.358832, 0.970854,
+		0.184523, 0.063063, 0.680511, 0.191901, 0.806877, 0.830208, 0.977169, 0.222291,
+	};
+	float wr[4], wi[4];
+	float V[4 * 4];
+	float work[EIG_FRANCIS_WORK_SIZE(4)];
+
+	ASSERT_EQ(0, eig_francis(A, wr, wi, V, work, 4));
+
+	// Same eigenvalues as eig() (order follows the Schur form)
+	float er[4] = { 1.87922, -0.45009, -0.45009, 0.41623 };
+	float ei[4] = { 0, -0.11680, 0.11680, 0 };
+
+	for (unsigned c = 0; c < 4; c++) {
+		bool found = false;
+
+		for (unsigned k = 0; k < 4; k++)
+			if (fabsf(er[k] - wr[c]) < 1e-4 && fabsf(ei[k] - wi[c]) < 1e-4)
+				found = true;
+		EXPECT_TRUE(found);
+	}
+	check_eigenvectors(A, wr, wi, V, 4, 1e-4);
+}
+
+TEST(Main, EigFrancisAggressiveEarlyDeflation)
+{
+	const uint16_t n = 48;
+	float A[n * n];
+	float wr[n], wi[n];
+	float V[n * n];
+	float work[EIG_FRANCIS_WORK_SIZE(n)];
+	float trace = 0, sum = 0;
+	uint32_t seed = 1;
+
+	static_assert(n >= EIG_FRANCIS_AED_MIN_ROW, "test must exercise the multishift path");
+
+	for (uint16_t i = 0; i < n * n; i++) {
+		seed = seed * 1103515245u + 12345u;
+		A[i] = (float)((seed >> 8) & 0xffff) / 65536.0f - 0.5f;
+	}
+	for (uint16_t i = 0; i < n; i++)
+		trace += A[n * i + i];
+
+	ASSERT_EQ(0, eig_francis(A, wr, wi, V, work, n));
+
+	for (uint16_t i = 0; i < n; i++)
+		sum += wr[i];
+	EXPECT_NEAR(trace, sum, 1e-3);
+	check_eigenvectors(A, wr, wi, V, n, 2e-3);
+
+	// Eigenvalues only must agree with the vector computation
+	float wr2[n], wi2[n];
+
+	ASSERT_EQ(0, eig_francis(A, wr2, wi2, NULL, work, n));
+	for (uint16_t i = 0; i < n; i++) {
+		bool found = false;
+
+		for (uint16_t k = 0; k < n; k++)
+			if (fabsf(wr[k] - wr2[i]) < 1e-3 && fabsf(wi[k] - wi2[i]) < 1e-3)
+				found = true;
+		EXPECT_TRUE(found);
+	}
+}
+
+TEST(Main, EigFrancisInvalid)
+{
+	float work[1];
+
+	EXPECT_EQ(-EINVAL, eig_francis(work, work, work, NULL, work, 0));
+}
@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+// Compare products with the implicit operator against the dense hankel()
+static void check_operator(const float *V, uint16_t row_v, uint16_t column_v, uint16_t row_h,
+			   uint16_t column_h, uint16_t shift)
+{
+	float H[row_h * column_h], Ht[column_h * row_h];
+	float storage[hankel_operator_storage_size(row_v, row_h, column_h)];
+	struct hankel_operator op;
+	float x[column_h], y[row_h], y_exp[row_h];
+	float w[row_h], z[column_h], z_exp[column_h];
+
+	ASSERT_EQ(hankel(V, H, row_v, column_v, row_h, column_h, shift), 0);
+	ASSERT_EQ(hankel_operator_init(&op, V, row_v, column_v, row_h, column_h, shift, storage),
+		  0);
+
+	for (uint16_t c = 0; c < column_h; c++)
+		x[c] = 0.5f * c - 1.0f;
+	for (uint16_t r = 0; r < row_h; r++)
+		w[r] = (r % 3) - 1.0f + 0.25f * r;
+
+	mul(y_exp, H, x, row_h, column_h, column_h, 1);
+	hankel_operator(y, x, false, &op);
+	for (uint16_t r = 0; r < row_h; r++)
+		EXPECT_NEAR(y_exp[r], y[r], 1e-3);
+
+	tran(Ht, H, row_h, column_h);
+	mul(z_exp, Ht, w, column_h, row_h, row_h, 1);
+	hankel_operator(z, w, true, &op);
+	for (uint16_t c = 0; c < column_h; c++)
+		EXPECT_NEAR(z_exp[c], z[c], 1e-3);
+}
+
+TEST(Main, HankelOperator)
+{
+	// clang-format off
+	float V[2 * 10] = {
+		3, 51, 3, 2, 6, 7, 8, 9, 1, 4,
+		1, 3, 1, 4, 5, 1, 7, 8, 1, 10
+	};
+	float A[1 * 10] = { 0, 2, 4, 1, 4, 5, 7, 2, 7, 8 };
+	// clang-format on
+
+	// Half Hankel matrix as used by okid_era()
+	check_operator(V, 2, 10, 10, 5, 1);
+	check_operator(V, 2, 10, 10, 5, 2);
+	// Full Hankel matrix
+	check_operator(V, 2, 10, 20, 10, 0);
+	check_operator(A, 1, 10, 10, 10, 0);
+}
+
+TEST(Main, HankelOperatorInvalid)
+{
+	float V[2 * 4] = { 0 };
+	float storage[64];
+	struct hankel_operator op;
+
+	EXPECT_EQ(hankel_operator_init(&op, V, 2, 4, 3, 2, 0, storage), -EINVAL);
+	EXPECT_EQ(hankel_operator_storage_size(0, 2, 2), 0u);
+}
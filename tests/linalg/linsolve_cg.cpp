@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+struct dense {
+	const float *A;
+};
+
+// Dense operator so the tests do not depend on the sparse module
+static void dense_operator(float *y, const float *const x, uint16_t row, void *ctx)
+{
+	const struct dense *d = (const struct dense *)ctx;
+
+	mul(y, d->A, x, row, row, row, 1);
+}
+
+static float relative_residual(const float *A, const float *x, const float *b, uint16_t row)
+{
+	float r = 0, n = 0;
+
+	for (uint16_t i = 0; i < row; i++) {
+		float sum = 0;
+
+		for (uint16_t j = 0; j < row; j++)
+			sum += A[row * i + j] * x[j];
+		r += (b[i] - sum) * (b[i] - sum);
+		n += b[i] * b[i];
+	}
+	return sqrtf(r / n);
+}
+
+TEST(Main, LinsolveCg)
+{
+	// Badly scaled 1D Poisson matrix D*T*D
+	const uint16_t n = 40;
+	static float A[40 * 40];
+	float b[40], x[40], diagonal[40];
+	struct dense d = { A };
+	struct linsolve_options options = {};
+	struct linsolve_stats plain, jacobi;
+
+	memset(A, 0, sizeof(A));
+	for (uint16_t i = 0; i < n; i++) {
+		const float si = 1.0f + 9.0f * (i % 2);
+
+		for (uint16_t j = 0; j < n; j++) {
+			const float sj = 1.0f + 9.0f * (j % 2);
+			const float t = i == j ? 2.0f : (i == j + 1 || j == i + 1) ? -1.0f : 0.0f;
+
+			A[n * i + j] = si * t * sj;
+		}
+		diagonal[i] = A[n * i + i];
+		b[i] = 1.0f + 0.1f * i;
+	}
+
+	options.tolerance = 1e-5f;
+	options.max_iterations = 200;
+
+	memset(x, 0, sizeof(x));
+	ASSERT_EQ(linsolve_cg(x, dense_operator, &d, b, n, &options, &plain), 0);
+	EXPECT_LT(relative_residual(A, x, b, n), 1e-3);
+
+	options.preconditioner = linsolve_jacobi_preconditioner;
+	options.preconditioner_ctx = diagonal;
+	memset(x, 0, sizeof(x));
+	ASSERT_EQ(linsolve_cg(x, dense_operator, &d, b, n, &options, &jacobi), 0);
+	EXPECT_LT(relative_residual(A, x, b, n), 1e-3);
+	EXPECT_LE(jacobi.residual, options.tolerance);
+	EXPECT_LT(jacobi.iterations, plain.iterations);
+
+	// Iteration limit is reported
+	options.max_iterations = 3;
+	memset(x, 0, sizeof(x));
+	EXPECT_EQ(linsolve_cg(x, dense_operator, &d, b, n, &options, &plain), -ENOTSUP);
+	EXPECT_EQ(plain.iterations, 3);
+	EXPECT_EQ(linsolve_cg(x, NULL, &d, b, n, &options, &plain), -EINVAL);
+}
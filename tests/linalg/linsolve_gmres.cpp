@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+struct dense {
+	const float *A;
+};
+
+// Dense operator so the tests do not depend on the sparse module
+static void dense_operator(float *y, const float *const x, uint16_t row, void *ctx)
+{
+	const struct dense *d = (const struct dense *)ctx;
+
+	mul(y, d->A, x, row, row, row, 1);
+}
+
+static float relative_residual(const float *A, const float *x, const float *b, uint16_t row)
+{
+	float r = 0, n = 0;
+
+	for (uint16_t i = 0; i < row; i++) {
+		float sum = 0;
+
+		for (uint16_t j = 0; j < row; j++)
+			sum += A[row * i + j] * x[j];
+		r += (b[i] - sum) * (b[i] - sum);
+		n += b[i] * b[i];
+	}
+	return sqrtf(r / n);
+}
+
+TEST(Main, LinsolveGmres)
+{
+	// Nonsymmetric convection-diffusion matrix
+	const uint16_t n = 30;
+	static float A[30 * 30];
+	float b[30], x[30], diagonal[30];
+	struct dense d = { A };
+	struct linsolve_options options = {};
+	struct linsolve_stats stats, restarted;
+
+	memset(A, 0, sizeof(A));
+	for (uint16_t i = 0; i < n; i++) {
+		A[n * i + i] = 2.5f + 0.1f * i;
+		if (i > 0)
+			A[n * i + i - 1] = -1.4f;
+		if (i + 1 < n)
+			A[n * i + i + 1] = -0.6f;
+		diagonal[i] = A[n * i + i];
+		b[i] = sinf(0.3f * i) + 1.0f;
+	}
+
+	options.tolerance = 1e-5f;
+	options.max_iterations = 200;
+
+	float work[LINSOLVE_GMRES_WORK_SIZE(30, 0)];
+
+	memset(x, 0, sizeof(x));
+	ASSERT_EQ(linsolve_gmres(x, dense_operator, &d, b, n, &options, &stats, work), 0);
+	EXPECT_LT(relative_residual(A, x, b, n), 1e-4);
+
+	// Short restart cycles with a preconditioner still converge
+	options.restart = 5;
+	options.preconditioner = linsolve_jacobi_preconditioner;
+	options.preconditioner_ctx = diagonal;
+	memset(x, 0, sizeof(x));
+	ASSERT_EQ(linsolve_gmres(x, dense_operator, &d, b, n, &options, &restarted, work), 0);
+	EXPECT_LT(relative_residual(A, x, b, n), 1e-4);
+
+	// Solution may overwrite the right hand side
+	float y[30];
+
+	memcpy(y, b, sizeof(y));
+	ASSERT_EQ(linsolve_gmres(y, dense_operator, &d, y, n, &options, NULL, work), 0);
+	for (uint16_t i = 0; i < n; i++)
+		EXPECT_NEAR(x[i], y[i], 1e-3);
+}
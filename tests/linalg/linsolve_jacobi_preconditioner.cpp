@@ -0,0 +1,26 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+TEST(Main, LinsolveJacobiPreconditioner)
+{
+	float diagonal[3] = { 2, 0, -4 };
+	float x[3] = { 1, 5, 2 };
+	float y[3];
+
+	linsolve_jacobi_preconditioner(y, x, 3, diagonal);
+	EXPECT_FLOAT_EQ(y[0], 0.5f);
+	EXPECT_FLOAT_EQ(y[1], 5.0f);
+	EXPECT_FLOAT_EQ(y[2], -0.5f);
+}
@@ -6,6 +6,8 @@
  * Training: https://swedishembedded.com/tag/training
  */
 
+#include <errno.h>
+#include <math.h>
 #include <stdio.h>
 #include <gtest/gtest.h>
 
@@ -155,3 +157,130 @@ TEST(Main, Solve2x10)
 		EXPECT_NEAR(s_exp[c], s[c], 1e-6);
 	}
 }
+
+// Uniform numbers in [-1, 1) from a fixed linear congruential sequence
+static float lcg(uint32_t *state)
+{
+	*state = *state * 1664525u + 1013904223u;
+	return (float)(*state >> 8) * (2.0f / 16777216.0f) - 1.0f;
+}
+
+// y = u*g truncated to n samples
+static void convolve(float *y, const float *u, const float *g, uint16_t n)
+{
+	for (uint16_t i = 0; i < n; i++) {
+		y[i] = 0.0f;
+		for (uint16_t j = 0; j <= i; j++)
+			y[i] += u[i - j] * g[j];
+	}
+}
+
+TEST(Main, SolveLongFft)
+{
+	const uint16_t n = 300;
+	float u[300], y[300], g[300], g_exp[300];
+	uint32_t state = 1;
+
+	for (uint16_t i = 0; i < n; i++) {
+		u[i] = lcg(&state);
+		g_exp[i] = powf(0.95f, i) * cosf(0.2f * i);
+	}
+	// Dominant first sample keeps the triangular system well conditioned
+	u[0] = 3.0f;
+	convolve(y, u, g_exp, n);
+
+	linsolve_markov(g, y, u, 1, n);
+	for (uint16_t i = 0; i < n; i++)
+		EXPECT_NEAR(g_exp[i], g[i], 1e-3);
+}
+
+TEST(Main, SolveDelayedInput)
+{
+	// Input starts one sample late, which used to divide by zero
+	float u[6] = { 0, 2, 1, 0, -1, 0.5 };
+	float g_exp[6] = { 1, 0.5, -0.25, 0.125, 0.5, 0 };
+	float y[6], g[6];
+
+	convolve(y, u, g_exp, 6);
+	linsolve_markov(g, y, u, 1, 6);
+	for (int i = 0; i < 5; i++)
+		EXPECT_NEAR(g_exp[i], g[i], 1e-5);
+	EXPECT_EQ(g[5], 0.0f);
+}
+
+TEST(Main, SolveRegularized)
+{
+	const uint16_t n = 128;
+	float u[128], y[128], g[128], g_exp[128];
+	uint32_t state = 7;
+
+	// Input ends early so the whole response is inside the record
+	for (uint16_t i = 0; i < n; i++) {
+		u[i] = i < 64 ? lcg(&state) : 0.0f;
+		g_exp[i] = i < 32 ? powf(0.8f, i) : 0.0f;
+	}
+	u[0] = 0.0f;
+	convolve(y, u, g_exp, n);
+
+	float work[LINSOLVE_MARKOV_REGULARIZED_WORK_SIZE(128)];
+
+	linsolve_markov_regularized(g, y, u, 1, n, 1e-6f, work);
+	for (uint16_t i = 0; i < 32; i++)
+		EXPECT_NEAR(g_exp[i], g[i], 1e-2);
+}
+
+TEST(Main, SolveLongRecord)
+{
+	// Long enough that buffers kept alive across the recursion overflowed small stacks
+	const uint16_t n = 30000;
+	const uint16_t taps = 64;
+	static float u[30000], y[30000];
+	float g_exp[64];
+	uint32_t state = 3;
+
+	// Sum of |u[i]| for i > 0 below u[0] keeps errors from growing along the record
+	for (uint16_t i = 0; i < n; i++)
+		u[i] = lcg(&state) * (2.0f / n);
+	u[0] = 3.0f;
+	for (uint16_t i = 0; i < taps; i++)
+		g_exp[i] = powf(0.9f, i) * cosf(0.3f * i);
+	for (uint16_t i = 0; i < n; i++) {
+		y[i] = 0.0f;
+		for (uint16_t j = 0; j < taps && j <= i; j++)
+			y[i] += u[i - j] * g_exp[j];
+	}
+
+	// Solved in place
+	linsolve_markov(y, y, u, 1, n);
+	for (uint16_t i = 0; i < taps; i++)
+		EXPECT_NEAR(g_exp[i], y[i], 1e-3);
+	for (uint16_t i = taps; i < n; i++)
+		ASSERT_NEAR(0.0f, y[i], 1e-3);
+}
+
+TEST(Main, SolveRegularizedLongRecord)
+{
+	const uint16_t n = 30000;
+	const uint16_t taps = 32;
+	static float u[30000], y[30000];
+	static float work[LINSOLVE_MARKOV_REGULARIZED_WORK_SIZE(30000)];
+	float g_exp[32];
+	uint32_t state = 5;
+
+	// Input ends early so the whole response is inside the record
+	for (uint16_t i = 0; i < n; i++)
+		u[i] = i < n - taps ? lcg(&state) : 0.0f;
+	u[0] = 0.0f;
+	for (uint16_t i = 0; i < taps; i++)
+		g_exp[i] = powf(0.8f, i);
+	for (uint16_t i = 0; i < n; i++) {
+		y[i] = 0.0f;
+		for (uint16_t j = 0; j < taps && j <= i; j++)
+			y[i] += u[i - j] * g_exp[j];
+	}
+
+	// Solved in place with the workspace instead of the stack
+	linsolve_markov_regularized(y, y, u, 1, n, 1e-6f, work);
+	for (uint16_t i = 0; i < taps; i++)
+		EXPECT_NEAR(g_exp[i], y[i], 1e-2);
+}
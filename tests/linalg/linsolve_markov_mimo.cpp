@@ -0,0 +1,112 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+// Uniform numbers in [-1, 1) from a fixed linear congruential sequence
+static float lcg(uint32_t *state)
+{
+	*state = *state * 1664525u + 1013904223u;
+	return (float)(*state >> 8) * (2.0f / 16777216.0f) - 1.0f;
+}
+
+TEST(Main, SolveMarkovMimo)
+{
+	const uint16_t n = 200, lags = 4;
+	float u[2 * 200], y[2 * 200];
+	float G[2 * (2 * 4)];
+	float work[LINSOLVE_MARKOV_MIMO_WORK_SIZE(2, 200, 4)];
+	uint32_t state = 3;
+	// clang-format off
+	// G_exp = [G_0 G_1 G_2 G_3], 2 outputs x 2 inputs per block
+	const float G_exp[2 * (2 * 4)] = {
+		1.0,  0.0, 0.5,  0.2, 0.25, 0.1, 0.1, 0.0,
+		0.0, -1.0, 0.3, -0.5, 0.0, -0.25, 0.1, 0.05
+	};
+	// clang-format on
+
+	// Inputs stop before the end so the response has settled
+	for (uint16_t t = 0; t < n; t++) {
+		u[t] = t < n - lags ? lcg(&state) : 0.0f;
+		u[n + t] = t < n - lags ? lcg(&state) : 0.0f;
+	}
+	for (uint16_t o = 0; o < 2; o++) {
+		for (uint16_t t = 0; t < n; t++) {
+			float sum = 0.0f;
+
+			for (uint16_t s = 0; s < lags && s <= t; s++)
+				for (uint16_t i = 0; i < 2; i++)
+					sum += G_exp[2 * lags * o + 2 * s + i] * u[n * i + t - s];
+			y[n * o + t] = sum;
+		}
+	}
+
+	ASSERT_EQ(linsolve_markov_mimo(G, y, u, 2, 2, n, lags, 0.0f, work), 0);
+	for (int c = 0; c < 2 * 2 * lags; c++)
+		EXPECT_NEAR(G_exp[c], G[c], 1e-3);
+
+	EXPECT_EQ(linsolve_markov_mimo(G, y, u, 2, 2, n, 0, 0.0f, work), -EINVAL);
+}
+
+TEST(Main, SolveMarkovMimoRegularized)
+{
+	float u[1 * 32], y[1 * 32], G[1 * 3], G_ridge[1 * 3];
+	float work[LINSOLVE_MARKOV_MIMO_WORK_SIZE(1, 32, 3)];
+	uint32_t state = 11;
+
+	for (int t = 0; t < 32; t++)
+		u[t] = t < 29 ? lcg(&state) : 0.0f;
+	for (int t = 0; t < 32; t++)
+		y[t] = u[t] + (t > 0 ? 0.5f * u[t - 1] : 0.0f) + 0.05f * lcg(&state);
+
+	// The ridge term shrinks the parameters towards zero
+	ASSERT_EQ(linsolve_markov_mimo(G, y, u, 1, 1, 32, 3, 0.0f, work), 0);
+	ASSERT_EQ(linsolve_markov_mimo(G_ridge, y, u, 1, 1, 32, 3, 1.0f, work), 0);
+	EXPECT_NEAR(1.0f, G[0], 0.1f);
+	EXPECT_NEAR(0.5f, G[1], 0.1f);
+	EXPECT_LT(fabsf(G_ridge[0]), fabsf(G[0]));
+
+	// No excitation at all
+	float z[1 * 32] = { 0 };
+
+	EXPECT_EQ(linsolve_markov_mimo(G, y, z, 1, 1, 32, 3, 0.0f, work), -ENOTSUP);
+}
+
+TEST(Main, SolveMarkovMimoLongRecord)
+{
+	const uint16_t n = 30000, lags = 3;
+	static float u[2 * 30000], y[1 * 30000];
+	static float work[LINSOLVE_MARKOV_MIMO_WORK_SIZE(2, 30000, 3)];
+	float G[1 * (2 * 3)];
+	// G_exp = [G_0 G_1 G_2], 1 output x 2 inputs per block
+	const float G_exp[1 * (2 * 3)] = { 1.0f, -0.5f, 0.5f, 0.25f, 0.2f, 0.0f };
+	uint32_t state = 9;
+
+	for (uint16_t t = 0; t < n; t++) {
+		u[t] = t < n - lags ? lcg(&state) : 0.0f;
+		u[n + t] = t < n - lags ? lcg(&state) : 0.0f;
+	}
+	for (uint16_t t = 0; t < n; t++) {
+		float sum = 0.0f;
+
+		for (uint16_t s = 0; s < lags && s <= t; s++)
+			for (uint16_t i = 0; i < 2; i++)
+				sum += G_exp[2 * s + i] * u[n * i + t - s];
+		y[t] = sum;
+	}
+
+	ASSERT_EQ(linsolve_markov_mimo(G, y, u, 1, 2, n, lags, 0.0f, work), 0);
+	for (int c = 0; c < 2 * lags; c++)
+		EXPECT_NEAR(G_exp[c], G[c], 1e-3);
+}
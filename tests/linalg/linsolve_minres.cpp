@@ -0,0 +1,71 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+struct dense {
+	const float *A;
+};
+
+// Dense operator so the tests do not depend on the sparse module
+static void dense_operator(float *y, const float *const x, uint16_t row, void *ctx)
+{
+	const struct dense *d = (const struct dense *)ctx;
+
+	mul(y, d->A, x, row, row, row, 1);
+}
+
+static float relative_residual(const float *A, const float *x, const float *b, uint16_t row)
+{
+	float r = 0, n = 0;
+
+	for (uint16_t i = 0; i < row; i++) {
+		float sum = 0;
+
+		for (uint16_t j = 0; j < row; j++)
+			sum += A[row * i + j] * x[j];
+		r += (b[i] - sum) * (b[i] - sum);
+		n += b[i] * b[i];
+	}
+	return sqrtf(r / n);
+}
+
+TEST(Main, LinsolveMinres)
+{
+	// Symmetric indefinite saddle point system [K B'; B 0]
+	// clang-format off
+	float A[5 * 5] = {
+		4, 1, 0, 1, 0,
+		1, 3, 1, 0, 1,
+		0, 1, 2, 1, 1,
+		1, 0, 1, 0, 0,
+		0, 1, 1, 0, 0
+	};
+	// clang-format on
+	float b[5] = { 1, 2, 3, 4, 5 };
+	float x[5] = { 0 };
+	struct dense d = { A };
+	struct linsolve_options options = {};
+	struct linsolve_stats stats;
+
+	options.tolerance = 1e-6f;
+	options.max_iterations = 50;
+
+	ASSERT_EQ(linsolve_minres(x, dense_operator, &d, b, 5, &options, &stats), 0);
+	EXPECT_LT(relative_residual(A, x, b, 5), 1e-4);
+	EXPECT_LE(stats.iterations, 10);
+
+	// Starting from the solution needs no iterations
+	ASSERT_EQ(linsolve_minres(x, dense_operator, &d, b, 5, &options, &stats), 0);
+	EXPECT_EQ(stats.iterations, 0);
+}
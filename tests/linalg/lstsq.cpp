@@ -0,0 +1,107 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+/*
+ * GNU Octave code:
+A = [1 2 3; -1 0.5 4; 2 -3 1; 0 1 -2; 5 0.3 0.7];
+B = [1 0; 2 1; 3 0; 4 -1; 5 2];
+A \ B
+ */
+TEST(Main, LstsqTall)
+{
+	// clang-format off
+	float A[5 * 3] = {
+		 1.0,  2.0,  3.0,
+		-1.0,  0.5,  4.0,
+		 2.0, -3.0,  1.0,
+		 0.0,  1.0, -2.0,
+		 5.0,  0.3,  0.7
+	};
+	float B[5 * 2] = {
+		1.0,  0.0,
+		2.0,  1.0,
+		3.0,  0.0,
+		4.0, -1.0,
+		5.0,  2.0
+	};
+	// clang-format on
+	float X[3 * 2], Ai[3 * 5], X_exp[3 * 2];
+	uint16_t rank = 0;
+
+	ASSERT_EQ(lstsq(X, A, B, 5, 3, 2, 0.0f, &rank), 0);
+	EXPECT_EQ(rank, 3);
+
+	pinv(Ai, A, 5, 3);
+	mul(X_exp, Ai, B, 3, 5, 5, 2);
+	for (unsigned int c = 0; c < 3 * 2; c++)
+		EXPECT_NEAR(X_exp[c], X[c], 1e-4);
+
+	// Residual is orthogonal to the columns of A
+	float R[5 * 2], AtR[3 * 2], At[3 * 5];
+
+	mul(R, A, X, 5, 3, 3, 2);
+	for (unsigned int c = 0; c < 5 * 2; c++)
+		R[c] -= B[c];
+	tran(At, A, 5, 3);
+	mul(AtR, At, R, 3, 5, 5, 2);
+	for (unsigned int c = 0; c < 3 * 2; c++)
+		EXPECT_NEAR(0.0f, AtR[c], 1e-4);
+}
+
+TEST(Main, LstsqRankDeficient)
+{
+	// Third column is the sum of the first two
+	// clang-format off
+	float A[4 * 3] = {
+		1.0,  2.0, 3.0,
+		0.0,  1.0, 1.0,
+		2.0, -1.0, 1.0,
+		1.0,  1.0, 2.0
+	};
+	// clang-format on
+	float b[4] = { 1.0, -1.0, 2.0, 0.5 };
+	float x[3], Ai[3 * 4], x_exp[3];
+	uint16_t rank = 0;
+
+	// Falls back to the minimum norm solution, same as pinv(A)*b
+	ASSERT_EQ(lstsq(x, A, b, 4, 3, 1, 0.0f, &rank), 0);
+	EXPECT_EQ(rank, 2);
+	pinv(Ai, A, 4, 3);
+	mul(x_exp, Ai, b, 3, 4, 4, 1);
+	for (unsigned int c = 0; c < 3; c++)
+		EXPECT_NEAR(x_exp[c], x[c], 1e-4);
+}
+
+TEST(Main, LstsqWide)
+{
+	float A[2 * 3] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+	float b[2] = { 1.0, 2.0 };
+	float x[3], r[2];
+
+	// Minimum norm solution solves the system exactly
+	ASSERT_EQ(lstsq(x, A, b, 2, 3, 1, 0.0f, NULL), 0);
+	mul(r, A, x, 2, 3, 3, 1);
+	EXPECT_NEAR(b[0], r[0], 1e-4);
+	EXPECT_NEAR(b[1], r[1], 1e-4);
+	EXPECT_NEAR(0.0f, x[0] - 2.0f * x[1] + x[2], 1e-4);
+}
+
+TEST(Main, LstsqInvalid)
+{
+	float A[1] = { 1.0 }, b[1] = { 1.0 }, x[1];
+
+	EXPECT_EQ(lstsq(x, A, b, 0, 1, 1, 0.0f, NULL), -EINVAL);
+	EXPECT_EQ(lstsq(x, A, b, 1, 1, 0, 0.0f, NULL), -EINVAL);
+}
@@ -0,0 +1,128 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+TEST(Main, MatViewBlocks)
+{
+	// clang-format off
+	float M[4 * 5] = {
+		 1,  2,  3,  4,  5,
+		 6,  7,  8,  9, 10,
+		11, 12, 13, 14, 15,
+		16, 17, 18, 19, 20
+	};
+	// clang-format on
+	const struct mat_view m = mat_view_init(M, 4, 5);
+	const struct mat_view b = mat_view_block(m, 1, 2, 2, 3);
+
+	EXPECT_EQ(b.rows, 2u);
+	EXPECT_EQ(b.cols, 3u);
+	EXPECT_EQ(b.ld, 5u);
+	EXPECT_FLOAT_EQ(b.data[0], 8);
+	EXPECT_FLOAT_EQ(b.data[b.ld * 1 + 2], 15);
+
+	// Blocks are clamped to the parent
+	const struct mat_view c = mat_view_block(m, 3, 4, 5, 5);
+
+	EXPECT_EQ(c.rows, 1u);
+	EXPECT_EQ(c.cols, 1u);
+	EXPECT_EQ(mat_view_block(m, 4, 0, 1, 1).rows, 0u);
+
+	// Copy a block into another block of the same matrix
+	EXPECT_EQ(copy_view(mat_view_block(m, 0, 0, 2, 3), mat_view_block(m, 2, 2, 2, 3)), 0);
+	EXPECT_FLOAT_EQ(M[0], 13);
+	EXPECT_FLOAT_EQ(M[5 + 2], 20);
+	EXPECT_EQ(copy_view(m, b), -EINVAL);
+}
+
+TEST(Main, MatViewKernels)
+{
+	// clang-format off
+	float M[4 * 4] = {
+		2, 1, 0, 5,
+		1, 3, 1, 6,
+		0, 1, 4, 7,
+		8, 9, 1, 2
+	};
+	// clang-format on
+	float A[3 * 3], B[3 * 1], C[3 * 1], D[3 * 1], X[3 * 3];
+	const struct mat_view m = mat_view_init(M, 4, 4);
+	const struct mat_view a = mat_view_block(m, 0, 0, 3, 3);
+	const struct mat_view b = mat_view_block(m, 0, 3, 3, 1);
+
+	// Same result as the dense kernels on copies of the blocks
+	copy_view(mat_view_init(A, 3, 3), a);
+	copy_view(mat_view_init(B, 3, 1), b);
+	mul(C, A, B, 3, 3, 3, 1);
+	ASSERT_EQ(mul_view(mat_view_init(D, 3, 1), a, b), 0);
+	for (unsigned int c = 0; c < 3; c++)
+		EXPECT_FLOAT_EQ(C[c], D[c]);
+	EXPECT_EQ(mul_view(mat_view_init(D, 3, 1), b, a), -EINVAL);
+
+	tran(A, A, 3, 3);
+	ASSERT_EQ(tran_view(mat_view_init(X, 3, 3), a), 0);
+	for (unsigned int c = 0; c < 3 * 3; c++)
+		EXPECT_FLOAT_EQ(A[c], X[c]);
+
+	// Sub block update in place: last row += first row
+	ASSERT_EQ(add_view(mat_view_block(m, 3, 0, 1, 4), mat_view_block(m, 3, 0, 1, 4),
+			   mat_view_block(m, 0, 0, 1, 4)),
+		  0);
+	EXPECT_FLOAT_EQ(M[12], 10);
+	EXPECT_FLOAT_EQ(M[15], 7);
+}
+
+TEST(Main, MatViewTriangular)
+{
+	// clang-format off
+	float M[3 * 5] = {
+		2, 0, 0, 4,  2,
+		1, 3, 0, 5,  1,
+		4, 2, 5, 6, -1
+	};
+	// clang-format on
+	float X[3 * 2];
+	float x[3], bcol[3];
+	float L[3 * 3], U[3 * 3];
+	const struct mat_view m = mat_view_init(M, 3, 5);
+	const struct mat_view l = mat_view_block(m, 0, 0, 3, 3);
+	const struct mat_view rhs = mat_view_block(m, 0, 3, 3, 2);
+
+	copy_view(mat_view_init(L, 3, 3), l);
+	tran(U, L, 3, 3);
+
+	ASSERT_EQ(linsolve_lower_triangular_view(mat_view_init(X, 3, 2), l, rhs), 0);
+	for (unsigned int k = 0; k < 2; k++) {
+		for (unsigned int i = 0; i < 3; i++)
+			bcol[i] = M[5 * i + 3 + k];
+		linsolve_lower_triangular(L, x, bcol, 3);
+		for (unsigned int i = 0; i < 3; i++)
+			EXPECT_NEAR(x[i], X[2 * i + k], 1e-6);
+	}
+
+	// Solve in place in the right hand side block
+	ASSERT_EQ(linsolve_upper_triangular_view(rhs, mat_view_init(U, 3, 3), rhs), 0);
+	for (unsigned int k = 0; k < 2; k++) {
+		for (unsigned int i = 0; i < 3; i++) {
+			float sum = 0;
+
+			for (unsigned int j = 0; j < 3; j++)
+				sum += U[3 * i + j] * M[5 * j + 3 + k];
+			bcol[i] = sum;
+		}
+		EXPECT_NEAR(bcol[0], k == 0 ? 4 : 2, 1e-5);
+		EXPECT_NEAR(bcol[1], k == 0 ? 5 : 1, 1e-5);
+		EXPECT_NEAR(bcol[2], k == 0 ? 6 : -1, 1e-5);
+	}
+	EXPECT_EQ(linsolve_upper_triangular_view(rhs, m, rhs), -EINVAL);
+}
@@ -0,0 +1,100 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <cstdint>
+#include <gtest/gtest.h>
+
+#include "control/matrix.hpp"
+
+using control::Matrix;
+
+TEST(Main, MatrixStateUpdate)
+{
+	// clang-format off
+	const Matrix<3, 3> A = {
+		0.9f, 0.1f, 0.0f,
+		0.0f, 0.8f, 0.2f,
+		0.1f, 0.0f, 0.7f
+	};
+	const Matrix<3, 1> B = { 1.0f, 0.5f, 0.0f };
+	// clang-format on
+	Matrix<3, 1> x = { 1.0f, -1.0f, 2.0f };
+	const Matrix<1, 1> u = { 3.0f };
+	float Ax[3], Bu[3], x_exp[3];
+
+	// Same result as the C API with explicit temporaries
+	mul(Ax, A.data(), x.data(), 3, 3, 3, 1);
+	mul(Bu, B.data(), u.data(), 3, 1, 1, 1);
+	add(x_exp, Ax, Bu, 3, 1);
+
+	// x is read by the product while it is written
+	x = A * x + B * u;
+
+	for (unsigned int i = 0; i < 3; i++)
+		EXPECT_FLOAT_EQ(x_exp[i], x(i, 0));
+}
+
+TEST(Main, MatrixElementWise)
+{
+	const Matrix<2, 2> A = { 1, 2, 3, 4 };
+	const Matrix<2, 2> B = { 4, 3, 2, 1 };
+	Matrix<2, 2> C = 2.0f * A - B / 2.0f + A;
+
+	EXPECT_EQ((Matrix<2, 2>::rows), 2u);
+	EXPECT_FLOAT_EQ(C(0, 0), 1.0f);
+	EXPECT_FLOAT_EQ(C(0, 1), 4.5f);
+	EXPECT_FLOAT_EQ(C(1, 0), 8.0f);
+	EXPECT_FLOAT_EQ(C(1, 1), 11.5f);
+
+	C += A;
+	C -= -B;
+	C *= 0.5f;
+	EXPECT_FLOAT_EQ(C(1, 1), (11.5f + 4.0f + 1.0f) * 0.5f);
+
+	// Transpose into itself goes through a temporary
+	C = transpose(A);
+	EXPECT_FLOAT_EQ(C(0, 1), 3.0f);
+	EXPECT_FLOAT_EQ(C(1, 0), 2.0f);
+	C = transpose(C) * Matrix<2, 2>::identity();
+	EXPECT_FLOAT_EQ(C(0, 1), 2.0f);
+
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(C.data()) % 16, 0u);
+}
+
+TEST(Main, MatrixWrappers)
+{
+	const Matrix<2, 2> A = { 4, 7, 2, 6 };
+	const Matrix<2, 1> b = { 1, 2 };
+	Matrix<2, 2> Ai;
+	Matrix<2, 1> x;
+
+	ASSERT_EQ(control::inv(Ai, A), 0);
+	const Matrix<2, 2> I = A * Ai;
+
+	EXPECT_NEAR(I(0, 0), 1.0f, 1e-5);
+	EXPECT_NEAR(I(0, 1), 0.0f, 1e-5);
+	EXPECT_NEAR(control::det(A), 10.0f, 1e-4);
+
+	ASSERT_EQ(control::linsolve(x, A, b), 0);
+	const Matrix<2, 1> r = A * x - b;
+
+	EXPECT_NEAR(r(0, 0), 0.0f, 1e-5);
+	EXPECT_NEAR(r(1, 0), 0.0f, 1e-5);
+
+	const Matrix<3, 2> T = { 1, 0, 0, 1, 1, 1 };
+	const Matrix<2, 3> Ti = control::pinv(T);
+	const Matrix<2, 2> TiT = Ti * T;
+
+	EXPECT_NEAR(TiT(0, 0), 1.0f, 1e-4);
+	EXPECT_NEAR(TiT(1, 0), 0.0f, 1e-4);
+
+	Matrix<2, 2> M = A;
+	const struct mat_view v = M.view();
+
+	EXPECT_EQ(v.data, M.data());
+	EXPECT_EQ(v.ld, 2u);
+}
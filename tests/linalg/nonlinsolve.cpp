@@ -6,6 +6,7 @@
  * Training: https://swedishembedded.com/tag/training
  */
 
+#include <math.h>
 #include <stdio.h>
 #include <gtest/gtest.h>
 
@@ -64,3 +65,94 @@ TEST(Main, Nonlinsolve)
 		break;
 	}
 }
+
+TEST(Main, NonlinsolveMultistart)
+{
+	const uint32_t total = 2000;
+	float b[3] = { 1, 1, 1 };
+	float x[3], dx[3];
+	uint32_t index;
+
+	// The full range in one call
+	const float residual = nonlinsolve_multistart(func, b, x, 3, 5, -5, 1234, 0, total, &index);
+
+	EXPECT_LT(index, total);
+	func(dx, b, x);
+	EXPECT_FLOAT_EQ(residual, norm(dx, 1, 3, 2));
+
+	// Uneven shards merged in reverse order give the same candidate
+	const uint32_t bounds[4] = { 0, 333, 1500, total };
+	float xs[3][3], rs[3];
+	uint32_t is[3];
+
+	for (int k = 0; k < 3; k++)
+		rs[k] = nonlinsolve_multistart(func, b, xs[k], 3, 5, -5, 1234, bounds[k],
+					       bounds[k + 1] - bounds[k], &is[k]);
+
+	float merged = rs[2];
+	uint32_t merged_index = is[2];
+	float merged_x[3];
+
+	memcpy(merged_x, xs[2], sizeof(merged_x));
+	for (int k = 1; k >= 0; k--)
+		merged = nonlinsolve_multistart_merge(merged_x, merged, &merged_index, xs[k], rs[k],
+						      is[k], 3);
+	EXPECT_EQ(residual, merged);
+	EXPECT_EQ(index, merged_index);
+	for (int i = 0; i < 3; i++)
+		EXPECT_EQ(x[i], merged_x[i]);
+
+	// Another seed draws other candidates
+	float y[3];
+	uint32_t other;
+
+	nonlinsolve_multistart(func, b, y, 3, 5, -5, 4321, 0, total, &other);
+	EXPECT_TRUE(x[0] != y[0] || x[1] != y[1] || x[2] != y[2]);
+
+	// Candidates stay inside the bounds and refinement improves the best one
+	for (int i = 0; i < 3; i++) {
+		EXPECT_GE(x[i], -5.0f);
+		EXPECT_LE(x[i], 5.0f);
+	}
+	nonlinsolve_refine(func, b, x, 3, 0.05f);
+	func(dx, b, x);
+	EXPECT_LE(norm(dx, 1, 3, 2), residual);
+}
+
+TEST(Main, NonlinsolveMultistartMergeTie)
+{
+	float x[1] = { 1.0f };
+	const float other[1] = { 2.0f };
+	const float first[1] = { 1.0f };
+	uint32_t index = 7;
+
+	// Equal residuals keep the lowest index whatever the order
+	EXPECT_EQ(nonlinsolve_multistart_merge(x, 0.5f, &index, other, 0.5f, 3, 1), 0.5f);
+	EXPECT_EQ(index, 3u);
+	EXPECT_EQ(x[0], 2.0f);
+	EXPECT_EQ(nonlinsolve_multistart_merge(x, 0.5f, &index, first, 0.5f, 7, 1), 0.5f);
+	EXPECT_EQ(index, 3u);
+	EXPECT_EQ(x[0], 2.0f);
+}
+
+// Residual is NaN for negative x[0]
+static void func_nan(float dx[], float b[], float x[])
+{
+	dx[0] = sqrtf(x[0]) - b[0];
+	dx[1] = x[1] - b[1];
+}
+
+TEST(Main, NonlinsolveMultistartNan)
+{
+	float b[2] = { 1, 2 };
+
+	for (uint32_t seed = 0; seed < 20; seed++) {
+		float x[2];
+		uint32_t index;
+		const float residual =
+			nonlinsolve_multistart(func_nan, b, x, 2, 5, -5, seed, 0, 100, &index);
+
+		EXPECT_FALSE(isnan(residual));
+		EXPECT_GE(x[0], 0.0f);
+	}
+}
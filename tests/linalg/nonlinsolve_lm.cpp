@@ -0,0 +1,118 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+// Rosenbrock function as least squares, minimum at (1, 1)
+static void rosenbrock(float *R, const float *const X, uint16_t count, void *ctx)
+{
+	uint16_t *points = (uint16_t *)ctx;
+
+	for (uint16_t k = 0; k < count; k++) {
+		R[2 * k] = 10.0f * (X[2 * k + 1] - X[2 * k] * X[2 * k]);
+		R[2 * k + 1] = 1.0f - X[2 * k];
+	}
+	*points += count;
+}
+
+static void rosenbrock_jacobian(float *J, const float *const x, void *ctx)
+{
+	(void)ctx;
+	J[0] = -20.0f * x[0];
+	J[1] = 10.0f;
+	J[2] = -1.0f;
+	J[3] = 0.0f;
+}
+
+// Fit y = a*exp(b*t) to samples of a = 2, b = -0.5
+static const float t[8] = { 0, 0.5f, 1, 1.5f, 2, 2.5f, 3, 3.5f };
+
+static void exponential(float *R, const float *const X, uint16_t count, void *ctx)
+{
+	(void)ctx;
+	for (uint16_t k = 0; k < count; k++)
+		for (uint16_t i = 0; i < 8; i++)
+			R[8 * k + i] = X[2 * k] * expf(X[2 * k + 1] * t[i]) -
+				       2.0f * expf(-0.5f * t[i]);
+}
+
+TEST(Main, NonlinsolveLmRosenbrock)
+{
+	struct nonlinsolve_lm_options options = {};
+	struct nonlinsolve_lm_stats stats;
+	float x[2] = { -1.2f, 1.0f };
+	uint16_t points = 0;
+
+	options.tolerance = 1e-6f;
+	options.gradient_tolerance = 1e-6f;
+	options.lambda = 1e-3f;
+	options.max_iterations = 100;
+	EXPECT_EQ(nonlinsolve_lm(x, rosenbrock, &points, 2, 2, &options, &stats), 0);
+	EXPECT_NEAR(1.0f, x[0], 1e-4);
+	EXPECT_NEAR(1.0f, x[1], 1e-4);
+	EXPECT_LT(stats.iterations, 50);
+	EXPECT_EQ(stats.evaluations, points);
+	EXPECT_LT(stats.residual, 1e-4);
+
+	// Analytic Jacobian needs no extra evaluations
+	x[0] = -1.2f;
+	x[1] = 1.0f;
+	points = 0;
+	options.jacobian = rosenbrock_jacobian;
+	EXPECT_EQ(nonlinsolve_lm(x, rosenbrock, &points, 2, 2, &options, &stats), 0);
+	EXPECT_NEAR(1.0f, x[0], 1e-4);
+	EXPECT_NEAR(1.0f, x[1], 1e-4);
+	EXPECT_EQ(stats.evaluations, 1u + stats.iterations);
+}
+
+TEST(Main, NonlinsolveLmGaussNewton)
+{
+	struct nonlinsolve_lm_options options = {};
+	struct nonlinsolve_lm_stats stats;
+	float x[2] = { 1.0f, 0.0f };
+
+	// Zero residual problem, Gauss-Newton converges quadratically
+	options.tolerance = 1e-6f;
+	options.max_iterations = 50;
+	EXPECT_EQ(nonlinsolve_lm(x, exponential, NULL, 8, 2, &options, &stats), 0);
+	EXPECT_NEAR(2.0f, x[0], 1e-4);
+	EXPECT_NEAR(-0.5f, x[1], 1e-4);
+	EXPECT_LT(stats.iterations, 20);
+	EXPECT_LT(stats.residual, 1e-4);
+}
+
+TEST(Main, NonlinsolveLmStatus)
+{
+	struct nonlinsolve_lm_options options = {};
+	struct nonlinsolve_lm_stats stats;
+	float x[2] = { -1.2f, 1.0f };
+	uint16_t points = 0;
+
+	options.tolerance = 1e-6f;
+	options.lambda = 1e-3f;
+	options.max_iterations = 1;
+	EXPECT_EQ(nonlinsolve_lm(x, rosenbrock, &points, 2, 2, &options, &stats), -ENOTSUP);
+	EXPECT_EQ(stats.status, NONLINSOLVE_MAX_ITERATIONS);
+	EXPECT_EQ(stats.iterations, 1);
+
+	// Already at the solution
+	x[0] = 1.0f;
+	x[1] = 1.0f;
+	options.max_iterations = 10;
+	EXPECT_EQ(nonlinsolve_lm(x, rosenbrock, &points, 2, 2, &options, &stats), 0);
+	EXPECT_EQ(stats.status, NONLINSOLVE_GRADIENT);
+	EXPECT_EQ(stats.iterations, 0);
+
+	EXPECT_EQ(nonlinsolve_lm(x, rosenbrock, &points, 0, 2, &options, &stats), -EINVAL);
+	EXPECT_EQ(nonlinsolve_lm(x, rosenbrock, &points, 2, 2, NULL, &stats), -EINVAL);
+}
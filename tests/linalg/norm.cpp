@@ -20,3 +20,44 @@ TEST(Main, Norm)
 	EXPECT_NEAR(6, norm(A, 2, 2, 1), 1e-4);
 	EXPECT_NEAR(5.4650, norm(A, 2, 2, 2), 1e-4);
 }
+
+TEST(Main, NormNegativeFirstRow)
+{
+	float A[2 * 2] = { -1, -2, 3, 4 };
+
+	EXPECT_NEAR(6, norm(A, 2, 2, 1), 1e-4);
+}
+
+TEST(Main, Norm2Estimate)
+{
+	// clang-format off
+	float A[5 * 3] = {
+		 1.0,  2.0,  3.0,
+		-1.0,  0.5,  4.0,
+		 2.0, -3.0,  1.0,
+		 0.0,  1.0, -2.0,
+		 5.0,  0.3,  0.7
+	};
+	// clang-format on
+	float U[5 * 3], S[3], V[3 * 3];
+	float At[3 * 5];
+
+	ASSERT_EQ(svd_jacobi(A, 5, 3, MAX_ITERATION_COUNT_SVD, U, S, V), 0);
+	EXPECT_NEAR(S[0], norm2_estimate(A, 5, 3, 1e-7f, 100), 1e-4 * S[0]);
+	EXPECT_NEAR(S[0], norm(A, 5, 3, 2), 1e-3 * S[0]);
+
+	// Same singular values for the wide matrix
+	tran(At, A, 5, 3);
+	EXPECT_NEAR(S[0], norm2_estimate(At, 3, 5, 1e-7f, 100), 1e-4 * S[0]);
+
+	// A single iteration already gives a lower bound
+	EXPECT_LE(norm2_estimate(A, 5, 3, 0.0f, 1), S[0] * (1.0f + 1e-5f));
+
+	float Z[2 * 2] = { 0, 0, 0, 0 };
+
+	EXPECT_EQ(norm2_estimate(Z, 2, 2, 1e-6f, 10), 0.0f);
+
+	// Empty matrices have norm zero
+	EXPECT_EQ(norm2_estimate(Z, 2, 0, 1e-6f, 10), 0.0f);
+	EXPECT_EQ(norm2_estimate(Z, 0, 2, 1e-6f, 10), 0.0f);
+}
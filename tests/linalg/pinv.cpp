@@ -6,6 +6,8 @@
  * Training: https://swedishembedded.com/tag/training
  */
 
+#include <errno.h>
+#include <math.h>
 #include <stdio.h>
 #include <gtest/gtest.h>
 
@@ -70,4 +72,56 @@ TEST(Main, PseudoInverse)
 	for (unsigned int c = 0; c < 5 * 5; c++) {
 		EXPECT_NEAR(Bi_exp[c], Bi[c], 1e-3);
 	}
+	// When row < column, pinv(A') = pinv(A)'
+	float At[5 * 10];
+	float Ati[10 * 5];
+
+	tran(At, A, 10, 5);
+	pinv(Ati, At, 5, 10);
+
+	for (unsigned int i = 0; i < 10; i++) {
+		for (unsigned int j = 0; j < 5; j++) {
+			EXPECT_NEAR(Ai_exp[10 * j + i], Ati[5 * i + j], 1e-3);
+		}
+	}
+}
+
+TEST(Main, PseudoInverseTruncated)
+{
+	// Third column is the sum of the first two, rank 2
+	// clang-format off
+	float A[4 * 3] = {
+		1.0,  2.0, 3.0,
+		0.0,  1.0, 1.0,
+		2.0, -1.0, 1.0,
+		1.0,  1.0, 2.0
+	};
+	// clang-format on
+	float Ai[3 * 4], Af[3 * 4], A1[3 * 4];
+	float AAiA[4 * 3], AAi[4 * 4];
+
+	// The zero singular value is dropped by the default cutoff
+	EXPECT_EQ(pinv_truncated(Ai, A, 4, 3, 0.0f, 3), 2);
+	pinv(Af, A, 4, 3);
+	for (unsigned int c = 0; c < 3 * 4; c++)
+		EXPECT_FLOAT_EQ(Af[c], Ai[c]);
+
+	// A*pinv(A)*A = A
+	mul(AAi, A, Ai, 4, 3, 3, 4);
+	mul(AAiA, AAi, A, 4, 4, 4, 3);
+	for (unsigned int c = 0; c < 4 * 3; c++)
+		EXPECT_NEAR(A[c], AAiA[c], 1e-4);
+
+	// Rank one truncation keeps only the largest singular value
+	EXPECT_EQ(pinv_truncated(A1, A, 4, 3, 0.0f, 1), 1);
+	EXPECT_EQ(pinv_truncated(A1, A, 4, 3, 0.9f, 3), 1);
+
+	// NaN keeps the SVD from converging, nothing is kept
+	float U[4 * 3], S[3], V[3 * 3];
+
+	A[4] = NAN;
+	EXPECT_EQ(svd_jacobi(A, 4, 3, MAX_ITERATION_COUNT_SVD, U, S, V), -ENOTSUP);
+	EXPECT_EQ(pinv_truncated(A1, A, 4, 3, 0.0f, 3), 0);
+	for (unsigned int c = 0; c < 3 * 4; c++)
+		EXPECT_EQ(A1[c], 0.0f);
 }
@@ -0,0 +1,87 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+/*
+ * GNU Octave code:
+A = [4 -2 1; 3 6 -4; 2 1 8];
+1 / (norm(A, 1) * norm(inv(A), 1))
+ */
+TEST(Main, RcondLup)
+{
+	float A[3 * 3] = { 4, -2, 1, 3, 6, -4, 2, 1, 8 };
+	float LU[3 * 3], Ai[3 * 3];
+	uint8_t P[3];
+
+	ASSERT_EQ(lup(A, LU, P, 3), 0);
+	ASSERT_EQ(inv(Ai, A, 3), 0);
+
+	const float exact = 1.0f / (norm(A, 3, 3, 1) * norm(Ai, 3, 3, 1));
+	const float estimate = rcond_lup(LU, P, 3, norm(A, 3, 3, 1));
+
+	// norm(inv(A), 1) is underestimated so rcond is bounded from below by the true value
+	EXPECT_NEAR(0.217535, exact, 1e-5);
+	EXPECT_GE(estimate, exact * 0.999f);
+	EXPECT_LE(estimate, exact * 3.0f);
+}
+
+TEST(Main, RcondLupIllConditioned)
+{
+	// clang-format off
+	float A[4 * 4] = {
+		1.0,  2.0, 3.0, 4.0,
+		2.0,  4.0, 6.0, 8.001,
+		0.5, -1.0, 2.0, 0.0,
+		3.0,  1.0, 0.0, 1.0
+	};
+	// clang-format on
+	float LU[4 * 4], Ai[4 * 4];
+	uint8_t P[4];
+
+	ASSERT_EQ(lup(A, LU, P, 4), 0);
+	ASSERT_EQ(inv(Ai, A, 4), 0);
+
+	const float anorm = norm(A, 4, 4, 1);
+	const float exact = 1.0f / (anorm * norm(Ai, 4, 4, 1));
+	const float estimate = rcond_lup(LU, P, 4, anorm);
+
+	// Never smaller than the true reciprocal condition number and within an order of magnitude
+	EXPECT_LT(estimate, 1e-3f);
+	EXPECT_GE(estimate, exact * 0.999f);
+	EXPECT_LE(estimate, exact * 10.0f);
+}
+
+/*
+ * GNU Octave code:
+A = [4 1 0; 1 3 1; 0 1 2];
+rcond(A)
+ */
+TEST(Main, RcondChol)
+{
+	float A[3 * 3] = { 4, 1, 0, 1, 3, 1, 0, 1, 2 };
+	float L[3 * 3], Ai[3 * 3];
+
+	chol(A, L, 3);
+	ASSERT_EQ(inv(Ai, A, 3), 0);
+
+	const float exact = 1.0f / (norm(A, 3, 3, 1) * norm(Ai, 3, 3, 1));
+
+	EXPECT_NEAR(exact, rcond_chol(L, 3, norm(A, 3, 3, 1)), 1e-4);
+}
+
+TEST(Main, RcondSingular)
+{
+	float L[2 * 2] = { 1, 0, 2, 0 };
+
+	EXPECT_EQ(rcond_chol(L, 2, 3.0f), 0.0f);
+}
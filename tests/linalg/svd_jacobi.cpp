@@ -0,0 +1,141 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+// Check that A = U*S*V' and that the columns of U and V are orthonormal
+static void check_svd(const float *A, const float *U, const float *S, const float *V,
+		      uint16_t row, uint16_t column)
+{
+	const uint16_t k = row < column ? row : column;
+
+	for (uint16_t i = 0; i < row; i++) {
+		for (uint16_t j = 0; j < column; j++) {
+			float sum = 0.0f;
+
+			for (uint16_t l = 0; l < k; l++)
+				sum += U[k * i + l] * S[l] * V[k * j + l];
+			EXPECT_NEAR(A[column * i + j], sum, 1e-4);
+		}
+	}
+	for (uint16_t a = 0; a < k; a++) {
+		for (uint16_t b = 0; b < k; b++) {
+			float uu = 0.0f, vv = 0.0f;
+
+			for (uint16_t i = 0; i < row; i++)
+				uu += U[k * i + a] * U[k * i + b];
+			for (uint16_t j = 0; j < column; j++)
+				vv += V[k * j + a] * V[k * j + b];
+			EXPECT_NEAR(a == b ? 1.0f : 0.0f, uu, 1e-4);
+			EXPECT_NEAR(a == b ? 1.0f : 0.0f, vv, 1e-4);
+		}
+	}
+	for (uint16_t l = 1; l < k; l++)
+		EXPECT_GE(S[l - 1], S[l]);
+}
+
+/*
+ * GNU Octave code:
+A = [0.453690,   0.866686,   0.579250,   0.418100,
+0.059901,   0.954740,   0.699338,   0.681427,
+0.127995,   0.981347,   0.713651,   0.485167,
+0.269875,   0.723569,   0.778578,   0.130682];
+
+s = svd(A)
+ */
+TEST(Main, SvdJacobiSquare)
+{
+	// clang-format off
+	float A[4 * 4] = {
+		0.453690, 0.866686, 0.579250, 0.418100,
+		0.059901, 0.954740, 0.699338, 0.681427,
+		0.127995, 0.981347, 0.713651, 0.485167,
+		0.269875, 0.723569, 0.778578, 0.130682
+	};
+	float S_exp[4] = { 2.453708, 0.424704, 0.272155, 0.066927 };
+	// clang-format on
+	float U[4 * 4], S[4], V[4 * 4];
+
+	// Converges well before the sweep limit
+	ASSERT_EQ(svd_jacobi(A, 4, 4, 10, U, S, V), 0);
+	for (unsigned int c = 0; c < 4; c++)
+		EXPECT_NEAR(S_exp[c], S[c], 1e-5);
+	check_svd(A, U, S, V, 4, 4);
+}
+
+TEST(Main, SvdJacobiRectangular)
+{
+	// clang-format off
+	float A[7 * 3] = {
+		 1.0,  2.0,  3.0,
+		-1.0,  0.5,  4.0,
+		 2.0, -3.0,  1.0,
+		 0.0,  1.0, -2.0,
+		 5.0,  0.3,  0.7,
+		-2.0,  1.5,  0.0,
+		 0.1, -0.4,  2.5
+	};
+	// clang-format on
+	float At[3 * 7];
+	float U[7 * 3], S[3], V[3 * 3];
+	float Ut[3 * 3], St[3], Vt[7 * 3];
+
+	// Tall matrix goes through QR
+	ASSERT_EQ(svd_jacobi(A, 7, 3, MAX_ITERATION_COUNT_SVD, U, S, V), 0);
+	check_svd(A, U, S, V, 7, 3);
+
+	// Wide matrix is handled through its transpose
+	tran(At, A, 7, 3);
+	ASSERT_EQ(svd_jacobi(At, 3, 7, MAX_ITERATION_COUNT_SVD, Ut, St, Vt), 0);
+	check_svd(At, Ut, St, Vt, 3, 7);
+
+	for (unsigned int c = 0; c < 3; c++)
+		EXPECT_NEAR(S[c], St[c], 1e-5);
+}
+
+TEST(Main, SvdJacobiRankDeficient)
+{
+	// Third column is the sum of the first two
+	// clang-format off
+	float A[5 * 3] = {
+		1.0,  2.0,  3.0,
+		0.0,  1.0,  1.0,
+		2.0, -1.0,  1.0,
+		1.0,  1.0,  2.0,
+		3.0,  0.0,  3.0
+	};
+	// clang-format on
+	float U[5 * 3], S[3], V[3 * 3];
+
+	ASSERT_EQ(svd_jacobi(A, 5, 3, MAX_ITERATION_COUNT_SVD, U, S, V), 0);
+	EXPECT_NEAR(S[2], 0.0f, 1e-5);
+
+	for (uint16_t i = 0; i < 5; i++) {
+		for (uint16_t j = 0; j < 3; j++) {
+			float sum = 0.0f;
+
+			for (uint16_t l = 0; l < 3; l++)
+				sum += U[3 * i + l] * S[l] * V[3 * j + l];
+			EXPECT_NEAR(A[3 * i + j], sum, 1e-4);
+		}
+	}
+}
+
+TEST(Main, SvdJacobiInvalid)
+{
+	float A[1] = { 1.0 };
+	float U[1], S[1], V[1];
+
+	EXPECT_EQ(svd_jacobi(A, 0, 1, 10, U, S, V), -EINVAL);
+	EXPECT_EQ(svd_jacobi(A, 1, 0, 10, U, S, V), -EINVAL);
+}
@@ -0,0 +1,103 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+struct dense {
+	const float *A;
+	uint16_t row;
+	uint16_t column;
+};
+
+static void dense_operator(float *y, const float *const x, bool transposed, void *ctx)
+{
+	const struct dense *d = (const struct dense *)ctx;
+
+	if (!transposed) {
+		mul(y, d->A, x, d->row, d->column, d->column, 1);
+		return;
+	}
+	for (uint16_t j = 0; j < d->column; j++) {
+		y[j] = 0.0f;
+		for (uint16_t i = 0; i < d->row; i++)
+			y[j] += d->A[d->column * i + j] * x[i];
+	}
+}
+
+TEST(Main, SvdLanczos)
+{
+	const uint16_t m = 12, n = 8, k = 3;
+	float A[12 * 8];
+	float U[12 * 3], S[3], V[8 * 3];
+	float Uj[12 * 8], Sj[8], Vj[8 * 8];
+	struct dense d = { A, m, n };
+
+	// Quickly decaying spectrum like a Hankel matrix of an impulse response
+	for (uint16_t i = 0; i < m; i++)
+		for (uint16_t j = 0; j < n; j++)
+			A[n * i + j] = powf(0.8f, i + j) + 0.3f * powf(-0.5f, i + j) +
+				       0.01f * sinf(i * 1.3f + j);
+
+	ASSERT_EQ(svd_jacobi(A, m, n, MAX_ITERATION_COUNT_SVD, Uj, Sj, Vj), 0);
+	ASSERT_EQ(svd_lanczos(dense_operator, &d, m, n, k, n, U, S, V), 0);
+
+	for (uint16_t l = 0; l < k; l++) {
+		EXPECT_NEAR(Sj[l], S[l], 1e-4 * Sj[0]);
+
+		// A*v = s*u for every triplet
+		float v[8], Av[12];
+
+		for (uint16_t j = 0; j < n; j++)
+			v[j] = V[k * j + l];
+		dense_operator(Av, v, false, &d);
+		for (uint16_t i = 0; i < m; i++)
+			EXPECT_NEAR(Av[i], S[l] * U[k * i + l], 1e-4);
+	}
+
+	// Fewer steps still find the dominant singular value
+	ASSERT_EQ(svd_lanczos(dense_operator, &d, m, n, 1, 4, U, S, V), 0);
+	EXPECT_NEAR(Sj[0], S[0], 1e-3 * Sj[0]);
+}
+
+TEST(Main, SvdLanczosHankel)
+{
+	// Impulse response of two decaying modes
+	float g[1 * 64];
+	float storage[hankel_operator_storage_size(1, 32, 32)];
+	struct hankel_operator H;
+	float U[32 * 2], S[2], V[32 * 2];
+
+	for (uint16_t t = 0; t < 64; t++)
+		g[t] = powf(0.9f, t) - 0.5f * powf(0.6f, t);
+
+	ASSERT_EQ(hankel_operator_init(&H, g, 1, 64, 32, 32, 1, storage), 0);
+	ASSERT_EQ(svd_lanczos(hankel_operator, &H, 32, 32, 2, 8, U, S, V), 0);
+
+	float Hd[32 * 32], Uj[32 * 32], Sj[32], Vj[32 * 32];
+
+	hankel(g, Hd, 1, 64, 32, 32, 1);
+	ASSERT_EQ(svd_jacobi(Hd, 32, 32, MAX_ITERATION_COUNT_SVD, Uj, Sj, Vj), 0);
+	EXPECT_NEAR(Sj[0], S[0], 1e-3 * Sj[0]);
+	EXPECT_NEAR(Sj[1], S[1], 1e-3 * Sj[0]);
+}
+
+TEST(Main, SvdLanczosInvalid)
+{
+	float A[1] = { 1 };
+	struct dense d = { A, 1, 1 };
+	float U[1], S[1], V[1];
+
+	EXPECT_EQ(svd_lanczos(dense_operator, &d, 1, 1, 0, 1, U, S, V), -EINVAL);
+	EXPECT_EQ(svd_lanczos(dense_operator, &d, 1, 1, 2, 2, U, S, V), -EINVAL);
+}
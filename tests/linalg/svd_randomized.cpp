@@ -0,0 +1,70 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+};
+
+TEST(Main, SvdRandomized)
+{
+	// A = X * Y' has rank 3 exactly
+	const uint16_t row = 40, column = 30, rank = 3;
+	float X[row * rank], Y[column * rank], A[row * column];
+	uint32_t seed = 7;
+
+	for (uint16_t i = 0; i < row * rank; i++) {
+		seed = seed * 1103515245u + 12345u;
+		X[i] = (float)((seed >> 8) & 0xffff) / 65536.0f - 0.5f;
+	}
+	for (uint16_t i = 0; i < column * rank; i++) {
+		seed = seed * 1103515245u + 12345u;
+		Y[i] = (float)((seed >> 8) & 0xffff) / 65536.0f - 0.5f;
+	}
+	for (uint16_t i = 0; i < row; i++)
+		for (uint16_t j = 0; j < column; j++) {
+			A[column * i + j] = 0;
+			for (uint16_t k = 0; k < rank; k++)
+				A[column * i + j] += X[rank * i + k] * Y[rank * j + k];
+		}
+
+	float U[row * rank], S[rank], V[column * rank];
+	float Uf[row * column], Sf[column], Vf[column * column];
+
+	ASSERT_EQ(0, svd_randomized(A, row, column, rank, 5, 1, U, S, V));
+	ASSERT_EQ(0, svd_golub_reinsch(A, row, column, Uf, Sf, Vf));
+
+	// Same leading singular values as the full decomposition
+	for (uint16_t k = 0; k < rank; k++)
+		EXPECT_NEAR(Sf[k], S[k], 1e-4);
+
+	// A = U * S * V'
+	for (uint16_t i = 0; i < row; i++)
+		for (uint16_t j = 0; j < column; j++) {
+			float a = 0;
+
+			for (uint16_t k = 0; k < rank; k++)
+				a += U[rank * i + k] * S[k] * V[rank * j + k];
+			EXPECT_NEAR(A[column * i + j], a, 1e-4);
+		}
+
+	// Columns of U are orthonormal
+	for (uint16_t p = 0; p < rank; p++)
+		for (uint16_t q = 0; q < rank; q++) {
+			float dot = 0;
+
+			for (uint16_t i = 0; i < row; i++)
+				dot += U[rank * i + p] * U[rank * i + q];
+			EXPECT_NEAR(p == q ? 1.0f : 0.0f, dot, 1e-4);
+		}
+
+	EXPECT_EQ(-EINVAL, svd_randomized(A, row, column, 0, 5, 1, U, S, V));
+	EXPECT_EQ(-EINVAL, svd_randomized(A, row, column, column + 1, 5, 1, U, S, V));
+}
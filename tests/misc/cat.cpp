@@ -37,3 +37,27 @@ TEST(Main, Cat)
 		ASSERT_FLOAT_EQ(C_exp[c], C[c]);
 	}
 }
+
+TEST(Main, CatThreeRows)
+{
+	// clang-format off
+	float A[3 * 1] = { 1, 2, 3 };
+	float B[3 * 2] = {
+		4, 5,
+		6, 7,
+		8, 9
+	};
+	float C[3 * 3] = { 0 };
+	float C_exp[3 * 3] = {
+		1, 4, 5,
+		2, 6, 7,
+		3, 8, 9
+	};
+	// clang-format on
+
+	cat(C, A, B, 0, 3, 1, 3, 2, 3, 3); /* do C = [A B] */
+
+	for (unsigned int c = 0; c < 3 * 3; c++) {
+		ASSERT_FLOAT_EQ(C_exp[c], C[c]);
+	}
+}
@@ -43,3 +43,16 @@ TEST(Main, Cut)
 		}
 	}
 }
+
+TEST(Main, CutRowsBelowBlock)
+{
+	float A[4 * 3] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+	float B[2 * 2] = { 0, 0, 0, 0 };
+
+	// row is smaller than start_row + row_b, the block is still copied in full
+	cut(B, A, 2, 3, 2, 1, 2, 2);
+	EXPECT_EQ(B[0], 8.0f);
+	EXPECT_EQ(B[1], 9.0f);
+	EXPECT_EQ(B[2], 11.0f);
+	EXPECT_EQ(B[3], 12.0f);
+}
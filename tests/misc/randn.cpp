@@ -7,6 +7,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <gtest/gtest.h>
 
 extern "C" {
@@ -20,3 +21,18 @@ TEST(Main, Randn)
 	EXPECT_NEAR(4, mean(x, 10), 1);
 	EXPECT_NEAR(2, stddev(x, 10), 1);
 }
+
+TEST(Main, RandnSrand)
+{
+	float a[8], b[8], c[8];
+
+	// The same seed repeats the draws, later calls continue the sequence
+	srand(1);
+	randn(a, 8, 0, 1);
+	randn(c, 8, 0, 1);
+	srand(1);
+	randn(b, 8, 0, 1);
+	for (int i = 0; i < 8; i++)
+		EXPECT_EQ(a[i], b[i]);
+	EXPECT_NE(a[0], c[0]);
+}
@@ -0,0 +1,108 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/misc.h"
+};
+
+TEST(Main, RngKnownAnswer)
+{
+	// Philox4x32-10 with zero key and counter from the Random123 test vectors
+	struct rng stream;
+
+	rng_init(&stream, 0, 0);
+	EXPECT_EQ(rng_next(&stream), 0x6627e8d5u);
+	EXPECT_EQ(rng_next(&stream), 0xe169c58du);
+	EXPECT_EQ(rng_next(&stream), 0xbc57ac4cu);
+	EXPECT_EQ(rng_next(&stream), 0x9b00dbd8u);
+}
+
+TEST(Main, RngStreams)
+{
+	struct rng a, b, c;
+	uint32_t wa[37], wb[37];
+
+	// Bulk fill gives the same words as single steps, whatever the alignment
+	rng_init(&a, 42, 3);
+	rng_init(&b, 42, 3);
+	rng_next(&a);
+	rng_next(&b);
+	rng_fill(&a, wa, 37);
+	for (int i = 0; i < 37; i++)
+		wb[i] = rng_next(&b);
+	for (int i = 0; i < 37; i++)
+		EXPECT_EQ(wa[i], wb[i]);
+
+	// Seeking reaches the same words
+	rng_init(&c, 42, 3);
+	rng_seek(&c, 11);
+	EXPECT_EQ(rng_next(&c), wb[10]);
+	rng_seek(&c, 16);
+	EXPECT_EQ(rng_next(&c), wb[15]);
+
+	// Other streams and seeds give other words
+	rng_init(&a, 42, 4);
+	rng_init(&b, 43, 3);
+	rng_init(&c, 42, 3);
+	const uint32_t x = rng_next(&c);
+
+	EXPECT_NE(x, rng_next(&a));
+	EXPECT_NE(x, rng_next(&b));
+}
+
+TEST(Main, RngUniform)
+{
+	struct rng stream;
+	float x[1000];
+	float sum = 0.0f;
+
+	rng_init(&stream, 7, 0);
+	rng_fill_uniform(&stream, x, 1000, -2.0f, 3.0f);
+	for (int i = 0; i < 1000; i++) {
+		EXPECT_GE(x[i], -2.0f);
+		EXPECT_LT(x[i], 3.0f);
+		sum += x[i];
+	}
+	EXPECT_NEAR(0.5f, sum / 1000, 0.2f);
+
+	const float u = rng_uniform(&stream);
+
+	EXPECT_GE(u, 0.0f);
+	EXPECT_LT(u, 1.0f);
+}
+
+TEST(Main, RngNormal)
+{
+	const uint32_t n = 100001;
+	static float x[100001];
+	struct rng stream;
+	double sum = 0.0, sum2 = 0.0;
+
+	rng_init(&stream, 1234, 0);
+	rng_fill_normal(&stream, x, n, 4.0f, 2.0f);
+	for (uint32_t i = 0; i < n; i++) {
+		ASSERT_TRUE(isfinite(x[i]));
+		sum += x[i];
+		sum2 += (double)x[i] * x[i];
+	}
+
+	const double m = sum / n;
+
+	EXPECT_NEAR(4.0, m, 0.03);
+	EXPECT_NEAR(2.0, sqrt(sum2 / n - m * m), 0.03);
+
+	// Same seed and stream reproduce the sequence
+	float y[3];
+
+	rng_init(&stream, 1234, 0);
+	rng_fill_normal(&stream, y, 3, 4.0f, 2.0f);
+	for (int i = 0; i < 3; i++)
+		EXPECT_EQ(x[i], y[i]);
+}
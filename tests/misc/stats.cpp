@@ -0,0 +1,114 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <algorithm>
+#include <math.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/misc.h"
+};
+
+TEST(Main, Stats)
+{
+	// clang-format off
+	float x[10] = {
+		3, 11, -8, 1, 4,
+		8, 9,   2, 5, 3
+	};
+	// clang-format on
+	struct stats a, b;
+
+	stats_init(&a);
+	EXPECT_EQ(stats_variance(&a), 0.0f);
+	for (int i = 0; i < 10; i++)
+		stats_update(&a, x[i]);
+	EXPECT_EQ(a.count, 10u);
+	EXPECT_NEAR(3.8f, a.mean, 1e-5);
+	EXPECT_NEAR(5.2662f, stats_stddev(&a), 1e-4);
+	EXPECT_EQ(-8.0f, a.min);
+	EXPECT_EQ(11.0f, a.max);
+
+	stats_init(&b);
+	stats_update_block(&b, x, 10);
+	EXPECT_NEAR(a.mean, b.mean, 1e-5);
+	EXPECT_NEAR(stats_variance(&a), stats_variance(&b), 1e-4);
+	EXPECT_EQ(a.min, b.min);
+	EXPECT_EQ(a.max, b.max);
+}
+
+TEST(Main, StatsMerge)
+{
+	const uint32_t n = 10000;
+	static float x[10000];
+	struct rng stream;
+	struct stats all, parts[3], merged;
+
+	rng_init(&stream, 3, 0);
+	// Large offset makes the naive sum of squares useless
+	rng_fill_normal(&stream, x, n, 1000.0f, 0.5f);
+
+	stats_init(&all);
+	stats_update_block(&all, x, n);
+
+	const uint32_t bounds[4] = { 0, 1, 6789, n };
+
+	stats_init(&merged);
+	for (int k = 0; k < 3; k++) {
+		stats_init(&parts[k]);
+		stats_update_block(&parts[k], &x[bounds[k]], bounds[k + 1] - bounds[k]);
+	}
+	for (int k = 2; k >= 0; k--)
+		stats_merge(&merged, &parts[k]);
+
+	double mu = 0.0, m2 = 0.0;
+
+	for (uint32_t i = 0; i < n; i++)
+		mu += x[i];
+	mu /= n;
+	for (uint32_t i = 0; i < n; i++)
+		m2 += (x[i] - mu) * (x[i] - mu);
+
+	EXPECT_EQ(all.count, (uint64_t)n);
+	EXPECT_EQ(merged.count, (uint64_t)n);
+	EXPECT_NEAR(mu, all.mean, 1e-3);
+	EXPECT_NEAR(mu, merged.mean, 1e-3);
+	EXPECT_NEAR(sqrt(m2 / (n - 1)), stats_stddev(&all), 1e-3);
+	EXPECT_NEAR(sqrt(m2 / (n - 1)), stats_stddev(&merged), 1e-3);
+	EXPECT_EQ(all.min, merged.min);
+	EXPECT_EQ(all.max, merged.max);
+}
+
+TEST(Main, P2Quantile)
+{
+	const uint32_t n = 20000;
+	static float x[20000];
+	struct rng stream;
+	struct p2_quantile median, q90;
+
+	rng_init(&stream, 11, 0);
+	rng_fill_uniform(&stream, x, n, 0.0f, 10.0f);
+
+	p2_quantile_init(&median, 0.5f);
+	p2_quantile_init(&q90, 0.9f);
+	EXPECT_TRUE(isnan(p2_quantile_value(&median)));
+
+	// Few samples give exact order statistics
+	const float few[3] = { 3.0f, 1.0f, 2.0f };
+
+	p2_quantile_update_block(&median, few, 3);
+	EXPECT_EQ(2.0f, p2_quantile_value(&median));
+
+	p2_quantile_init(&median, 0.5f);
+	p2_quantile_update_block(&median, x, n);
+	for (uint32_t i = 0; i < n; i++)
+		p2_quantile_update(&q90, x[i]);
+
+	std::sort(x, x + n);
+	EXPECT_NEAR(x[n / 2], p2_quantile_value(&median), 0.1f);
+	EXPECT_NEAR(x[9 * n / 10], p2_quantile_value(&q90), 0.1f);
+}
@@ -0,0 +1,57 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/sparse.h"
+};
+
+TEST(Main, CscFromDenseAndCsr)
+{
+	// clang-format off
+	float A[3 * 3] = {
+		4, 0, 1,
+		0, 5, 0,
+		2, 0, 6
+	};
+	// clang-format on
+	uint32_t row_ptr[3 + 1], col_ptr[3 + 1], col_ptr2[3 + 1];
+	uint16_t col_idx[5], row_idx[5], row_idx2[5];
+	float values[5], values_c[5], values_c2[5];
+	float B[3 * 3];
+	struct sparse_csr R;
+	struct sparse_csc C, D;
+
+	ASSERT_EQ(csc_init(&C, 3, 3, col_ptr, row_idx, values_c, 5), 0);
+	ASSERT_EQ(csc_from_dense(&C, A, 0), 0);
+	EXPECT_EQ(C.nnz, 5u);
+	EXPECT_EQ(col_ptr[1], 2u);
+	EXPECT_EQ(row_idx[1], 2);
+
+	csc_to_dense(B, &C);
+	for (unsigned int c = 0; c < 3 * 3; c++)
+		EXPECT_FLOAT_EQ(A[c], B[c]);
+
+	// Converting from CSR gives the same layout as converting from dense
+	csr_init(&R, 3, 3, row_ptr, col_idx, values, 5);
+	csr_from_dense(&R, A, 0);
+	csc_init(&D, 3, 3, col_ptr2, row_idx2, values_c2, 5);
+	ASSERT_EQ(csc_from_csr(&D, &R), 0);
+	for (unsigned int j = 0; j <= 3; j++)
+		EXPECT_EQ(col_ptr[j], col_ptr2[j]);
+	for (unsigned int k = 0; k < 5; k++) {
+		EXPECT_EQ(row_idx[k], row_idx2[k]);
+		EXPECT_FLOAT_EQ(values_c[k], values_c2[k]);
+	}
+
+	csc_init(&D, 3, 3, col_ptr2, row_idx2, values_c2, 4);
+	EXPECT_EQ(csc_from_csr(&D, &R), -ENOMEM);
+	csc_init(&D, 3, 2, col_ptr2, row_idx2, values_c2, 5);
+	EXPECT_EQ(csc_from_csr(&D, &R), -EINVAL);
+}
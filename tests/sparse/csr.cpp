@@ -0,0 +1,49 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/sparse.h"
+};
+
+TEST(Main, CsrFromDense)
+{
+	// clang-format off
+	float A[3 * 4] = {
+		1, 0, 0, 2,
+		0, 0, 0, 0,
+		0, 3, 1e-6, 4
+	};
+	// clang-format on
+	uint32_t row_ptr[3 + 1];
+	uint16_t col_idx[5];
+	float values[5];
+	float B[3 * 4];
+	struct sparse_csr S;
+
+	ASSERT_EQ(csr_init(&S, 3, 4, row_ptr, col_idx, values, 5), 0);
+	ASSERT_EQ(csr_from_dense(&S, A, 1e-5), 0);
+	EXPECT_EQ(S.nnz, 4u);
+	EXPECT_EQ(row_ptr[0], 0u);
+	EXPECT_EQ(row_ptr[1], 2u);
+	EXPECT_EQ(row_ptr[2], 2u);
+	EXPECT_EQ(row_ptr[3], 4u);
+	EXPECT_EQ(col_idx[2], 1);
+	EXPECT_FLOAT_EQ(values[3], 4);
+
+	csr_to_dense(B, &S);
+	for (unsigned int c = 0; c < 3 * 4; c++)
+		EXPECT_FLOAT_EQ(c == 10 ? 0.0f : A[c], B[c]);
+
+	// Keeping the small entry needs one more than we have room for
+	ASSERT_EQ(csr_init(&S, 3, 4, row_ptr, col_idx, values, 4), 0);
+	EXPECT_EQ(csr_from_dense(&S, A, 0), -ENOMEM);
+	EXPECT_EQ(S.nnz, 0u);
+	EXPECT_EQ(csr_init(&S, 3, 4, row_ptr, NULL, values, 4), -EINVAL);
+}
@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+#include "control/sparse.h"
+};
+
+// 2D Poisson matrix on a k*k grid
+static void poisson(float *A, uint16_t k)
+{
+	const uint16_t n = k * k;
+
+	memset(A, 0, n * n * sizeof(float));
+	for (uint16_t i = 0; i < n; i++) {
+		A[n * i + i] = 4;
+		if (i % k > 0)
+			A[n * i + i - 1] = -1;
+		if (i % k < k - 1)
+			A[n * i + i + 1] = -1;
+		if (i >= k)
+			A[n * i + i - k] = -1;
+		if (i + k < n)
+			A[n * i + i + k] = -1;
+	}
+}
+
+TEST(Main, SparseIc0)
+{
+	const uint16_t k = 10, n = k * k;
+	static float A[100 * 100];
+	float b[100], x[100];
+	uint32_t row_ptr[101], row_ptr_l[101];
+	uint16_t col_idx[500], col_idx_l[300];
+	float values[500], values_l[300];
+	struct sparse_csr S, L;
+	struct linsolve_options options = {};
+	struct linsolve_stats plain, preconditioned;
+
+	poisson(A, k);
+	for (uint16_t i = 0; i < n; i++)
+		b[i] = 1.0f;
+
+	csr_init(&S, n, n, row_ptr, col_idx, values, 500);
+	ASSERT_EQ(csr_from_dense(&S, A, 0), 0);
+	csr_init(&L, n, n, row_ptr_l, col_idx_l, values_l, 300);
+	ASSERT_EQ(csr_ic0(&L, &S), 0);
+	EXPECT_EQ(L.nnz, (S.nnz + n) / 2);
+
+	options.tolerance = 1e-5f;
+	options.max_iterations = 200;
+
+	memset(x, 0, sizeof(x));
+	ASSERT_EQ(linsolve_cg(x, csr_operator, &S, b, n, &options, &plain), 0);
+
+	options.preconditioner = csr_ic0_preconditioner;
+	options.preconditioner_ctx = &L;
+	memset(x, 0, sizeof(x));
+	ASSERT_EQ(linsolve_cg(x, csr_operator, &S, b, n, &options, &preconditioned), 0);
+	EXPECT_LT(preconditioned.iterations, plain.iterations);
+
+	float r[100];
+
+	csr_spmv(r, &S, x);
+	for (uint16_t i = 0; i < n; i++)
+		EXPECT_NEAR(b[i], r[i], 1e-3);
+
+	// Indefinite matrix has no incomplete Cholesky factor
+	A[0] = -4;
+	csr_from_dense(&S, A, 0);
+	EXPECT_EQ(csr_ic0(&L, &S), -ENOTSUP);
+
+	// Running out of room in L leaves a valid empty matrix
+	csr_init(&L, n, n, row_ptr_l, col_idx_l, values_l, 100);
+	EXPECT_EQ(csr_ic0(&L, &S), -ENOMEM);
+	EXPECT_EQ(L.nnz, 0u);
+	for (uint16_t i = 0; i <= n; i++)
+		EXPECT_EQ(row_ptr_l[i], 0u);
+}
@@ -0,0 +1,70 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/linalg.h"
+#include "control/sparse.h"
+};
+
+TEST(Main, SparseIlu0)
+{
+	// Tridiagonal matrices have no fill-in so ILU(0) is the exact LU
+	// clang-format off
+	float A[4 * 4] = {
+		4, -1, 0, 0,
+		-2, 5, -1, 0,
+		0, -2, 6, -3,
+		0, 0, -1, 3
+	};
+	// clang-format on
+	float b[4] = { 1, 2, 3, 4 };
+	float x[4];
+	uint32_t row_ptr[5], row_ptr_lu[5];
+	uint16_t col_idx[10], col_idx_lu[10];
+	float values[10], values_lu[10];
+	struct sparse_csr S, LU;
+
+	csr_init(&S, 4, 4, row_ptr, col_idx, values, 10);
+	csr_from_dense(&S, A, 0);
+	csr_init(&LU, 4, 4, row_ptr_lu, col_idx_lu, values_lu, 10);
+	ASSERT_EQ(csr_ilu0(&LU, &S), 0);
+
+	csr_ilu0_preconditioner(x, b, 4, &LU);
+	for (unsigned int i = 0; i < 4; i++) {
+		float sum = 0;
+
+		for (unsigned int j = 0; j < 4; j++)
+			sum += A[4 * i + j] * x[j];
+		EXPECT_NEAR(b[i], sum, 1e-5);
+	}
+
+	// An exact preconditioner makes GMRES converge at once
+	struct linsolve_options options = {};
+	struct linsolve_stats stats;
+
+	options.tolerance = 1e-5f;
+	options.max_iterations = 10;
+	options.preconditioner = csr_ilu0_preconditioner;
+	options.preconditioner_ctx = &LU;
+	float work[LINSOLVE_GMRES_WORK_SIZE(4, 0)];
+
+	memset(x, 0, sizeof(x));
+	ASSERT_EQ(linsolve_gmres(x, csr_operator, &S, b, 4, &options, &stats, work), 0);
+	EXPECT_LE(stats.iterations, 2);
+
+	// Missing diagonal
+	A[0] = 0;
+	csr_from_dense(&S, A, 0);
+	EXPECT_EQ(csr_ilu0(&LU, &S), -ENOTSUP);
+	csr_init(&LU, 4, 4, row_ptr_lu, col_idx_lu, values_lu, 4);
+	EXPECT_EQ(csr_ilu0(&LU, &S), -ENOMEM);
+}
@@ -0,0 +1,74 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/sparse.h"
+};
+
+TEST(Main, SparseTriangularSolve)
+{
+	// Cholesky factor of a tridiagonal matrix stays bidiagonal
+	// clang-format off
+	float L[4 * 4] = {
+		2, 0, 0, 0,
+		1, 3, 0, 0,
+		0, -1, 1, 0,
+		0, 0, 2, 4
+	};
+	// clang-format on
+	float b[4] = { 2, 7, 1, 10 };
+	float y[4], x[4], r[4];
+	uint32_t row_ptr[4 + 1], row_ptr_u[4 + 1];
+	uint16_t col_idx[7], col_idx_u[7];
+	float values[7], values_u[7];
+	float U[4 * 4];
+	struct sparse_csr Ls, Us;
+
+	csr_init(&Ls, 4, 4, row_ptr, col_idx, values, 7);
+	ASSERT_EQ(csr_from_dense(&Ls, L, 0), 0);
+
+	ASSERT_EQ(csr_linsolve_lower_triangular(y, &Ls, b), 0);
+	for (unsigned int i = 0; i < 4; i++) {
+		float sum = 0;
+
+		for (unsigned int j = 0; j < 4; j++)
+			sum += L[4 * i + j] * y[j];
+		EXPECT_NEAR(b[i], sum, 1e-5);
+	}
+
+	// L'x = y with the factor stored once
+	ASSERT_EQ(csr_linsolve_lower_triangular_transposed(x, &Ls, y), 0);
+	for (unsigned int i = 0; i < 4; i++) {
+		float sum = 0;
+
+		for (unsigned int j = 0; j < 4; j++)
+			sum += L[4 * j + i] * x[j];
+		EXPECT_NEAR(y[i], sum, 1e-5);
+	}
+
+	// Same as an upper triangular solve with L' stored explicitly
+	for (unsigned int i = 0; i < 4; i++)
+		for (unsigned int j = 0; j < 4; j++)
+			U[4 * i + j] = L[4 * j + i];
+	csr_init(&Us, 4, 4, row_ptr_u, col_idx_u, values_u, 7);
+	csr_from_dense(&Us, U, 0);
+	memcpy(r, y, sizeof(r));
+	ASSERT_EQ(csr_linsolve_upper_triangular(r, &Us, r), 0);
+	for (unsigned int i = 0; i < 4; i++)
+		EXPECT_NEAR(x[i], r[i], 1e-5);
+
+	// Missing diagonal
+	L[4 * 2 + 2] = 0;
+	csr_from_dense(&Ls, L, 0);
+	EXPECT_EQ(csr_linsolve_lower_triangular(y, &Ls, b), -ENOTSUP);
+	Ls.cols = 3;
+	EXPECT_EQ(csr_linsolve_lower_triangular(y, &Ls, b), -EINVAL);
+}
@@ -0,0 +1,51 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/sparse.h"
+};
+
+TEST(Main, SparseMatrixMatrix)
+{
+	// Block lower triangular Toeplitz like the lifted matrices in mpc()
+	// clang-format off
+	float A[4 * 4] = {
+		1, 0, 0, 0,
+		2, 1, 0, 0,
+		3, 2, 1, 0,
+		4, 3, 2, 1
+	};
+	float B[4 * 2] = {
+		1, -1,
+		0, 2,
+		3, 0,
+		1, 1
+	};
+	// clang-format on
+	float C[4 * 2];
+	uint32_t row_ptr[4 + 1];
+	uint16_t col_idx[10];
+	float values[10];
+	struct sparse_csr R;
+
+	csr_init(&R, 4, 4, row_ptr, col_idx, values, 10);
+	ASSERT_EQ(csr_from_dense(&R, A, 0), 0);
+	csr_spmm(C, &R, B, 2);
+
+	for (unsigned int i = 0; i < 4; i++) {
+		for (unsigned int j = 0; j < 2; j++) {
+			float sum = 0;
+
+			for (unsigned int k = 0; k < 4; k++)
+				sum += A[4 * i + k] * B[2 * k + j];
+			EXPECT_FLOAT_EQ(sum, C[2 * i + j]);
+		}
+	}
+}
@@ -0,0 +1,68 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * Copyright 2022 Martin Schröder <info@swedishembedded.com>
+ * Consulting: https://swedishembedded.com/go
+ * Training: https://swedishembedded.com/tag/training
+ */
+
+#include <errno.h>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "control/sparse.h"
+};
+
+TEST(Main, SparseMatrixVector)
+{
+	// clang-format off
+	float A[3 * 4] = {
+		1, 0, 0, 2,
+		0, -1, 0, 0,
+		0, 3, 5, 4
+	};
+	// clang-format on
+	float x[4] = { 1, 2, 3, 4 };
+	float z[3] = { 1, -1, 2 };
+	float y[3], yc[3], w[4];
+	uint32_t row_ptr[3 + 1], col_ptr[4 + 1];
+	uint16_t col_idx[6], row_idx[6];
+	float values[6], values_c[6];
+	struct sparse_csr R;
+	struct sparse_csc C;
+
+	csr_init(&R, 3, 4, row_ptr, col_idx, values, 6);
+	csr_from_dense(&R, A, 0);
+	csc_init(&C, 3, 4, col_ptr, row_idx, values_c, 6);
+	csc_from_dense(&C, A, 0);
+
+	csr_spmv(y, &R, x);
+	csc_spmv(yc, &C, x);
+	for (unsigned int i = 0; i < 3; i++) {
+		float sum = 0;
+
+		for (unsigned int j = 0; j < 4; j++)
+			sum += A[4 * i + j] * x[j];
+		EXPECT_FLOAT_EQ(sum, y[i]);
+		EXPECT_FLOAT_EQ(sum, yc[i]);
+	}
+
+	csr_spmv_transposed(w, &R, z);
+	for (unsigned int j = 0; j < 4; j++) {
+		float sum = 0;
+
+		for (unsigned int i = 0; i < 3; i++)
+			sum += A[4 * i + j] * z[i];
+		EXPECT_FLOAT_EQ(sum, w[j]);
+	}
+
+	// Operator form used by the iterative solvers
+	float S[2 * 2] = { 0, 1, 1, 0 };
+	float v[2] = { 3, 7 };
+	float Sv[2];
+
+	csr_init(&R, 2, 2, row_ptr, col_idx, values, 6);
+	csr_from_dense(&R, S, 0);
+	csr_operator(Sv, v, 2, &R);
+	EXPECT_FLOAT_EQ(Sv[0], 7);
+	EXPECT_FLOAT_EQ(Sv[1], 3);
+}
@@ -92,3 +92,76 @@ TEST(Main, SQRUKFID)
 	EXPECT_NEAR(E[99 * 3 + 1], 0, 1e-3);
 	EXPECT_NEAR(E[99 * 3 + 2], 0, 1e-3);
 }
+
+// Same model as G applied to all sigma points at once
+static void G_batch(float *D, const float *const x, const float *const W, uint16_t count,
+		    uint8_t L, void *ctx)
+{
+	int *calls = (int *)ctx;
+
+	(*calls)++;
+	for (uint16_t j = 0; j < count; j++) {
+		const float *w = &W[j * L];
+		float *dw = &D[j * L];
+
+		dw[0] = w[0] * sqrtf(x[1] - x[0]);
+		dw[1] = w[1] * x[1];
+		dw[2] = w[2] * x[2];
+	}
+}
+
+TEST(Main, SQRUKFIDBatch)
+{
+	const uint8_t L = 3;
+	float Re[3 * 3] = { 0.1f, 0, 0, 0, 0.1f, 0, 0, 0, 0.1f };
+	float Sw[3 * 3] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+	float Sw_batch[3 * 3] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+	float what[3] = { 0, 0, 0 };
+	float what_batch[3] = { 0, 0, 0 };
+	float x[3] = { 4.4f, 6.2f, 1.0f };
+	int calls = 0;
+
+	for (int i = 0; i < 50; i++) {
+		float d[3] = { 5.0f + 0.1f * sinf((float)i), x[1], x[2] };
+
+		ASSERT_EQ(sqr_ukf_id(d, what, Re, x, G, 1.0f, Sw, 0.1f, 2.0f, L), 0);
+		ASSERT_EQ(sqr_ukf_id_batch(d, what_batch, Re, x, G_batch, &calls, 1.0f, Sw_batch,
+					   0.1f, 2.0f, L),
+			  0);
+	}
+
+	EXPECT_EQ(calls, 50);
+	for (int i = 0; i < 3; i++)
+		EXPECT_FLOAT_EQ(what_batch[i], what[i]);
+	EXPECT_NEAR(what_batch[0], 5.0f / sqrtf(6.2f - 4.4f), 0.05f);
+}
+
+// Same model as G but uses w as scratch, which legacy models were allowed to do
+static void G_scratch(float dw[], float x[], float w[])
+{
+	G(dw, x, w);
+	for (int i = 0; i < 3; i++)
+		w[i] = -1.0f;
+}
+
+TEST(Main, SQRUKFIDModelWritesParameters)
+{
+	const uint8_t L = 3;
+	float Re[3 * 3] = { 0.1f, 0, 0, 0, 0.1f, 0, 0, 0, 0.1f };
+	float Sw[3 * 3] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+	float Sw_scratch[3 * 3] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+	float what[3] = { 0, 0, 0 };
+	float what_scratch[3] = { 0, 0, 0 };
+	float x[3] = { 4.4f, 6.2f, 1.0f };
+
+	for (int i = 0; i < 20; i++) {
+		float d[3] = { 5.0f, x[1], x[2] };
+
+		ASSERT_EQ(sqr_ukf_id(d, what, Re, x, G, 1.0f, Sw, 0.1f, 2.0f, L), 0);
+		ASSERT_EQ(sqr_ukf_id(d, what_scratch, Re, x, G_scratch, 1.0f, Sw_scratch, 0.1f,
+				     2.0f, L),
+			  0);
+	}
+	for (int i = 0; i < 3; i++)
+		EXPECT_FLOAT_EQ(what_scratch[i], what[i]);
+}